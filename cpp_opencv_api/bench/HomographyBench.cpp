@@ -0,0 +1,232 @@
+// cpp_opencv_api/bench/HomographyBench.cpp
+//
+// 호모그래피 추정 방식별 속도/정확도 벤치마크 (서버와 별도의 실행 파일)
+// 빌드: cmake -DMVEM_BUILD_BENCHMARKS=ON .. && make homography_bench
+// 실행: ./homography_bench [반복 횟수(기본 2000)]
+//
+// 합성 카메라(원근이 있는 지상 평면)에서 N개의 대응점을 뽑고 지상 좌표에 가우시안 잡음을 더한 뒤,
+// 각 방식의 호출당 시간과 "잡음 없는 참값" 대비 격자 포인트 투영 오차(RMS)를 출력합니다.
+// 두 번째 표는 HomographyEstimator의 모든 방식을 포인트 수 x 아웃라이어 비율 격자로 비교하고,
+// 칸마다 정확한(격자 오차 < 0.1 m) 방식 중 가장 빠른 것에 '*'를 표시합니다.
+
+#include "HomographyDlt.h"
+#include "HomographyEstimator.h"
+#include "MgenLogger.h"
+#include <opencv2/calib3d.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// 보정된 픽셀(1920x1080) -> 지상 좌표(미터)인 원근 호모그래피
+const cv::Matx33d TRUE_HOMOGRAPHY(0.021, 0.0042, -18.0,
+                                  -0.0011, 0.034, -9.5,
+                                  0.000012, 0.00041, 1.0);
+
+cv::Point2f Apply(const cv::Matx33d& h, const cv::Point2f& p) {
+    const double w = h(2, 0) * p.x + h(2, 1) * p.y + h(2, 2);
+    return {static_cast<float>((h(0, 0) * p.x + h(0, 1) * p.y + h(0, 2)) / w),
+            static_cast<float>((h(1, 0) * p.x + h(1, 1) * p.y + h(1, 2)) / w)};
+}
+
+struct Scenario {
+    std::vector<cv::Point2f> image;
+    std::vector<cv::Point2f> ground;
+};
+
+// N개 대응점 (지상 좌표에 noise_m 표준편차 잡음, outlier_ratio 비율은 1~20 m 어긋난 잘못된 대응)
+Scenario MakeScenario(size_t count, double noise_m, std::mt19937& rng, double outlier_ratio = 0.0) {
+    std::uniform_real_distribution<float> ux(40.0f, 1880.0f), uy(300.0f, 1040.0f);
+    std::normal_distribution<float> noise(0.0f, static_cast<float>(noise_m));
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f), offset(1.0f, 20.0f), angle(0.0f, 6.2831853f);
+    Scenario s;
+    for (size_t i = 0; i < count; ++i) {
+        const cv::Point2f p(ux(rng), uy(rng));
+        cv::Point2f g = Apply(TRUE_HOMOGRAPHY, p);
+        if (unit(rng) < outlier_ratio) {
+            const float r = offset(rng), a = angle(rng);
+            g.x += r * std::cos(a);
+            g.y += r * std::sin(a);
+        }
+        s.image.push_back(p);
+        s.ground.push_back({g.x + noise(rng), g.y + noise(rng)});
+    }
+    return s;
+}
+
+// 영상 전체 격자에서 참값 대비 투영 오차 RMS (미터)
+double GridError(const cv::Matx33d& h) {
+    double sum = 0.0;
+    int n = 0;
+    for (float y = 300.0f; y <= 1040.0f; y += 40.0f) {
+        for (float x = 40.0f; x <= 1880.0f; x += 40.0f) {
+            const cv::Point2f a = Apply(h, {x, y});
+            const cv::Point2f b = Apply(TRUE_HOMOGRAPHY, {x, y});
+            sum += (a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y);
+            ++n;
+        }
+    }
+    return std::sqrt(sum / n);
+}
+
+using Estimator = std::function<bool(const Scenario&, cv::Matx33d&)>;
+
+void Run(const char* name, const Estimator& estimate, const std::vector<Scenario>& scenarios, int repeats) {
+    cv::Matx33d h;
+    double error = 0.0;
+    int failures = 0;
+    for (const auto& s : scenarios) {
+        if (estimate(s, h)) {
+            error += GridError(h);
+        } else {
+            ++failures;
+        }
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r) {
+        estimate(scenarios[r % scenarios.size()], h);
+    }
+    const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count() / repeats;
+    const int ok = static_cast<int>(scenarios.size()) - failures;
+    std::printf("  %-22s %10.2f us/call   grid error %.4f m   failures %d\n", name, us, ok > 0 ? error / ok : NAN, failures);
+}
+
+struct EstimatorStats {
+    double us = 0.0;
+    double error = NAN;
+    double iterations = 0.0;   // 측정한 반복 횟수 평균 (measured == false면 의미 없음)
+    bool measured = true;      // OpenCV 추정기는 반복 횟수를 돌려주지 않음
+    int failures = 0;
+};
+
+// HomographyEstimator::Estimate 한 방식의 평균 시간/격자 오차/측정한 반복 횟수
+EstimatorStats RunEstimator(const MGEN::MVEM::HomographyEstimatorOptions& options, const std::vector<Scenario>& scenarios, int repeats) {
+    EstimatorStats stats;
+    MGEN::MVEM::HomographyEstimate estimate;
+    std::string error;
+    double error_sum = 0.0;
+    for (const auto& s : scenarios) {
+        if (MGEN::MVEM::HomographyEstimator::Estimate(s.image, s.ground, options, estimate, error)) {
+            error_sum += GridError(estimate.homography);
+            if (estimate.iterations == MGEN::MVEM::ITERATIONS_NOT_MEASURED) {
+                stats.measured = false;
+            } else {
+                stats.iterations += estimate.iterations;
+            }
+        } else {
+            ++stats.failures;
+        }
+    }
+    const int ok = static_cast<int>(scenarios.size()) - stats.failures;
+    if (ok > 0) {
+        stats.error = error_sum / ok;
+        stats.iterations /= ok;
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r) {
+        const Scenario& s = scenarios[r % scenarios.size()];
+        MGEN::MVEM::HomographyEstimator::Estimate(s.image, s.ground, options, estimate, error);
+    }
+    stats.us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count() / repeats;
+    return stats;
+}
+
+void RunEstimatorGrid(int repeats, std::mt19937& rng) {
+    using MGEN::MVEM::HomographyMethod;
+    constexpr double ACCURATE_ERROR_M = 0.1;
+    const HomographyMethod methods[] = {
+        HomographyMethod::Auto, HomographyMethod::Ransac, HomographyMethod::Lmeds, HomographyMethod::Rho,
+        HomographyMethod::UsacDefault, HomographyMethod::UsacParallel, HomographyMethod::UsacFast,
+        HomographyMethod::UsacAccurate, HomographyMethod::UsacProsac, HomographyMethod::UsacMagsac,
+        HomographyMethod::Dlt, HomographyMethod::ParallelRansac,
+    };
+
+    std::printf("Estimator grid (ground noise 0.02 m, threshold 0.1 m, '*' = fastest with grid error < %.2f m)\n", ACCURATE_ERROR_M);
+    for (size_t count : {8, 32, 128, 512, 2048}) {
+        // 큰 N은 호출당 비용이 크므로 반복 횟수를 줄임
+        const int cell_repeats = std::max(5, static_cast<int>(repeats * 8 / static_cast<int>(count)));
+        for (double outlier_ratio : {0.0, 0.1, 0.3, 0.5}) {
+            std::vector<Scenario> scenarios;
+            for (int i = 0; i < 16; ++i) {
+                scenarios.push_back(MakeScenario(count, 0.02, rng, outlier_ratio));
+            }
+
+            std::vector<EstimatorStats> stats;
+            int fastest = -1;
+            for (HomographyMethod method : methods) {
+                MGEN::MVEM::HomographyEstimatorOptions options;
+                options.method = method;
+                options.ransac_threshold = 0.1;
+                stats.push_back(RunEstimator(options, scenarios, cell_repeats));
+                const EstimatorStats& st = stats.back();
+                if (st.failures == 0 && st.error < ACCURATE_ERROR_M &&
+                    (fastest < 0 || st.us < stats[fastest].us)) {
+                    fastest = static_cast<int>(stats.size()) - 1;
+                }
+            }
+
+            std::printf("N = %zu, outliers %.0f%% (%d calls)\n", count, outlier_ratio * 100.0, cell_repeats);
+            for (size_t m = 0; m < stats.size(); ++m) {
+                char iterations[16] = "    n/a"; // OpenCV 추정기: 측정 불가
+                if (stats[m].measured) {
+                    std::snprintf(iterations, sizeof(iterations), "%7.1f", stats[m].iterations);
+                }
+                std::printf("  %c %-14s %10.2f us/call   grid error %9.4f m   iterations %s   failures %d\n",
+                            static_cast<int>(m) == fastest ? '*' : ' ',
+                            MGEN::MVEM::HomographyEstimator::MethodName(methods[m]),
+                            stats[m].us, stats[m].error, iterations, stats[m].failures);
+            }
+        }
+        std::printf("\n");
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int repeats = argc > 1 ? std::max(1, std::atoi(argv[1])) : 2000;
+    std::mt19937 rng(20240601);
+
+    for (size_t count : {4, 8, 16, 32, 50, 200}) {
+        std::vector<Scenario> scenarios;
+        for (int i = 0; i < 64; ++i) {
+            scenarios.push_back(MakeScenario(count, 0.02, rng));
+        }
+        std::printf("N = %zu (ground noise 0.02 m, %d calls)\n", count, repeats);
+
+        Run("opencv least-squares", [](const Scenario& s, cv::Matx33d& h) {
+            cv::Mat m = cv::findHomography(s.image, s.ground, 0);
+            if (m.empty()) return false;
+            h = cv::Matx33d(m);
+            return true;
+        }, scenarios, repeats);
+        Run("opencv ransac 3.0", [](const Scenario& s, cv::Matx33d& h) {
+            cv::Mat m = cv::findHomography(s.image, s.ground, cv::RANSAC, 3.0);
+            if (m.empty()) return false;
+            h = cv::Matx33d(m);
+            return true;
+        }, scenarios, repeats);
+        if (count == 4) {
+            Run("closed-form 4pt", [](const Scenario& s, cv::Matx33d& h) {
+                return MGEN::MVEM::FitHomography4Point(s.image.data(), s.ground.data(), h);
+            }, scenarios, repeats);
+        }
+        Run("dlt", [](const Scenario& s, cv::Matx33d& h) {
+            return MGEN::MVEM::FitHomographyDlt(s.image.data(), s.ground.data(), s.image.size(), h, 0);
+        }, scenarios, repeats);
+        Run("dlt + lm(10)", [](const Scenario& s, cv::Matx33d& h) {
+            return MGEN::MVEM::FitHomographyDlt(s.image.data(), s.ground.data(), s.image.size(), h, 10);
+        }, scenarios, repeats);
+        std::printf("\n");
+    }
+
+    RunEstimatorGrid(repeats, rng);
+    return 0;
+}
@@ -1,12 +1,21 @@
 #include "Calibrator.h"
+#include "CalibratorKernels.h"
+#include "UndistortGrid.h"
 #include "MgenLogger.h"
 
 // JSON
 #include "json/json.hpp"
 
+// OpenCV Core (cv::Matx::solve)
+#include <opencv2/core.hpp>
+
 // STL::C++
 #include <vector>
 #include <string>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mutex>
 
 namespace MGEN::MVEM // Multi-View Event Mapper
 {
@@ -15,126 +24,537 @@ namespace MGEN::MVEM // Multi-View Event Mapper
 
     // JSON parsing key value
     constexpr auto CALIBRATION_SETTING_KEY = "CalibrationInfo";
+    constexpr auto UNDISTORT_OPTIONS_KEY   = "UndistortOptions";
+
+    // 역왜곡 모델 적합 시 이미지 한 변당 표본 개수 (표본 수 = N * N)
+    constexpr int INVERSE_MODEL_SAMPLES_PER_AXIS = 48;
+    // 적합 표본 중 이 비율 이상이 잔차 검사를 통과해야 역모델을 사용
+    constexpr double INVERSE_MODEL_MIN_ACCEPTANCE = 0.5;
 
     //--------------------------------------------------------------------------
-    // 함수: CheckJsonValidation
-    // 설명: 주어진 JSON 객체가 Calibrator 초기화에 필요한 유효한 구조와 값을
-    //       가지고 있는지 정적으로 검사합니다. (키 존재, 숫자 타입, fx/fy != 0 확인)
-    //       noexcept를 보장하기 위해 내부에서 json 예외를 catch 합니다.
+    // 함수: HashCalibratorParams
+    // 설명: 10개 파라미터의 비트 패턴을 FNV-1a로 해시합니다. (-0.0은 0.0으로 정규화)
     //--------------------------------------------------------------------------
-    bool Calibrator::CheckJsonValidation( const nlohmann::json& js ) noexcept
+    uint64_t HashCalibratorParams( const CalibratorParams& p ) noexcept
+    {
+        const double values[] = { p.fx, p.fy, p.cx, p.cy, p.skew, p.k1, p.k2, p.k3, p.p1, p.p2 };
+
+        uint64_t hash = 14695981039346656037ULL; // FNV offset basis
+        for( double v : values ) {
+            if( v == 0.0 ) {
+                v = 0.0; // -0.0 정규화
+            }
+            uint64_t bits = 0;
+            std::memcpy( &bits, &v, sizeof( bits ) );
+            for( int b = 0; b < 8; ++b ) {
+                hash ^= ( bits >> ( b * 8 ) ) & 0xFFu;
+                hash *= 1099511628211ULL; // FNV prime
+            }
+        }
+        return hash;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: HashGridKey (파일 내부)
+    // 설명: 파라미터 해시에 격자 결과를 바꾸는 옵션(풀이 방식, 최대 반복, 역모델, 생성 임계값)을
+    //       FNV-1a로 이어 해시합니다. 격자 파일 이름과 헤더 검사에 함께 쓰이므로
+    //       std::hash처럼 빌드마다 달라질 수 있는 값은 사용하지 않습니다.
+    //--------------------------------------------------------------------------
+    static uint64_t HashGridKey( uint64_t params_hash, const CalibratorOptions& o ) noexcept
+    {
+        const double tolerance = o.inverse_model.enable ? o.inverse_model.tolerance_px : 0.0;
+        const double threshold = UndistortGrid::BUILD_ERR_THRESHOLD;
+        uint64_t tolerance_bits = 0, threshold_bits = 0;
+        std::memcpy( &tolerance_bits, &tolerance, sizeof( tolerance_bits ) );
+        std::memcpy( &threshold_bits, &threshold, sizeof( threshold_bits ) );
+        const uint64_t parts[] = {
+            static_cast<uint64_t>( o.solver ), static_cast<uint64_t>( o.max_iterations ),
+            static_cast<uint64_t>( o.inverse_model.enable ), tolerance_bits, threshold_bits,
+        };
+
+        uint64_t hash = params_hash;
+        for( uint64_t v : parts ) {
+            for( int b = 0; b < 8; ++b ) {
+                hash ^= ( v >> ( b * 8 ) ) & 0xFFu;
+                hash *= 1099511628211ULL; // FNV prime
+            }
+        }
+        return hash;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: AppendError (파일 내부)
+    // 설명: 오류 메시지를 "; "로 이어 붙입니다. (errors가 nullptr이면 무시)
+    //--------------------------------------------------------------------------
+    static void AppendError( std::string* errors, const char* prefix, const char* key, const char* suffix )
+    {
+        if( errors == nullptr ) {
+            return;
+        }
+        if( errors->empty() == false ) {
+            errors->append( "; " );
+        }
+        errors->append( prefix ).append( "'" ).append( key ).append( "'" ).append( suffix );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ParseParams
+    // 설명: "CalibrationInfo" 객체를 CALIBRATOR_PARAM_KEYS 표 순서로 한 번만 조회하며
+    //       숫자 타입 검사, fx/fy 0 검사, 값 기록을 동시에 수행합니다.
+    //       문제를 발견해도 멈추지 않고 끝까지 검사하여 모든 문제를 errors에 모읍니다.
+    //--------------------------------------------------------------------------
+    bool Calibrator::ParseParams( const nlohmann::json& js, CalibratorParams& out, std::string* errors ) noexcept
     {
         try {
-            // 1. JSON 객체가 비어있거나 최상위 키가 없는지 확인
-            if( js.empty() || js.contains( CALIBRATION_SETTING_KEY ) == false ) {
-                MLOG_WARN("CheckJsonValidation: JSON is empty or missing key '%s'", CALIBRATION_SETTING_KEY);
+            if( errors != nullptr ) {
+                errors->clear();
+            }
+
+            // 1. 최상위 캘리브레이션 정보 객체
+            const auto info = js.is_object() ? js.find( CALIBRATION_SETTING_KEY ) : js.end();
+            if( info == js.end() || info->is_object() == false ) {
+                AppendError( errors, "missing object ", CALIBRATION_SETTING_KEY, "" );
                 return false;
             }
 
-            // 2. 내부 캘리브레이션 정보 객체 접근
-            const auto& cinfo = js.at(CALIBRATION_SETTING_KEY); // at() 사용 (키 없으면 예외 발생)
+            // 2. 표의 모든 키를 한 번씩 조회 (find 1회 = 존재 확인 + 값 접근)
+            size_t error_count = 0;
+            for( const CalibratorParamKey& key : CALIBRATOR_PARAM_KEYS ) {
+                const auto node = info->find( key.name );
+                if( node == info->end() ) {
+                    AppendError( errors, "missing key ", key.name, "" );
+                    ++error_count;
+                    continue;
+                }
+                if( node->is_number() == false ) {
+                    AppendError( errors, "", key.name, " is not a number" );
+                    ++error_count;
+                    continue;
+                }
+                const double value = node->get<double>();
+                out.*key.member = value;
+                if( key.non_zero && std::fabs( value ) < Calibrator::CALIBRATE_INTERNAL_EPSILON ) {
+                    AppendError( errors, "", key.name, " is too close to zero" );
+                    ++error_count;
+                }
+            }
+            return error_count == 0;
+        }
+        catch( const std::exception& e ) {
+            MLOG_ERROR("Calibrator::ParseParams exception: %s", e.what());
+            return false;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ValidateParams
+    // 설명: 구조체로 전달된 파라미터를 검사합니다. (모든 값이 유한하고 fx/fy가 0에 가깝지 않음)
+    //--------------------------------------------------------------------------
+    bool Calibrator::ValidateParams( const CalibratorParams& params, std::string* errors ) noexcept
+    {
+        try {
+            if( errors != nullptr ) {
+                errors->clear();
+            }
+            size_t error_count = 0;
+            for( const CalibratorParamKey& key : CALIBRATOR_PARAM_KEYS ) {
+                const double value = params.*key.member;
+                if( std::isfinite( value ) == false ) {
+                    AppendError( errors, "", key.name, " is not finite" );
+                    ++error_count;
+                }
+                else if( key.non_zero && std::fabs( value ) < Calibrator::CALIBRATE_INTERNAL_EPSILON ) {
+                    AppendError( errors, "", key.name, " is too close to zero" );
+                    ++error_count;
+                }
+            }
+            return error_count == 0;
+        }
+        catch( const std::exception& e ) {
+            MLOG_ERROR("Calibrator::ValidateParams exception: %s", e.what());
+            return false;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: CheckJsonValidation
+    // 설명: ParseParams 결과로 유효성만 확인합니다. 실패하면 모든 문제를 한 번에 로그로 남깁니다.
+    //--------------------------------------------------------------------------
+    bool Calibrator::CheckJsonValidation( const nlohmann::json& js ) noexcept
+    {
+        CalibratorParams ignored {};
+        std::string errors;
+        if( Calibrator::ParseParams( js, ignored, &errors ) == false ) {
+            MLOG_WARN("CheckJsonValidation: %s", errors.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ParseForConstruction
+    // 설명: JSON 생성자용 단일 패스 파싱. 실패 시 기본값 파라미터와 false를 반환합니다.
+    //--------------------------------------------------------------------------
+    std::pair<bool, CalibratorParams> Calibrator::ParseForConstruction( const nlohmann::json& js ) noexcept
+    {
+        CalibratorParams params {};
+        std::string errors;
+        if( Calibrator::ParseParams( js, params, &errors ) == false ) {
+            MLOG_WARN("Calibrator: invalid calibration JSON: %s", errors.c_str());
+            return { false, CalibratorParams {} };
+        }
+        return { true, params };
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ValidateForConstruction
+    // 설명: 구조체 생성자용 값 검사. 실패 시 모든 문제를 로그로 남깁니다.
+    //--------------------------------------------------------------------------
+    std::pair<bool, CalibratorParams> Calibrator::ValidateForConstruction( const CalibratorParams& params ) noexcept
+    {
+        std::string errors;
+        if( Calibrator::ValidateParams( params, &errors ) == false ) {
+            MLOG_WARN("Calibrator: invalid calibration parameters: %s", errors.c_str());
+            return { false, CalibratorParams {} };
+        }
+        return { true, params };
+    }
+
+    // 격자 파일 캐시 디렉토리 (서버 설정, ConfigureGridCacheDir)
+    static std::mutex  grid_cache_dir_mutex;
+    static std::string grid_cache_dir;
+
+    void Calibrator::ConfigureGridCacheDir( const std::string& cache_dir )
+    {
+        std::lock_guard<std::mutex> lock( grid_cache_dir_mutex );
+        grid_cache_dir = cache_dir;
+    }
 
-            // 3. 필수 키 리스트 정의
-            const std::vector<std::string> key_list = {
-                "fx", "fy", "cx", "cy", "skew", "k1", "k2", "k3", "p1", "p2"
-            };
+    std::string Calibrator::GridCacheDir()
+    {
+        std::lock_guard<std::mutex> lock( grid_cache_dir_mutex );
+        return grid_cache_dir;
+    }
 
-            // 비교에 사용할 작은 값 (epsilon) 정의
-            const double epsilon = Calibrator::CALIBRATE_INTERNAL_EPSILON; // 클래스에 정의된 값 사용
+    //--------------------------------------------------------------------------
+    // 함수: ParseOptions
+    // 설명: 선택 항목 "UndistortOptions" 객체로부터 풀이 방식과 최대 반복 횟수를 읽습니다.
+    //       항목이 없거나 값이 잘못되면 해당 필드는 기본값을 유지합니다.
+    //--------------------------------------------------------------------------
+    CalibratorOptions Calibrator::ParseOptions( const nlohmann::json& js ) noexcept
+    {
+        CalibratorOptions opt {};
+        try {
+            if( js.is_object() == false || js.contains( UNDISTORT_OPTIONS_KEY ) == false ) {
+                return opt;
+            }
+            const auto& node = js.at( UNDISTORT_OPTIONS_KEY );
+            if( node.is_object() == false ) {
+                MLOG_WARN("ParseOptions: '%s' is not an object. Using default options.", UNDISTORT_OPTIONS_KEY);
+                return opt;
+            }
 
-            // 4. 모든 필수 키에 대해 검사 반복
-            for( const std::string& key_name : key_list ) {
-                // 4.1. 키 존재 여부 확인
-                if( cinfo.contains( key_name ) == false ) {
-                    MLOG_WARN("CheckJsonValidation: Missing key '%s'", key_name.c_str());
-                    return false;
+            // 1. 풀이 방식
+            if( node.contains( "solver" ) ) {
+                const std::string solver = node.at( "solver" ).get<std::string>();
+                if( solver == "newton" ) {
+                    opt.solver = UndistortSolver::Newton;
                 }
+                else if( solver == "fixed_point" ) {
+                    opt.solver = UndistortSolver::FixedPoint;
+                }
+                else {
+                    MLOG_WARN("ParseOptions: Unknown solver '%s'. Using 'fixed_point'.", solver.c_str());
+                }
+            }
 
-                const auto& value_node = cinfo.at(key_name); // at() 사용 (키 없으면 예외 발생)
+            // 2. 최대 반복 횟수 (1 이상)
+            if( node.contains( "max_iterations" ) && node.at( "max_iterations" ).is_number_integer() ) {
+                const int max_iterations = node.at( "max_iterations" ).get<int>();
+                if( max_iterations >= 1 ) {
+                    opt.max_iterations = max_iterations;
+                }
+                else {
+                    MLOG_WARN("ParseOptions: max_iterations (%d) must be >= 1. Using default %d.", max_iterations, opt.max_iterations);
+                }
+            }
 
-                // 4.2. 숫자 타입 여부 확인
-                if( value_node.is_number() == false ){
-                    MLOG_WARN("CheckJsonValidation: Key '%s' is not a number.", key_name.c_str());
-                    return false;
+            // 3. 이미지 크기 (격자/역모델 범위, 선택)
+            opt.image_width  = std::max( 0, node.value( "image_width",  opt.image_width ) );
+            opt.image_height = std::max( 0, node.value( "image_height", opt.image_height ) );
+
+            // 4. 역왜곡 다항식 모델 (선택)
+            if( node.contains( "inverse_model" ) && node.at( "inverse_model" ).is_object() ) {
+                const auto& m = node.at( "inverse_model" );
+                opt.inverse_model.enable       = m.value( "enable",       opt.inverse_model.enable );
+                opt.inverse_model.tolerance_px = m.value( "tolerance_px", opt.inverse_model.tolerance_px );
+                if( !( opt.inverse_model.tolerance_px > 0.0 ) ) {
+                    MLOG_WARN("ParseOptions: inverse_model.tolerance_px must be > 0. Using 0.001.");
+                    opt.inverse_model.tolerance_px = 1e-3;
                 }
+            }
 
-                // 4.3. fx, fy 값 유효성(0 아님) 확인
-                if( key_name == "fx" || key_name == "fy" ){
-                    double value = value_node.get<double>(); // 숫자 타입이므로 get<double> 가능
-                    // 값이 0에 매우 가까운지 확인
-                    if( std::fabs(value) < epsilon ){
-                        MLOG_WARN("CheckJsonValidation: '%s' value (%.3e) is too close to zero.", key_name.c_str(), value);
-                        return false; // 0에 가까우면 유효하지 않음
-                    }
+            // 5. 왜곡 보정 격자 (선택). 파일 캐시 위치는 서버 설정만 사용 (요청이 임의 경로에 쓰지 못하도록)
+            if( node.contains( "lookup_grid" ) && node.at( "lookup_grid" ).is_object() ) {
+                const auto& g = node.at( "lookup_grid" );
+                opt.grid.enable = g.value( "enable", opt.grid.enable );
+                opt.grid.cell   = g.value( "cell",   opt.grid.cell );
+                if( opt.grid.cell < 1 || opt.grid.cell > UndistortGrid::MAX_CELL ) {
+                    MLOG_WARN("ParseOptions: lookup_grid.cell (%d) must be in [1, %d]. Using 8.", opt.grid.cell, UndistortGrid::MAX_CELL);
+                    opt.grid.cell = 8;
+                }
+                if( g.contains( "cache_dir" ) ) {
+                    MLOG_WARN("ParseOptions: lookup_grid.cache_dir is a server setting and is ignored in requests.");
                 }
             }
+            opt.grid.cache_dir = GridCacheDir();
         }
         catch( const nlohmann::json::exception& e ){
-            MLOG_ERROR("CheckJsonValidation exception: %s", e.what());
-            return false;
+            MLOG_WARN("ParseOptions exception: %s. Using default options.", e.what());
+            return CalibratorOptions {};
         }
-        // 모든 검사를 통과하면 true 반환
-        return true;
+        return opt;
     }
 
     //--------------------------------------------------------------------------
-    // 함수: ParseJson
-    // 설명: JSON 객체로부터 CalibratorParams 구조체를 파싱합니다.
-    //       호출 전에 CheckJsonValidation이 통과되었다고 가정합니다.
-    //       값 변환 오류 발생 시 기본값(0.0)을 가진 구조체를 반환할 수 있습니다.
-    //       (noexcept 제거됨)
+    // 생성자: Calibrator (JSON)
+    // 설명: JSON을 한 번만 순회하여 검사와 파싱을 마친 뒤 공통 생성자로 위임합니다.
     //--------------------------------------------------------------------------
-    CalibratorParams Calibrator::ParseJson( const nlohmann::json& js )
+    Calibrator::Calibrator( const nlohmann::json& js, const CalibratorOptions& options )
+        : Calibrator( ParseForConstruction( js ), options )
     {
-        CalibratorParams res {}; // 결과 구조체 (0.0으로 초기화됨)
+    }
 
-        // CheckJsonValidation이 외부(생성자)에서 호출된다고 가정.
-        // 만약 여기서도 안전하게 하려면 js 및 cinfo 접근 전에 contains 체크 필요.
-        try {
-            // 1. 내부 캘리브레이션 정보 객체 접근
-            const auto& cinfo = js.at(CALIBRATION_SETTING_KEY);
-
-            // 2. 각 키에 해당하는 값을 읽어와 파라미터 구조체에 설정
-            //    value() 함수는 키가 없거나 타입 변환 실패 시 기본값(0.0) 사용
-            //    단, 호환 불가능한 타입(객체/배열 등)이면 예외 발생 가능
-            res.fx   = cinfo.value( "fx",   0.0 ); // double 리터럴 0.0 사용
-            res.fy   = cinfo.value( "fy",   0.0 );
-            res.cx   = cinfo.value( "cx",   0.0 );
-            res.cy   = cinfo.value( "cy",   0.0 );
-            res.skew = cinfo.value( "skew", 0.0 );
-            res.k1   = cinfo.value( "k1",   0.0 );
-            res.k2   = cinfo.value( "k2",   0.0 );
-            res.k3   = cinfo.value( "k3",   0.0 );
-            res.p1   = cinfo.value( "p1",   0.0 );
-            res.p2   = cinfo.value( "p2",   0.0 );
-
-        } catch (const nlohmann::json::exception& e) {
-            // 오류 시 기본값(0.0)으로 채워진 res 반환
-            MLOG_ERROR("JSON parsing error in Calibrator::ParseJson: %s", e.what());
-            return CalibratorParams {};
-        }
-        return res; // 파싱된 결과 반환
+    //--------------------------------------------------------------------------
+    // 생성자: Calibrator (파라미터 구조체)
+    // 설명: JSON 없이 숫자 값으로 바로 생성합니다. 값 검사 실패 시 유효하지 않은 객체가 됩니다.
+    //--------------------------------------------------------------------------
+    Calibrator::Calibrator( const CalibratorParams& params, const CalibratorOptions& options )
+        : Calibrator( ValidateForConstruction( params ), options )
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // 생성자: Calibrator (공통, private)
+    // 설명: 검사가 끝난 파라미터를 저장하고, 커널 선택과 선택 기능(역모델, 격자)을 준비합니다.
+    //--------------------------------------------------------------------------
+    Calibrator::Calibrator( const std::pair<bool, CalibratorParams>& checked, const CalibratorOptions& options )
+        : is_valid ( checked.first )                                              // 1. 유효성 검사 결과
+        , c_info   ( checked.first ? checked.second : CalibratorParams{} )        // 2. 유효할 때만 파라미터 사용, 아니면 기본값
+        , opts     ( options )                                                     // 3. 풀이 옵션 저장
+        , terms    ( Calibrator::ActiveTerms( c_info ) )                           // 4. 0이 아닌 항 계산
+    {
+        // 5. 활성 항에 맞게 특수화된 커널 선택
+        this->SelectKernels();
+
+        // 6. 선택 기능: 역왜곡 모델 적합 (FitInverseModel은 역모델이 없는 상태의 반복 풀이를 사용)
+        //    항등 변환이면 보정 자체가 복사이므로 역모델/격자 모두 불필요
+        if( is_valid && opts.inverse_model.enable && !isIdentity() ) {
+            inverse_model = this->FitInverseModel();
+        }
+
+        // 7. 선택 기능: 왜곡 보정 격자 준비 (PrepareGrid는 grid가 비어 있는 상태의 풀이를 사용)
+        if( is_valid && opts.grid.enable && !isIdentity() ) {
+            grid = this->PrepareGrid();
+        }
     }
 
     //--------------------------------------------------------------------------
-    // 생성자: Calibrator
-    // 설명: JSON 객체를 받아 유효성을 검사하고, 유효하다면 파라미터를 파싱하여
-    //       멤버 변수 c_info와 is_valid를 초기화합니다.
-    //       (유효성 검사 중복 호출 최적화 적용)
+    // 함수: ActiveTerms
+    // 설명: 0이 아닌 계수로부터 DistortionTerm 비트 플래그를 계산합니다. (k3가 있으면 TERM_RADIAL도 포함)
     //--------------------------------------------------------------------------
-    Calibrator::Calibrator( const nlohmann::json& js )
-        : is_valid ( Calibrator::CheckJsonValidation( js ) )                       // 1. 유효성 검사 결과를 먼저 저장
-        , c_info   ( is_valid ? Calibrator::ParseJson( js ) : CalibratorParams{} ) // 2. 유효할 때만 파싱, 아니면 기본값 사용
+    uint8_t Calibrator::ActiveTerms( const CalibratorParams& p ) noexcept
     {
-        // 생성자 본문에서는 추가 작업 없음
-        // 만약 ParseJson에서 예외 발생 가능성을 엄격히 처리하려면 여기서 try-catch 고려 가능
-        // try {
-        //     c_info = is_valid ? Calibrator::ParseJson( js ) : CalibratorParams{};
-        // } catch (...) {
-        //     is_valid = false; // 예외 발생 시 유효하지 않음으로 처리
-        //     c_info = {}; // 기본값으로 설정
-        //     // 로그 기록 등 추가 처리
-        // }
+        uint8_t t = 0;
+        if( p.k1 != 0.0 || p.k2 != 0.0 || p.k3 != 0.0 ) { t |= TERM_RADIAL; }
+        if( p.k3 != 0.0 )                                { t |= TERM_K3; }
+        if( p.p1 != 0.0 || p.p2 != 0.0 )                 { t |= TERM_TANGENTIAL; }
+        if( p.skew != 0.0 )                              { t |= TERM_SKEW; }
+        return t;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ImageSize
+    // 설명: 옵션의 이미지 크기를 반환합니다. 지정되지 않은 축은 주점이 중앙이라고 보고 2 * (cx, cy)를 사용합니다.
+    //--------------------------------------------------------------------------
+    cv::Size Calibrator::ImageSize() const noexcept
+    {
+        const int width  = opts.image_width  > 0 ? opts.image_width  : static_cast<int>( std::lround( 2.0 * c_info.cx ) );
+        const int height = opts.image_height > 0 ? opts.image_height : static_cast<int>( std::lround( 2.0 * c_info.cy ) );
+        return cv::Size { width, height };
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: FitInverseModel
+    // 설명: 이미지 범위의 균일 표본을 반복 풀이로 정확히 보정한 뒤,
+    //       (왜곡 -> 보정) 정규화 좌표 쌍으로부터 6개 계수(a1~a4, q1, q2)를 선형 최소제곱으로 적합합니다.
+    //       적합된 모델은 커널에서 1회 뉴턴 보정 + 잔차 검사와 함께 사용되므로,
+    //       여기서는 그 경로를 그대로 통과시켜 수용 비율과 최대 오차를 측정합니다.
+    //--------------------------------------------------------------------------
+    InverseDistortionModel Calibrator::FitInverseModel() const
+    {
+        InverseDistortionModel model {};
+
+        const cv::Size size = this->ImageSize();
+        if( size.width <= 1 || size.height <= 1 ) {
+            MLOG_WARN("Calibrator: cannot determine image size (%dx%d) for inverse model. Disabled.", size.width, size.height);
+            return model;
+        }
+
+        // 1. 표본 생성 (경계 포함 균일 격자)
+        constexpr int N = INVERSE_MODEL_SAMPLES_PER_AXIS;
+        const size_t count = static_cast<size_t>( N ) * N;
+        std::vector<float> src_x( count ), src_y( count ), dst_x( count ), dst_y( count );
+        for( int j = 0; j < N; ++j ) {
+            for( int i = 0; i < N; ++i ) {
+                src_x[ j * N + i ] = static_cast<float>( ( size.width  - 1 ) * static_cast<double>( i ) / ( N - 1 ) );
+                src_y[ j * N + i ] = static_cast<float>( ( size.height - 1 ) * static_cast<double>( j ) / ( N - 1 ) );
+            }
+        }
+
+        // 2. 반복 풀이로 정답 계산 (inverse_model이 아직 비어 있으므로 순수 반복 풀이)
+        std::vector<uint64_t> mask( MaskWords( count ), 0 );
+        size_t lane_iterations = 0;
+        SolveBatch( src_x.data(), src_y.data(), count, dst_x.data(), dst_y.data(), mask.data(),
+                    cv::Point2f { 1e-9f, 1e-9f }, lane_iterations );
+
+        // 3. 정규 방정식 (A^T A) c = A^T b 누적. 한 표본당 x, y 두 개의 식
+        const simd::KernelCoeffs kc = simd::MakeCoeffs( c_info );
+        cv::Matx66d ata = cv::Matx66d::zeros();
+        cv::Vec6d   atb = cv::Vec6d::zeros();
+        size_t used = 0;
+        double r2_max = 0.0;
+
+        auto accumulate = [ &ata, &atb ]( const double ( &row )[ 6 ], double rhs ) {
+            for( int r = 0; r < 6; ++r ) {
+                for( int k = 0; k < 6; ++k ) {
+                    ata( r, k ) += row[ r ] * row[ k ];
+                }
+                atb( r ) += row[ r ] * rhs;
+            }
+        };
+
+        for( size_t s = 0; s < count; ++s ) {
+            if( ( ( mask[ s >> 6 ] >> ( s & 63 ) ) & 1u ) == 0 ) {
+                continue; // 수렴하지 않은 표본(역변환 불가 영역)은 제외
+            }
+            simd::ScalarD dx, dy, ux, uy;
+            simd::NormalizeLanes( kc, simd::ScalarD { src_x[ s ] }, simd::ScalarD { src_y[ s ] }, dx, dy );
+            simd::NormalizeLanes( kc, simd::ScalarD { dst_x[ s ] }, simd::ScalarD { dst_y[ s ] }, ux, uy );
+
+            const double x  = dx.v, y = dy.v;
+            const double r2 = x * x + y * y;
+            const double r4 = r2 * r2;
+            const double r6 = r4 * r2;
+            const double r8 = r4 * r4;
+
+            const double row_x[ 6 ] = { x * r2, x * r4, x * r6, x * r8, 2.0 * x * y,     r2 + 2.0 * x * x };
+            const double row_y[ 6 ] = { y * r2, y * r4, y * r6, y * r8, r2 + 2.0 * y * y, 2.0 * x * y     };
+            accumulate( row_x, ux.v - x );
+            accumulate( row_y, uy.v - y );
+
+            r2_max = std::max( r2_max, r2 );
+            ++used;
+        }
+
+        if( used < 16 ) {
+            MLOG_WARN("Calibrator: too few converged samples (%zu) for inverse model. Disabled.", used);
+            return model;
+        }
+
+        // 4. 열 스케일 정규화 후 풀이 (rho^8 열과 rho^2 열의 크기 차이가 커서 조건수를 낮춤)
+        double scale[ 6 ];
+        for( int r = 0; r < 6; ++r ) {
+            scale[ r ] = ata( r, r ) > 0.0 ? 1.0 / std::sqrt( ata( r, r ) ) : 1.0;
+        }
+        for( int r = 0; r < 6; ++r ) {
+            for( int k = 0; k < 6; ++k ) {
+                ata( r, k ) *= scale[ r ] * scale[ k ];
+            }
+            atb( r ) *= scale[ r ];
+        }
+        const cv::Vec6d coeffs = ata.solve( atb, cv::DECOMP_SVD );
+
+        model.a1 = coeffs( 0 ) * scale[ 0 ];
+        model.a2 = coeffs( 1 ) * scale[ 1 ];
+        model.a3 = coeffs( 2 ) * scale[ 2 ];
+        model.a4 = coeffs( 3 ) * scale[ 3 ];
+        model.q1 = coeffs( 4 ) * scale[ 4 ];
+        model.q2 = coeffs( 5 ) * scale[ 5 ];
+        model.r2_max    = r2_max;
+        model.tolerance = opts.inverse_model.tolerance_px / std::max( std::abs( c_info.fx ), std::abs( c_info.fy ) );
+        model.valid     = std::isfinite( model.a1 ) && std::isfinite( model.a2 ) && std::isfinite( model.a3 )
+                       && std::isfinite( model.a4 ) && std::isfinite( model.q1 ) && std::isfinite( model.q2 );
+        if( model.valid == false ) {
+            MLOG_WARN("Calibrator: inverse model fit failed (non-finite coefficients). Disabled.");
+            return InverseDistortionModel {};
+        }
+
+        // 5. 커널과 같은 경로(다항식 + 1회 뉴턴 + 잔차 검사)로 표본을 다시 보정하여 품질 측정
+        const simd::KernelCoeffs kinv = simd::MakeCoeffs( c_info, &model );
+        size_t accepted = 0;
+        for( size_t s = 0; s < count; ++s ) {
+            if( ( ( mask[ s >> 6 ] >> ( s & 63 ) ) & 1u ) == 0 ) {
+                continue;
+            }
+            simd::ScalarD tx, ty, ux, uy, px, py;
+            simd::NormalizeLanes( kinv, simd::ScalarD { src_x[ s ] }, simd::ScalarD { src_y[ s ] }, tx, ty );
+            if( simd::InverseLanes( kinv, tx, ty, ux, uy, model.tolerance, model.tolerance ) == false ) {
+                continue;
+            }
+            simd::DeNormalizeLanes( kinv, ux, uy, px, py );
+            model.max_error_px = std::max( model.max_error_px, std::hypot( px.v - dst_x[ s ], py.v - dst_y[ s ] ) );
+            ++accepted;
+        }
+        model.acceptance = static_cast<double>( accepted ) / static_cast<double>( used );
+
+        if( model.acceptance < INVERSE_MODEL_MIN_ACCEPTANCE ) {
+            MLOG_WARN("Calibrator: inverse model acceptance too low (%.1f%%). Falling back to iterative solver.", model.acceptance * 100.0);
+            return InverseDistortionModel {};
+        }
+
+        MLOG_INFO("Calibrator: inverse model fitted (samples=%zu, acceptance=%.1f%%, max_error=%.4fpx).",
+                  used, model.acceptance * 100.0, model.max_error_px);
+        return model;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: PrepareGrid
+    // 설명: 캐시 디렉토리가 지정되어 있으면 파라미터 + 옵션 해시(HashGridKey)로 격자 파일을 찾아 mmap으로 읽고,
+    //       없거나 맞지 않으면 새로 만든 뒤 파일로 저장합니다.
+    //       옵션이 다른 Calibrator(예: 뉴턴 풀이 vs 느슨한 역모델)는 서로의 격자를 읽지 않습니다.
+    //--------------------------------------------------------------------------
+    std::shared_ptr<const UndistortGrid> Calibrator::PrepareGrid() const
+    {
+        const cv::Size size = this->ImageSize();
+        const int width  = size.width;
+        const int height = size.height;
+        const int cell   = opts.grid.cell;
+        if( width <= 0 || height <= 0 ) {
+            MLOG_WARN("Calibrator: cannot determine lookup grid size (%dx%d). Grid disabled.", width, height);
+            return nullptr;
+        }
+        if( UndistortGrid::WithinLimits( width, height, cell ) == false ) {
+            MLOG_WARN("Calibrator: lookup grid %dx%d (cell %d) exceeds size limits. Grid disabled.", width, height, cell);
+            return nullptr;
+        }
+
+        const uint64_t hash = HashGridKey( HashCalibratorParams( c_info ), opts );
+        const bool use_file = opts.grid.cache_dir.empty() == false;
+        const std::string path = use_file ? UndistortGrid::FilePath( opts.grid.cache_dir, hash, width, height, cell ) : std::string {};
+
+        if( use_file ) {
+            if( auto loaded = UndistortGrid::Load( path, hash, width, height, cell ) ) {
+                return loaded;
+            }
+        }
+
+        const cv::Point2f build_threshold { UndistortGrid::BUILD_ERR_THRESHOLD, UndistortGrid::BUILD_ERR_THRESHOLD };
+        auto built = UndistortGrid::Build( *this, hash, width, height, cell, build_threshold );
+        if( built && use_file && built->Save( path ) ) {
+            MLOG_INFO("UndistortGrid saved to '%s'.", path.c_str());
+        }
+        return built;
     }
 
     //--------------------------------------------------------------------------
@@ -181,6 +601,20 @@ namespace MGEN::MVEM // Multi-View Event Mapper
         return denormalized_pt;
     }
 
+    //--------------------------------------------------------------------------
+    // 함수: Distort
+    // 설명: 보정된 픽셀 좌표에 왜곡 모델을 적용하여 왜곡된 픽셀 좌표를 계산합니다. (Calibrate의 역연산)
+    //       객체가 유효하지 않으면(isValid() == false) 입력값을 그대로 반환합니다.
+    //--------------------------------------------------------------------------
+    cv::Point2f Calibrator::Distort( const cv::Point2f& pt ) const
+    {
+        if( !this->isValid() ){
+            MLOG_WARN("Calibrator::Distort called on invalid object. Returning input point.");
+            return pt;
+        }
+        return DeNormalize( DistortNormal( Normalize( pt ) ) );
+    }
+
     //--------------------------------------------------------------------------
     // 함수: DistortNormal (이전 DistortNomal 오타 수정)
     // 설명: 정규화된 (왜곡되지 않은) 이미지 좌표에 왜곡 모델(방사, 접선)을 적용하여
@@ -221,54 +655,112 @@ namespace MGEN::MVEM // Multi-View Event Mapper
     // 함수: Calibrate
     // 설명: 입력된 픽셀 좌표(pt)의 왜곡을 보정하여 실제 픽셀 좌표를 반환합니다.
     //       내부적으로 Normalize -> Iterative Undistortion -> DeNormalize 과정을 거칩니다.
-    //       객체가 유효하지 않으면 입력값(pt)을 그대로 반환합니다.
+    //       반복 계산은 배치 경로와 같은 커널(스칼라 레인)을 사용하며,
+    //       생성 시 지정된 풀이 방식(고정점 / 뉴턴)과 최대 반복 횟수를 따릅니다.
+    //       객체가 유효하지 않거나 수렴하지 않으면 std::nullopt를 반환합니다.
     //--------------------------------------------------------------------------
-    std::optional<cv::Point2f> Calibrator::Calibrate( const cv::Point2f& pt, const cv::Point2f& err_threshold ) const
+    std::optional<cv::Point2f> Calibrator::Calibrate( const cv::Point2f& pt, const cv::Point2f& err_threshold, int* iterations ) const
     {
+        if( iterations != nullptr ) {
+            *iterations = 0;
+        }
+
         // 1. 객체 유효성 검사 (fx, fy 0 포함)
         if( is_valid == false ) {
             // MLOG_WARN("Calibrator::Calibrate called on invalid object. Returning input point.");
             return std::nullopt; // 유효하지 않으면 nullopt
         }
 
-        // 2. 입력 픽셀 좌표(pt)를 정규화된 이미지 좌표(p_n_d)로 변환
-        // p_n_d 는 왜곡이 적용된 상태의 정규화된 좌표임
-        cv::Point2f p_n_d = this->Normalize( pt );
-
-        // 3. 왜곡 보정된 정규화 좌표(crrct)를 찾기 위한 반복 계산 시작
-        // 초기 추정값: 왜곡된 좌표 p_n_d 를 왜곡 안 된 좌표의 초기값으로 사용
-        cv::Point2f crrct     = p_n_d;
-        bool        converged = false; // 수렴 성공 여부 플래그
+        // 2. 왜곡 계수가 모두 0이면 항등 변환 (반복 없이 입력 반환)
+        if( isIdentity() ) {
+            return pt;
+        }
 
-        // 최대 반복 횟수 설정 (무한 루프 방지)
-        int try_count = 100; // 이전 10000은 과도할 수 있음, 100 정도도 충분한 경우가 많음 (조정 가능)
-        while( try_count-- > 0 )
-        {
-            // 현재 추정값(crrct)을 왜곡 모델에 넣어 예상되는 왜곡 좌표 계산
-            cv::Point2f distorted_estimate = this->DistortNormal( crrct );
+        // 3. 격자가 있고 보간 오차가 err_threshold 이하이면 쌍선형 보간으로 O(1) 보정
+        //    (허용 오차가 더 작거나, 범위 밖이거나 실패 셀이면 반복 계산으로 진행)
+        if( grid && grid->Accepts( err_threshold ) ) {
+            cv::Point2f approx;
+            if( grid->Lookup( pt.x, pt.y, approx ) ) {
+                return approx;
+            }
+        }
 
-            // 목표 왜곡 좌표(p_n_d)와의 차이(err) 계산
-            cv::Point2f err = distorted_estimate - p_n_d;
+        // 4. 스칼라 레인으로 계산 (Normalize -> 역모델 또는 반복 보정 -> DeNormalize)
+        //    생성 시 선택된 특수화 커널을 사용
+        const simd::KernelCoeffs kc = simd::MakeCoeffs( c_info, &inverse_model );
+        double x = pt.x;
+        double y = pt.y;
+        size_t lane_iterations = 0;
 
-            // 오차(err)를 이용하여 현재 추정값(crrct) 보정 (단순 반복법)
-            crrct = crrct - err; // 왜곡된 결과가 목표보다 크면 추정값을 줄이고, 작으면 늘림
+        const bool converged = point_kernel( kc, x, y, opts.max_iterations, err_threshold.x, err_threshold.y, lane_iterations );
 
-            // 보정된 오차(err)가 임계값(err_threshold)보다 작아지면 반복 종료 (절대값 비교!)
-            if( std::fabs(err.x) < err_threshold.x && std::fabs(err.y) < err_threshold.y ) {
-                converged = true; // 수렴 성공 플래그 설정
-                break; // 수렴 완료
-            }
+        if( iterations != nullptr ) {
+            *iterations = static_cast<int>( lane_iterations );
         }
-        // 4. 수렴 결과 확인 및 최종 값 반환
+
+        // 5. 수렴 결과 확인 및 최종 값 반환
         if( converged ){
-            // 수렴 성공 시: 최종 추정값(crrct)을 역정규화하여 반환 (optional로 감싸서)
-            return this->DeNormalize( crrct );
+            return cv::Point2f { static_cast<float>( x ), static_cast<float>( y ) };
         }
         else {
             // 수렴 실패 시 (최대 반복 횟수 초과)
-            MLOG_WARN("Calibrator::Calibrate reached max iterations without converging for input (%.2f, %.2f).", pt.x, pt.y);
+            MLOG_WARN("Calibrator::Calibrate reached max iterations (%d) without converging for input (%.2f, %.2f).", opts.max_iterations, pt.x, pt.y);
             return std::nullopt; // 빈 optional 반환하여 실패 알림
         }
     }
 
-} // nsp::MGEN::MVEM
\ No newline at end of file
+    //--------------------------------------------------------------------------
+    // 함수: CalibrateTrack
+    // 설명: 트랙 상태(직전 해 + 역야코비안)로 초기값을 외삽하여 왜곡 보정합니다.
+    //       격자 조회가 성공하면 격자 결과를 그대로 사용하고(반복 0회, 트랙 상태는 끊김),
+    //       measure_baseline이면 같은 포인트를 콜드 스타트로도 풀어 절약한 반복 횟수를 집계합니다.
+    //--------------------------------------------------------------------------
+    std::optional<cv::Point2f> Calibrator::CalibrateTrack( const cv::Point2f& pt, TrackState& state, const cv::Point2f& err_threshold ) const
+    {
+        // 1. 객체 유효성 검사
+        if( is_valid == false ) {
+            state.Break();
+            return std::nullopt;
+        }
+        ++state.points;
+
+        // 2. 항등 변환
+        if( isIdentity() ) {
+            return pt;
+        }
+
+        // 3. 격자 조회 (보간 오차가 err_threshold 이하일 때만. 성공하면 반복이 없으므로 웜 스타트 불필요)
+        if( grid && grid->Accepts( err_threshold ) ) {
+            cv::Point2f approx;
+            if( grid->Lookup( pt.x, pt.y, approx ) ) {
+                state.Break();
+                return approx;
+            }
+        }
+
+        const simd::KernelCoeffs kc = simd::MakeCoeffs( c_info, &inverse_model );
+
+        // 4. (선택) 콜드 스타트 기준 반복 횟수 측정
+        if( state.measure_baseline ) {
+            double bx = pt.x;
+            double by = pt.y;
+            size_t baseline = 0;
+            point_kernel( kc, bx, by, opts.max_iterations, err_threshold.x, err_threshold.y, baseline );
+            state.baseline_iterations += baseline;
+        }
+
+        // 5. 웜 스타트 보정
+        double x = pt.x;
+        double y = pt.y;
+        size_t lane_iterations = 0;
+        const bool converged = track_kernel( kc, state, x, y, opts.max_iterations, err_threshold.x, err_threshold.y, lane_iterations );
+        state.iterations += lane_iterations;
+
+        if( converged == false ) {
+            MLOG_WARN("Calibrator::CalibrateTrack reached max iterations (%d) without converging for input (%.2f, %.2f).", opts.max_iterations, pt.x, pt.y);
+            return std::nullopt;
+        }
+        return cv::Point2f { static_cast<float>( x ), static_cast<float>( y ) };
+    }
+
+} // nsp::MGEN::MVEM
@@ -17,8 +17,15 @@
 #include <opencv2/core/types.hpp> // cv::Point2f 사용
 
 // STL
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
 #include <limits> // std::numeric_limits
+#include <memory> // std::shared_ptr
 #include <optional>
+#include <string>
+#include <utility> // std::pair
+
+namespace MGEN { class WorkerPool; }
 
 namespace MGEN::MVEM // Multi-View Event Mapper
 {
@@ -45,6 +52,158 @@ namespace MGEN::MVEM // Multi-View Event Mapper
         double p2   = 0.0; /**< 접선 왜곡 계수 p2 */
     };
 
+    /**
+     * @brief JSON 키 이름과 CalibratorParams 멤버의 대응표 (파싱/비교/해시에서 공용으로 사용).
+     */
+    struct CalibratorParamKey
+    {
+        const char* name;                   /**< "CalibrationInfo" 안의 키 이름 */
+        double CalibratorParams::* member;  /**< 대상 멤버 */
+        bool non_zero;                      /**< 0에 가까우면 안 되는 값인지 여부 (fx, fy) */
+    };
+
+    inline constexpr CalibratorParamKey CALIBRATOR_PARAM_KEYS[] = {
+        { "fx",   &CalibratorParams::fx,   true  }, { "fy", &CalibratorParams::fy, true  },
+        { "cx",   &CalibratorParams::cx,   false }, { "cy", &CalibratorParams::cy, false },
+        { "skew", &CalibratorParams::skew, false },
+        { "k1",   &CalibratorParams::k1,   false }, { "k2", &CalibratorParams::k2, false }, { "k3", &CalibratorParams::k3, false },
+        { "p1",   &CalibratorParams::p1,   false }, { "p2", &CalibratorParams::p2, false },
+    };
+
+    /**
+     * @brief 10개 캘리브레이션 파라미터의 정규화된 64bit 해시 (FNV-1a).
+     * -0.0은 0.0으로 취급하므로 값이 같은 파라미터는 항상 같은 해시를 가집니다.
+     * 격자 파일 이름 등 파라미터 식별 키로 사용합니다.
+     */
+    uint64_t HashCalibratorParams( const CalibratorParams& params ) noexcept;
+
+    /**
+     * @brief 0이 아닌 왜곡/내부 파라미터 항을 나타내는 비트 플래그.
+     * 생성 시 파라미터로부터 계산되며, 이 조합에 맞게 컴파일 시점에 특수화된 커널이 선택됩니다.
+     */
+    enum DistortionTerm : uint8_t
+    {
+        TERM_RADIAL     = 1u << 0, /**< k1, k2, k3 중 하나 이상이 0이 아님 */
+        TERM_K3         = 1u << 1, /**< k3가 0이 아님 (TERM_RADIAL 포함) */
+        TERM_TANGENTIAL = 1u << 2, /**< p1, p2 중 하나 이상이 0이 아님 */
+        TERM_SKEW       = 1u << 3, /**< skew가 0이 아님 */
+        TERM_ALL        = TERM_RADIAL | TERM_K3 | TERM_TANGENTIAL | TERM_SKEW,
+        TERM_DISTORTION = TERM_RADIAL | TERM_K3 | TERM_TANGENTIAL /**< 이 비트가 모두 0이면 보정은 항등 변환 */
+    };
+
+    /**
+     * @brief 생성 시 적합(fit)한 역왜곡 다항식 모델의 계수.
+     * 왜곡된 정규화 좌표 d = (x, y), rho^2 = x^2 + y^2 에 대해 보정 좌표 u를 다음과 같이 근사합니다.
+     *   u_x = x + x * (a1*rho^2 + a2*rho^4 + a3*rho^6 + a4*rho^8) + 2*q1*x*y + q2*(rho^2 + 2*x^2)
+     *   u_y = y + y * (a1*rho^2 + a2*rho^4 + a3*rho^6 + a4*rho^8) + q1*(rho^2 + 2*y^2) + 2*q2*x*y
+     */
+    struct InverseDistortionModel
+    {
+        bool   valid        = false; /**< 모델 사용 가능 여부 */
+        double a1 = 0.0, a2 = 0.0, a3 = 0.0, a4 = 0.0; /**< 방사 항 계수 */
+        double q1 = 0.0, q2 = 0.0;   /**< 접선 항 계수 */
+        double r2_max       = 0.0;   /**< 적합 범위: 왜곡된 정규화 반경의 제곱 최대값 */
+        double tolerance    = 0.0;   /**< 결과를 받아들이는 최대 잔차 (정규화 좌표) */
+        double max_error_px = 0.0;   /**< 적합 표본에서 측정한 최대 오차 (픽셀) */
+        double acceptance   = 0.0;   /**< 적합 표본 중 잔차 검사를 통과한 비율 (0~1) */
+    };
+
+    /**
+     * @brief 시간적으로 연속된 포인트 트랙의 왜곡 보정 상태 (Calibrator::CalibrateTrack 전용).
+     * 직전 포인트의 해와 그 위치의 역야코비안을 보관하여 다음 포인트의 초기값을 추정합니다.
+     *   u_seed = u_prev + J^-1(u_prev) * (d - d_prev)   (d: 왜곡된 정규화 좌표, u: 보정 좌표)
+     * 트랙(객체)마다 하나씩 두며, 스레드 간에 공유하지 않습니다.
+     */
+    struct TrackState
+    {
+        // 직전 포인트 (has_prev == false면 다음 포인트는 콜드 스타트)
+        bool   has_prev = false;
+        double prev_dx  = 0.0, prev_dy = 0.0;                /**< 직전 왜곡된 정규화 좌표 */
+        double prev_ux  = 0.0, prev_uy = 0.0;                /**< 직전 보정된 정규화 좌표 */
+        double inv_j00  = 1.0, inv_j01 = 0.0, inv_j11 = 1.0; /**< 직전 해에서의 역야코비안 (대칭) */
+
+        // 통계
+        bool     measure_baseline    = false; /**< true면 같은 포인트를 콜드 스타트로도 풀어 baseline_iterations를 측정 */
+        uint64_t points              = 0;     /**< 처리한 포인트 수 */
+        uint64_t warm_starts         = 0;     /**< 직전 해로 초기값을 추정한 횟수 */
+        uint64_t cold_restarts       = 0;     /**< 웜 스타트가 수렴하지 못해 콜드 스타트로 다시 푼 횟수 */
+        uint64_t iterations          = 0;     /**< 실제 수행한 반복 횟수의 합 */
+        uint64_t baseline_iterations = 0;     /**< 콜드 스타트였다면 수행했을 반복 횟수의 합 (measure_baseline일 때만) */
+
+        /** 절약한 반복 횟수 (measure_baseline일 때만 의미 있음) */
+        int64_t savedIterations() const noexcept { return static_cast<int64_t>( baseline_iterations ) - static_cast<int64_t>( iterations ); }
+
+        /** 트랙이 끊겼을 때 호출 (통계는 유지) */
+        void Break() noexcept { has_prev = false; }
+    };
+
+    /**
+     * @brief Calibrator::ProjectBatch의 포인트별 결과 상태.
+     */
+    enum ProjectStatus : uint8_t
+    {
+        PROJECT_OK            = 0, /**< 보정 + 투영 성공 */
+        PROJECT_NOT_CONVERGED = 1, /**< 왜곡 보정이 수렴하지 않음 (출력은 NaN) */
+        PROJECT_AT_INFINITY   = 2, /**< 호모그래피의 W가 0에 가까움 (소실선 위의 점, 출력은 NaN) */
+        PROJECT_INVALID       = 3, /**< Calibrator가 유효하지 않음 (출력은 NaN) */
+        PROJECT_OUTSIDE_MODEL = 4, /**< (역투영) 왜곡 모델이 접히는 반경 밖 (출력은 NaN) */
+    };
+
+    // 전방 선언
+    class UndistortGrid;
+    namespace simd { struct KernelCoeffs; struct HomographyCoeffs; }
+
+    /**
+     * @brief 왜곡 보정(undistortion) 반복 계산에 사용할 풀이 방식.
+     */
+    enum class UndistortSolver : uint8_t
+    {
+        FixedPoint, /**< 고정점 반복: u -= (distort(u) - d). 반복당 비용이 작지만 강한 왜곡에서 수렴이 느림 */
+        Newton,     /**< 뉴턴 반복: u -= J^-1 * (distort(u) - d). 해석적 야코비안 사용, 적은 반복으로 수렴 */
+    };
+
+    /**
+     * @brief Calibrator 인스턴스별 왜곡 보정 옵션.
+     * JSON 설정의 "UndistortOptions" 객체로 지정하거나 생성자에 직접 전달할 수 있습니다.
+     */
+    struct CalibratorOptions
+    {
+        UndistortSolver solver         = UndistortSolver::FixedPoint; /**< 반복 풀이 방식 */
+        int             max_iterations = 100;                         /**< 포인트당 최대 반복 횟수 (1 이상) */
+        int             image_width    = 0; /**< 입력 이미지 너비 (격자/역모델 범위). 0이면 2 * cx 사용 */
+        int             image_height   = 0; /**< 입력 이미지 높이 (격자/역모델 범위). 0이면 2 * cy 사용 */
+
+        /**
+         * @brief 역왜곡 다항식 모델(closed-form inverse).
+         * 생성 시 이미지 범위에서 표본을 정확히 풀어 역모델 계수를 최소제곱으로 맞추고,
+         * 범위 안의 포인트는 역모델 평가 + 고정 1회 뉴턴 보정으로 반복 없이 보정합니다.
+         * 보정 결과의 잔차가 tolerance_px 또는 호출자의 err_threshold를 넘거나 범위 밖이면 기존 반복 풀이로 대체하므로
+         * 결과 정확도는 err_threshold를 그대로 따릅니다.
+         * 생성 시 표본 풀이와 SVD 비용이 있으므로 기본값은 꺼짐이며, 요청의 "inverse_model"로 켭니다.
+         */
+        struct InverseModel
+        {
+            bool   enable       = false; /**< 역모델 사용 여부 */
+            double tolerance_px = 1e-3; /**< 역모델 결과를 받아들이는 최대 잔차 (픽셀) */
+        } inverse_model;
+
+        /**
+         * @brief 선택 기능: 왜곡 보정 격자(lookup grid).
+         * 활성화하면 생성 시 격자를 만들고(또는 캐시 파일을 mmap으로 읽고),
+         * 격자 범위 안의 포인트는 반복 계산 없이 쌍선형 보간으로 보정합니다.
+         * 격자 크기는 UndistortGrid::MAX_DIMENSION / MAX_NODES로 제한되며, 넘으면 격자 없이 동작합니다.
+         * 보간 결과는 측정된 최대 보간 오차(UndistortGrid::getMaxErrorPx)만큼 틀릴 수 있으므로,
+         * 호출자의 err_threshold가 그보다 작으면 격자를 쓰지 않고 반복 풀이로 보정합니다.
+         */
+        struct Grid
+        {
+            bool        enable    = false; /**< 격자 사용 여부 (격자 범위는 image_width x image_height) */
+            int         cell      = 8;     /**< 격자 간격 (픽셀, 1 ~ UndistortGrid::MAX_CELL) */
+            std::string cache_dir = "";    /**< 격자 파일 저장 디렉토리. 비어 있으면 파일 캐시 사용 안 함.
+                                                ParseOptions는 요청 JSON이 아닌 Calibrator::GridCacheDir()(서버 설정)로 채움 */
+        } grid;
+    };
+
     /**
      * @brief JSON 설정 파일로부터 카메라 파라미터를 로드하여
      * 2D 포인트의 왜곡 보정(undistortion)을 수행하는 클래스.
@@ -54,15 +213,24 @@ namespace MGEN::MVEM // Multi-View Event Mapper
     class Calibrator
     {
     public:
-        /** 기본 생성자 삭제: 반드시 JSON 객체로 초기화해야 함 */
+        /** 기본 생성자 삭제: 반드시 JSON 객체 또는 파라미터 구조체로 초기화해야 함 */
         Calibrator() = delete;
 
         /**
          * @brief nlohmann::json 객체로부터 Calibrator를 생성합니다.
-         * 내부적으로 JSON 유효성을 검사하고 파라미터를 파싱하여 저장합니다.
+         * 내부적으로 ParseParams로 유효성 검사와 파싱을 한 번에 수행합니다.
          * @param json 카메라 파라미터가 포함된 nlohmann::json 객체.
+         * @param options 왜곡 보정 풀이 방식 및 최대 반복 횟수.
+         */
+        explicit Calibrator( const nlohmann::json& json, const CalibratorOptions& options = CalibratorOptions {} );
+
+        /**
+         * @brief 이미 숫자 값을 가진 호출자를 위해 파라미터 구조체로 Calibrator를 직접 생성합니다. (JSON 미사용)
+         * ValidateParams와 같은 검사(fx/fy가 0이 아님, 모든 값이 유한)를 통과해야 유효합니다.
+         * @param params 카메라 파라미터.
+         * @param options 왜곡 보정 풀이 방식 및 최대 반복 횟수.
          */
-        explicit Calibrator( const nlohmann::json& json );
+        explicit Calibrator( const CalibratorParams& params, const CalibratorOptions& options = CalibratorOptions {} );
 
         /** 기본 소멸자 */
         ~Calibrator() = default;
@@ -72,37 +240,92 @@ namespace MGEN::MVEM // Multi-View Event Mapper
          * 내부적으로 반복적인 방법을 사용하여 왜곡 제거 좌표를 계산합니다.
          * @param point 왜곡된 픽셀 좌표 (cv::Point2f).
          * @param err_threshold 반복 계산 종료를 위한 오차 임계값 (x, y 각각). 양수 값이어야 함.
+         * @param iterations (선택) 수행한 반복 횟수를 받을 포인터. nullptr이면 무시.
          * @return 왜곡 보정에 성공하면 보정된 픽셀 좌표(cv::Point2f)를 포함하는 std::optional 객체.
          * 객체가 유효하지 않거나 계산이 수렴하지 않으면 std::nullopt 반환.
          */
-        std::optional<cv::Point2f> Calibrate( const cv::Point2f& point, const cv::Point2f& err_threshold = { 1e-7, 1e-7 } ) const;
+        std::optional<cv::Point2f> Calibrate( const cv::Point2f& point, const cv::Point2f& err_threshold = { 1e-7, 1e-7 },
+                                              int* iterations = nullptr ) const;
 
         /**
-         * @brief Calibrator 객체가 유효한 보정 파라미터로 초기화되었는지 확인합니다.
-         * 생성 시 CheckJsonValidation 결과 (키 존재, 타입, fx/fy 0 검사 포함)를 반환합니다.
-         * Calibrate 함수 등을 호출하기 전에 이 함수로 유효성을 확인해야 합니다.
-         * @return 파라미터가 유효하면 true, 그렇지 않으면 false.
+         * @brief 트랙(연속 프레임의 같은 객체)의 다음 포인트를 웜 스타트로 왜곡 보정합니다.
+         * 직전 포인트의 해에서 야코비안 외삽으로 초기값을 잡으므로, 포인트 간격이 작으면
+         * 반복 1~2회로 수렴합니다. 웜 스타트가 수렴하지 못하면 Calibrate와 같은 콜드 스타트로 다시 풉니다.
+         * 결과는 Calibrate()와 err_threshold 범위 내에서 동일합니다.
+         * @param point 왜곡된 픽셀 좌표.
+         * @param state 트랙 상태 (호출 시 갱신). 처음에는 기본 생성된 TrackState를 넘깁니다.
+         * @param err_threshold 반복 계산 종료를 위한 오차 임계값 (Calibrate와 동일).
+         * @return 보정된 픽셀 좌표. 객체가 유효하지 않거나 수렴하지 않으면 std::nullopt (이때 트랙은 끊김 처리).
          */
-        bool isValid() const noexcept { return is_valid; }
+        std::optional<cv::Point2f> CalibrateTrack( const cv::Point2f& point, TrackState& state,
+                                                   const cv::Point2f& err_threshold = { 1e-7, 1e-7 } ) const;
 
         /**
-         * @brief 주어진 nlohmann::json 객체가 Calibrator 초기화에 필요한
-         * 유효한 구조와 값을 가지고 있는지 정적으로 검사합니다.
-         * 키 존재 여부, 숫자 타입 여부, fx/fy가 0에 가까운지 여부를 확인합니다.
-         * @param json 검사할 nlohmann::json 객체.
-         * @return 유효하면 true, 그렇지 않으면 false.
+         * @brief 여러 개의 2D 포인트를 한 번에 왜곡 보정합니다 (Batch Undistortion).
+         * 입력은 구조체 배열(AoS)이 아닌 배열 구조체(SoA) 형태(x 배열, y 배열)이며,
+         * 빌드 시 활성화된 명령어 집합(AVX-512 / AVX2)으로 여러 포인트를 동시에 계산합니다.
+         * 지원하지 않는 빌드이거나 남은 꼬리(tail) 포인트는 스칼라 경로로 처리합니다.
+         * 결과는 Calibrate()와 err_threshold 범위 내에서 동일합니다.
+         * @param src_x 왜곡된 픽셀 x 좌표 배열 (count 개).
+         * @param src_y 왜곡된 픽셀 y 좌표 배열 (count 개).
+         * @param count 포인트 개수.
+         * @param dst_x 보정된 픽셀 x 좌표를 저장할 배열 (count 개, src_x와 같아도 됨).
+         * @param dst_y 보정된 픽셀 y 좌표를 저장할 배열 (count 개, src_y와 같아도 됨).
+         * @param converged_mask 포인트별 수렴 여부 비트마스크 (MaskWords(count) 개의 워드).
+         * i번째 포인트가 수렴하면 converged_mask[i / 64]의 (i % 64)번째 비트가 1이 됩니다.
+         * 수렴하지 못한 포인트의 출력 좌표는 입력 좌표를 그대로 유지합니다.
+         * @param err_threshold 반복 계산 종료를 위한 오차 임계값 (Calibrate와 동일).
+         * @param total_iterations (선택) 모든 포인트가 수행한 반복 횟수의 합을 받을 포인터.
+         * @return 수렴에 성공한 포인트 개수. 객체가 유효하지 않으면 0.
          */
-        static bool CheckJsonValidation( const nlohmann::json& json ) noexcept;
+        size_t CalibrateBatch( const float* src_x, const float* src_y, size_t count,
+                               float* dst_x, float* dst_y, uint64_t* converged_mask,
+                               const cv::Point2f& err_threshold = { 1e-7, 1e-7 },
+                               size_t* total_iterations = nullptr ) const;
 
-    private:
         /**
-         * @brief 유효성이 검증된 nlohmann::json 객체로부터 CalibratorParams를 파싱합니다.
-         * 주의: 이 함수는 호출 전에 CheckJsonValidation이 true를 반환했음을 가정합니다.
-         * 내부적으로 값 타입 오류 발생 시 기본값을 가지는 CalibratorParams를 반환할 수 있습니다.
-         * @param json 파싱할 nlohmann::json 객체 (유효성 검사 통과 가정).
-         * @return 파싱된 CalibratorParams 구조체.
+         * @brief CalibrateBatch를 여러 코어에서 병렬로 실행합니다 (대량 오프라인 처리용).
+         * 입력을 PARALLEL_CHUNK_POINTS 개(64의 배수)씩 나누어 워커 풀에서 처리하며,
+         * 각 청크는 서로 겹치지 않는 출력 구간과 마스크 워드에만 쓰므로 결과는 스레드 수와 무관하게
+         * CalibrateBatch와 동일합니다. 인자 의미도 CalibrateBatch와 같습니다.
+         * @param pool 사용할 워커 풀. nullptr이면 프로세스 공용 풀(MGEN::WorkerPool::Shared) 사용.
+         * @return 수렴에 성공한 포인트 개수.
          */
-        static CalibratorParams ParseJson( const nlohmann::json& json );
+        size_t CalibrateBatchParallel( const float* src_x, const float* src_y, size_t count,
+                                       float* dst_x, float* dst_y, uint64_t* converged_mask,
+                                       const cv::Point2f& err_threshold = { 1e-7, 1e-7 },
+                                       size_t* total_iterations = nullptr,
+                                       MGEN::WorkerPool* pool = nullptr ) const;
+
+        /**
+         * @brief 왜곡된 픽셀 좌표를 지상 좌표로 한 번에 투영합니다 (Batch Projection).
+         * 포인트마다 왜곡 보정 -> 호모그래피 곱 -> 원근 나눗셈을 하나의 SIMD 커널에서 연속으로 수행하므로
+         * 중간 결과(보정 좌표)를 메모리에 쓰지 않습니다. 격자를 사용하는 경우에는 격자 보정 후 투영합니다.
+         * @param src_x, src_y 왜곡된 픽셀 좌표 배열 (count 개).
+         * @param count 포인트 개수.
+         * @param homography 보정된 픽셀 좌표 -> 지상 좌표 호모그래피 (3x3).
+         * @param dst_x, dst_y 지상 좌표를 저장할 배열 (count 개, 입력 배열과 같아도 됨). 실패한 포인트는 NaN.
+         * @param status 포인트별 결과 상태 (ProjectStatus, count 개).
+         * @param err_threshold 반복 계산 종료를 위한 오차 임계값 (Calibrate와 동일).
+         * @param total_iterations (선택) 모든 포인트가 수행한 반복 횟수의 합을 받을 포인터.
+         * @return PROJECT_OK인 포인트 개수.
+         */
+        size_t ProjectBatch( const float* src_x, const float* src_y, size_t count, const cv::Matx33d& homography,
+                             float* dst_x, float* dst_y, uint8_t* status,
+                             const cv::Point2f& err_threshold = { 1e-7, 1e-7 },
+                             size_t* total_iterations = nullptr ) const;
+
+        /**
+         * @brief ProjectBatch를 PARALLEL_CHUNK_POINTS 단위로 나누어 워커 풀에서 병렬 실행합니다.
+         * 결과는 스레드 수와 무관하게 ProjectBatch와 동일합니다.
+         * @param pool 사용할 워커 풀. nullptr이면 프로세스 공용 풀 사용.
+         * @return PROJECT_OK인 포인트 개수.
+         */
+        size_t ProjectBatchParallel( const float* src_x, const float* src_y, size_t count, const cv::Matx33d& homography,
+                                     float* dst_x, float* dst_y, uint8_t* status,
+                                     const cv::Point2f& err_threshold = { 1e-7, 1e-7 },
+                                     size_t* total_iterations = nullptr,
+                                     MGEN::WorkerPool* pool = nullptr ) const;
 
         /**
          * @brief 입력 픽셀 좌표를 정규화된 이미지 평면 좌표로 변환합니다.
@@ -128,11 +351,211 @@ namespace MGEN::MVEM // Multi-View Event Mapper
          */
         cv::Point2f DistortNormal( const cv::Point2f& point ) const;
 
+        /**
+         * @brief 보정된(왜곡 없는) 픽셀 좌표에 왜곡 모델을 적용하여 왜곡된 픽셀 좌표를 계산합니다. (Calibrate의 역연산)
+         * DeNormalize( DistortNormal( Normalize( point ) ) ) 와 같습니다.
+         * @param point 보정된 픽셀 좌표.
+         * @return 왜곡된 픽셀 좌표. 객체가 유효하지 않으면 입력값 반환.
+         */
+        cv::Point2f Distort( const cv::Point2f& point ) const;
+
+        /**
+         * @brief 지상 좌표를 왜곡된 픽셀 좌표로 한 번에 역투영합니다 (ProjectBatch의 역연산).
+         * 포인트마다 역호모그래피 곱 -> 원근 나눗셈 -> 정규화 -> 왜곡 -> 역정규화를 하나의 SIMD 커널에서 수행합니다.
+         * 반복 계산이 없으므로 포인트당 비용이 일정합니다.
+         * 왜곡 모델은 방사 다항식이 접히는 반경 밖에서 단조성을 잃으므로, 결과 위치의 야코비안 행렬식이
+         * 양수가 아닌 포인트는 PROJECT_OUTSIDE_MODEL로 표시합니다. (화면에 그리면 엉뚱한 위치에 나타나는 점)
+         * @param src_x, src_y 지상 좌표 배열 (count 개).
+         * @param count 포인트 개수.
+         * @param inverse_homography 지상 좌표 -> 보정된 픽셀 좌표 호모그래피 (ProjectBatch에 쓰는 행렬의 역행렬).
+         * @param dst_x, dst_y 왜곡된 픽셀 좌표를 저장할 배열 (count 개, 입력 배열과 같아도 됨). 실패한 포인트는 NaN.
+         * @param status 포인트별 결과 상태 (ProjectStatus, count 개).
+         * @return PROJECT_OK인 포인트 개수.
+         */
+        size_t UnprojectBatch( const float* src_x, const float* src_y, size_t count, const cv::Matx33d& inverse_homography,
+                               float* dst_x, float* dst_y, uint8_t* status ) const;
+
+        /**
+         * @brief UnprojectBatch를 PARALLEL_CHUNK_POINTS 단위로 나누어 워커 풀에서 병렬 실행합니다.
+         * @param pool 사용할 워커 풀. nullptr이면 프로세스 공용 풀 사용.
+         * @return PROJECT_OK인 포인트 개수.
+         */
+        size_t UnprojectBatchParallel( const float* src_x, const float* src_y, size_t count, const cv::Matx33d& inverse_homography,
+                                       float* dst_x, float* dst_y, uint8_t* status, MGEN::WorkerPool* pool = nullptr ) const;
+
+        /** 병렬 배치의 청크 크기 (포인트 수). 64의 배수이며 입출력 4개 배열(64KB)이 L2 캐시에 들어가는 크기 */
+        static constexpr size_t PARALLEL_CHUNK_POINTS = 4096;
+
+        /**
+         * @brief CalibrateBatch의 수렴 비트마스크에 필요한 64bit 워드 개수를 반환합니다.
+         * @param count 포인트 개수.
+         */
+        static constexpr size_t MaskWords( size_t count ) noexcept { return ( count + 63 ) / 64; }
+
+        /**
+         * @brief 빌드에 포함된 배치 연산 백엔드 이름을 반환합니다. ("avx512", "avx2", "scalar")
+         */
+        static const char* BatchBackendName() noexcept;
+
+        /**
+         * @brief Calibrator 객체가 유효한 보정 파라미터로 초기화되었는지 확인합니다.
+         * 생성 시 ParseParams / ValidateParams 결과 (키 존재, 타입, fx/fy 0 검사 포함)를 반환합니다.
+         * Calibrate 함수 등을 호출하기 전에 이 함수로 유효성을 확인해야 합니다.
+         * @return 파라미터가 유효하면 true, 그렇지 않으면 false.
+         */
+        bool isValid() const noexcept { return is_valid; }
+
+        /**
+         * @brief 생성 시 지정된 왜곡 보정 옵션을 반환합니다.
+         */
+        const CalibratorOptions& getOptions() const noexcept { return opts; }
+
+        /**
+         * @brief 생성된 파라미터를 반환합니다. (유효하지 않은 객체는 기본값)
+         */
+        const CalibratorParams& getParams() const noexcept { return c_info; }
+
+        /**
+         * @brief 왜곡 보정 격자를 반환합니다. 격자를 사용하지 않으면 nullptr.
+         */
+        const std::shared_ptr<const UndistortGrid>& getGrid() const noexcept { return grid; }
+
+        /**
+         * @brief 생성 시 적합한 역왜곡 모델을 반환합니다. 사용하지 않으면 valid == false.
+         */
+        const InverseDistortionModel& getInverseModel() const noexcept { return inverse_model; }
+
+        /**
+         * @brief 0이 아닌 파라미터 항의 비트 플래그(DistortionTerm 조합)를 반환합니다.
+         */
+        uint8_t getActiveTerms() const noexcept { return terms; }
+
+        /**
+         * @brief 왜곡 계수가 모두 0이라 보정이 항등 변환인지 여부. (반복 없이 입력을 그대로 반환)
+         */
+        bool isIdentity() const noexcept { return ( terms & TERM_DISTORTION ) == 0; }
+
+        /**
+         * @brief 파라미터에서 0이 아닌 항을 DistortionTerm 비트 플래그로 계산합니다.
+         */
+        static uint8_t ActiveTerms( const CalibratorParams& params ) noexcept;
+
+        /**
+         * @brief 주어진 nlohmann::json 객체가 Calibrator 초기화에 필요한
+         * 유효한 구조와 값을 가지고 있는지 정적으로 검사합니다. (ParseParams 결과만 사용)
+         * 실패하면 발견한 모든 문제를 한 줄의 경고 로그로 남깁니다.
+         * @param json 검사할 nlohmann::json 객체.
+         * @return 유효하면 true, 그렇지 않으면 false.
+         */
+        static bool CheckJsonValidation( const nlohmann::json& json ) noexcept;
+
+        /**
+         * @brief JSON 객체를 한 번만 순회하며 유효성 검사와 파싱을 동시에 수행합니다.
+         * CALIBRATOR_PARAM_KEYS 표의 각 키를 찾아 숫자인지 확인하고 out에 바로 기록합니다.
+         * 첫 번째 오류에서 멈추지 않고 모든 문제(누락 키, 숫자가 아닌 값, 0에 가까운 fx/fy)를 모읍니다.
+         * 성공 경로에서는 힙 할당이 없습니다.
+         * @param json 파싱할 nlohmann::json 객체 ("CalibrationInfo" 포함).
+         * @param out  파싱 결과 (실패해도 읽을 수 있었던 값은 기록됨).
+         * @param errors (선택) 실패 시 모든 문제를 "; "로 이어 붙인 메시지를 받을 문자열.
+         * @return 모든 키가 유효하면 true.
+         */
+        static bool ParseParams( const nlohmann::json& json, CalibratorParams& out, std::string* errors = nullptr ) noexcept;
+
+        /**
+         * @brief 파라미터 구조체의 값을 검사합니다. (fx/fy가 0에 가깝지 않고 모든 값이 유한한지)
+         * @param params 검사할 파라미터.
+         * @param errors (선택) 실패 시 모든 문제를 "; "로 이어 붙인 메시지를 받을 문자열.
+         * @return 유효하면 true.
+         */
+        static bool ValidateParams( const CalibratorParams& params, std::string* errors = nullptr ) noexcept;
+
+        /**
+         * @brief JSON 객체의 선택 항목 "UndistortOptions"로부터 CalibratorOptions를 읽습니다.
+         * 예: { "UndistortOptions": { "solver": "newton", "max_iterations": 20, "image_width": 1920, "image_height": 1080,
+         *        "inverse_model": { "enable": true, "tolerance_px": 0.001 },
+         *        "lookup_grid": { "enable": true, "cell": 8 } } }
+         * 항목이 없거나 값이 잘못된 경우 해당 필드는 기본값을 유지합니다.
+         * 격자 캐시 디렉토리는 요청이 정할 수 없으므로 "lookup_grid"의 "cache_dir"는 무시하고 GridCacheDir()를 사용합니다.
+         * @param json 검사할 nlohmann::json 객체 (Calibrator 생성에 사용하는 것과 동일한 객체).
+         * @return 읽어들인 CalibratorOptions.
+         */
+        static CalibratorOptions ParseOptions( const nlohmann::json& json ) noexcept;
+
+        /**
+         * @brief ParseOptions가 사용할 격자 파일 캐시 디렉토리(서버 설정)를 지정합니다.
+         * 서버 시작 전에 한 번 호출합니다. 빈 문자열이면 격자 파일 캐시를 사용하지 않습니다. (기본값)
+         */
+        static void ConfigureGridCacheDir( const std::string& cache_dir );
+
+        /** ConfigureGridCacheDir로 지정한 격자 파일 캐시 디렉토리. */
+        static std::string GridCacheDir();
+
+    private:
+        /** 검사가 끝난 (유효 여부, 파라미터)로 생성 (공개 생성자들이 위임) */
+        Calibrator( const std::pair<bool, CalibratorParams>& checked, const CalibratorOptions& options );
+
+        /** JSON을 한 번 파싱하여 (유효 여부, 파라미터)를 반환. 실패 시 모든 문제를 로그로 남김 */
+        static std::pair<bool, CalibratorParams> ParseForConstruction( const nlohmann::json& json ) noexcept;
+
+        /** 구조체 값을 검사하여 (유효 여부, 파라미터)를 반환. 실패 시 모든 문제를 로그로 남김 */
+        static std::pair<bool, CalibratorParams> ValidateForConstruction( const CalibratorParams& params ) noexcept;
+
+        /**
+         * @brief 격자를 사용하지 않고 반복 풀이만으로 배치 보정합니다. (CalibrateBatch 내부 구현)
+         * converged_mask는 호출 측에서 0으로 초기화되어 있어야 합니다.
+         */
+        size_t SolveBatch( const float* src_x, const float* src_y, size_t count,
+                           float* dst_x, float* dst_y, uint64_t* converged_mask,
+                           const cv::Point2f& err_threshold, size_t& lane_iterations ) const;
+
+        /**
+         * @brief 활성 항(terms)과 풀이 방식에 맞게 특수화된 커널을 선택합니다. (생성자에서 호출)
+         */
+        void SelectKernels() noexcept;
+
+        /**
+         * @brief 옵션에 따라 왜곡 보정 격자를 파일에서 읽거나 새로 만듭니다. (생성자에서 호출)
+         */
+        std::shared_ptr<const UndistortGrid> PrepareGrid() const;
+
+        /**
+         * @brief 이미지 범위에서 표본을 반복 풀이로 보정한 뒤 역왜곡 모델을 최소제곱으로 적합합니다. (생성자에서 호출)
+         */
+        InverseDistortionModel FitInverseModel() const;
+
+        /**
+         * @brief 격자/역모델이 덮을 이미지 크기. 옵션에 없으면 주점이 중앙이라고 보고 2 * (cx, cy) 사용.
+         */
+        cv::Size ImageSize() const noexcept;
+
     private:
         // 생성 시 JSON 유효성 검사 결과 (fx/fy 0 포함) (생성 후 불변)
         const bool is_valid;
         // 로드된 카메라 캘리브레이션 파라미터 (생성 후 불변)
         const CalibratorParams c_info;
+        // 왜곡 보정 풀이 옵션 (생성 후 불변)
+        const CalibratorOptions opts;
+        // 0이 아닌 파라미터 항 (DistortionTerm 비트 플래그, 생성 후 불변)
+        const uint8_t terms;
+
+        // 생성 시 선택된 특수화 커널 (스칼라 1점 / SoA 배치 / 트랙 웜 스타트 / 보정 + 투영 / 역투영 + 왜곡)
+        using PointKernel = bool   (*)( const simd::KernelCoeffs&, double&, double&, int, double, double, size_t& );
+        using BatchKernel = size_t (*)( const simd::KernelCoeffs&, int, double, double, const float*, const float*, size_t,
+                                        float*, float*, uint64_t*, size_t& );
+        using TrackKernel = bool   (*)( const simd::KernelCoeffs&, TrackState&, double&, double&, int, double, double, size_t& );
+        using ProjectKernel = size_t (*)( const simd::KernelCoeffs&, const simd::HomographyCoeffs&, int, double, double,
+                                          const float*, const float*, size_t, float*, float*, uint8_t*, size_t& );
+        using UnprojectKernel = size_t (*)( const simd::KernelCoeffs&, const simd::HomographyCoeffs&,
+                                            const float*, const float*, size_t, float*, float*, uint8_t* );
+        PointKernel     point_kernel     = nullptr;
+        BatchKernel     batch_kernel     = nullptr;
+        TrackKernel     track_kernel     = nullptr;
+        ProjectKernel   project_kernel   = nullptr;
+        UnprojectKernel unproject_kernel = nullptr;
+        // 역왜곡 다항식 모델 (선택, 생성 시 한 번만 설정)
+        InverseDistortionModel inverse_model;
+        // 왜곡 보정 격자 (선택, 생성 시 한 번만 설정)
+        std::shared_ptr<const UndistortGrid> grid;
 
     public:
         // 비교 등에 사용될 내부 Epsilon 값
@@ -0,0 +1,644 @@
+#include "Calibrator.h"
+#include "CalibratorKernels.h"
+#include "UndistortGrid.h"
+#include "WorkerPool.h"
+
+// STL::C++
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    //--------------------------------------------------------------------------
+    // 함수: BatchBackendName
+    // 설명: 빌드 시 선택된 배치 연산 백엔드 이름을 반환합니다.
+    //--------------------------------------------------------------------------
+    const char* Calibrator::BatchBackendName() noexcept
+    {
+        return simd::BACKEND_NAME;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: UndistortSoA (파일 내부)
+    // 설명: 풀이 방식(SOLVER)과 활성 항(TERMS)이 고정된 배치 루프. 벡터 레인 단위로 처리한 뒤
+    //       벡터 폭으로 나누어 떨어지지 않는 나머지 포인트는 스칼라 레인으로 처리합니다.
+    //       (LANES는 64의 약수이므로 한 번의 결과가 마스크 워드 경계를 넘지 않음)
+    //--------------------------------------------------------------------------
+    template<UndistortSolver SOLVER, unsigned TERMS>
+    static size_t UndistortSoA( const simd::KernelCoeffs& kc, int max_iterations, double thr_x, double thr_y,
+                                const float* src_x, const float* src_y, size_t count,
+                                float* dst_x, float* dst_y, uint64_t* converged_mask, size_t& lane_iterations )
+    {
+        size_t converged_count = 0;
+        size_t i = 0;
+
+        constexpr size_t LANES = simd::VecD::LANES;
+        for( ; i + LANES <= count; i += LANES )
+        {
+            simd::VecD x = simd::VecD::LoadF( src_x + i );
+            simd::VecD y = simd::VecD::LoadF( src_y + i );
+
+            const auto mask = simd::UndistortLanes<SOLVER, TERMS>( kc, x, y, max_iterations, thr_x, thr_y, lane_iterations );
+
+            x.StoreF( dst_x + i );
+            y.StoreF( dst_y + i );
+
+            const unsigned bits = simd::MaskBits( mask );
+            converged_mask[ i >> 6 ] |= static_cast<uint64_t>( bits ) << ( i & 63 );
+            converged_count += static_cast<size_t>( __builtin_popcount( bits ) );
+        }
+
+        for( ; i < count; ++i )
+        {
+            simd::ScalarD x = simd::ScalarD::LoadF( src_x + i );
+            simd::ScalarD y = simd::ScalarD::LoadF( src_y + i );
+
+            const bool ok = simd::UndistortLanes<SOLVER, TERMS>( kc, x, y, max_iterations, thr_x, thr_y, lane_iterations );
+
+            x.StoreF( dst_x + i );
+            y.StoreF( dst_y + i );
+
+            if( ok ) {
+                converged_mask[ i >> 6 ] |= uint64_t { 1 } << ( i & 63 );
+                ++converged_count;
+            }
+        }
+        return converged_count;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ProjectSoA (파일 내부)
+    // 설명: UndistortSoA와 같은 레인 루프에서 보정 직후 호모그래피 곱과 원근 나눗셈까지 수행합니다.
+    //       보정 좌표는 레지스터에만 머물고 메모리에 쓰지 않습니다.
+    //--------------------------------------------------------------------------
+    template<UndistortSolver SOLVER, unsigned TERMS>
+    static size_t ProjectSoA( const simd::KernelCoeffs& kc, const simd::HomographyCoeffs& hc, int max_iterations,
+                              double thr_x, double thr_y, const float* src_x, const float* src_y, size_t count,
+                              float* dst_x, float* dst_y, uint8_t* status, size_t& lane_iterations )
+    {
+        size_t ok_count = 0;
+        size_t i = 0;
+
+        constexpr size_t LANES = simd::VecD::LANES;
+        for( ; i + LANES <= count; i += LANES )
+        {
+            simd::VecD x = simd::VecD::LoadF( src_x + i );
+            simd::VecD y = simd::VecD::LoadF( src_y + i );
+
+            const unsigned converged = simd::MaskBits( simd::UndistortLanes<SOLVER, TERMS>( kc, x, y, max_iterations, thr_x, thr_y, lane_iterations ) );
+
+            simd::VecD gx, gy;
+            const unsigned finite = simd::MaskBits( simd::HomographyLanes( hc, x, y, gx, gy ) );
+            gx.StoreF( dst_x + i );
+            gy.StoreF( dst_y + i );
+
+            for( size_t k = 0; k < LANES; ++k ) {
+                const bool c = ( ( converged >> k ) & 1u ) != 0;
+                const bool f = ( ( finite    >> k ) & 1u ) != 0;
+                status[ i + k ] = c ? ( f ? PROJECT_OK : PROJECT_AT_INFINITY ) : PROJECT_NOT_CONVERGED;
+                if( c == false ) {
+                    dst_x[ i + k ] = dst_y[ i + k ] = std::numeric_limits<float>::quiet_NaN();
+                }
+            }
+            ok_count += static_cast<size_t>( __builtin_popcount( converged & finite ) );
+        }
+
+        for( ; i < count; ++i )
+        {
+            simd::ScalarD x = simd::ScalarD::LoadF( src_x + i );
+            simd::ScalarD y = simd::ScalarD::LoadF( src_y + i );
+
+            const bool converged = simd::UndistortLanes<SOLVER, TERMS>( kc, x, y, max_iterations, thr_x, thr_y, lane_iterations );
+
+            simd::ScalarD gx, gy;
+            const bool finite = simd::HomographyLanes( hc, x, y, gx, gy );
+            gx.StoreF( dst_x + i );
+            gy.StoreF( dst_y + i );
+
+            status[ i ] = converged ? ( finite ? PROJECT_OK : PROJECT_AT_INFINITY ) : PROJECT_NOT_CONVERGED;
+            if( converged == false ) {
+                dst_x[ i ] = dst_y[ i ] = std::numeric_limits<float>::quiet_NaN();
+            }
+            ok_count += ( converged && finite ) ? 1 : 0;
+        }
+        return ok_count;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: HomographySoA (파일 내부)
+    // 설명: 이미 보정된 좌표(격자/항등 경로)에 호모그래피만 적용합니다.
+    //       status가 PROJECT_OK인 포인트만 투영하고, 나머지는 NaN으로 채웁니다.
+    //--------------------------------------------------------------------------
+    static size_t HomographySoA( const simd::HomographyCoeffs& hc, const float* src_x, const float* src_y, size_t count,
+                                 float* dst_x, float* dst_y, uint8_t* status )
+    {
+        size_t ok_count = 0;
+        for( size_t i = 0; i < count; ++i )
+        {
+            simd::ScalarD gx, gy;
+            const bool finite = simd::HomographyLanes( hc, simd::ScalarD::LoadF( src_x + i ), simd::ScalarD::LoadF( src_y + i ), gx, gy );
+            if( status[ i ] != PROJECT_OK ) {
+                dst_x[ i ] = dst_y[ i ] = std::numeric_limits<float>::quiet_NaN();
+                continue;
+            }
+            gx.StoreF( dst_x + i );
+            gy.StoreF( dst_y + i );
+            if( finite ) {
+                ++ok_count;
+            }
+            else {
+                status[ i ] = PROJECT_AT_INFINITY;
+            }
+        }
+        return ok_count;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: UnprojectSoA (파일 내부)
+    // 설명: 지상 좌표 -> 역호모그래피 -> 정규화 -> 왜곡 -> 역정규화를 한 레인 루프에서 수행합니다.
+    //       왜곡은 정방향 다항식이므로 반복이 없고, 결과 위치의 야코비안으로 접힘 여부를 검사합니다.
+    //--------------------------------------------------------------------------
+    template<class V, unsigned TERMS>
+    static inline unsigned UnprojectLanes( const simd::KernelCoeffs& kc, const simd::HomographyCoeffs& hinv,
+                                           const float* src_x, const float* src_y, float* dst_x, float* dst_y,
+                                           unsigned& finite_bits )
+    {
+        V ux, uy;
+        finite_bits = simd::MaskBits( simd::HomographyLanes( hinv, V::LoadF( src_x ), V::LoadF( src_y ), ux, uy ) );
+
+        V nx, ny, dx, dy, j00, j01, j11;
+        simd::NormalizeLanes<TERMS>( kc, ux, uy, nx, ny );
+        simd::DistortJacobianLanes<TERMS>( kc, nx, ny, dx, dy, j00, j01, j11 );
+
+        // 접히지 않은 영역: det J > 0 && j00 > 0 (CalibrateTrack의 웜 스타트 검사와 동일)
+        const auto unfolded = simd::MaskAnd( simd::Less( V::Set1( 0.0 ), j00 * j11 - j01 * j01 ), simd::Less( V::Set1( 0.0 ), j00 ) );
+
+        V px, py;
+        simd::DeNormalizeLanes<TERMS>( kc, dx, dy, px, py );
+        px.StoreF( dst_x );
+        py.StoreF( dst_y );
+        return simd::MaskBits( unfolded );
+    }
+
+    template<unsigned TERMS>
+    static size_t UnprojectSoA( const simd::KernelCoeffs& kc, const simd::HomographyCoeffs& hinv,
+                                const float* src_x, const float* src_y, size_t count,
+                                float* dst_x, float* dst_y, uint8_t* status )
+    {
+        const auto classify = [ & ]( size_t i, bool finite, bool unfolded ) -> size_t {
+            status[ i ] = finite ? ( unfolded ? PROJECT_OK : PROJECT_OUTSIDE_MODEL ) : PROJECT_AT_INFINITY;
+            if( status[ i ] != PROJECT_OK ) {
+                dst_x[ i ] = dst_y[ i ] = std::numeric_limits<float>::quiet_NaN();
+                return 0;
+            }
+            return 1;
+        };
+
+        size_t ok_count = 0;
+        size_t i = 0;
+
+        constexpr size_t LANES = simd::VecD::LANES;
+        for( ; i + LANES <= count; i += LANES )
+        {
+            unsigned finite = 0;
+            const unsigned unfolded = UnprojectLanes<simd::VecD, TERMS>( kc, hinv, src_x + i, src_y + i, dst_x + i, dst_y + i, finite );
+            for( size_t k = 0; k < LANES; ++k ) {
+                ok_count += classify( i + k, ( ( finite >> k ) & 1u ) != 0, ( ( unfolded >> k ) & 1u ) != 0 );
+            }
+        }
+
+        for( ; i < count; ++i )
+        {
+            unsigned finite = 0;
+            const unsigned unfolded = UnprojectLanes<simd::ScalarD, TERMS>( kc, hinv, src_x + i, src_y + i, dst_x + i, dst_y + i, finite );
+            ok_count += classify( i, finite != 0, unfolded != 0 );
+        }
+        return ok_count;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: UndistortPoint (파일 내부)
+    // 설명: UndistortSoA와 같은 특수화 커널을 스칼라 레인 하나로 실행합니다. (Calibrate 경로)
+    //--------------------------------------------------------------------------
+    template<UndistortSolver SOLVER, unsigned TERMS>
+    static bool UndistortPoint( const simd::KernelCoeffs& kc, double& x, double& y, int max_iterations,
+                                double thr_x, double thr_y, size_t& lane_iterations )
+    {
+        simd::ScalarD sx { x };
+        simd::ScalarD sy { y };
+        const bool ok = simd::UndistortLanes<SOLVER, TERMS>( kc, sx, sy, max_iterations, thr_x, thr_y, lane_iterations );
+        x = sx.v;
+        y = sy.v;
+        return ok;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: UndistortTrackPoint (파일 내부)
+    // 설명: 역모델(있으면) -> 트랙 상태로부터 외삽한 초기값으로 반복 -> 콜드 스타트 순으로 보정합니다.
+    //       콜드 스타트는 UndistortPoint와 동일합니다.
+    //       성공하면 해와 그 위치의 역야코비안을 상태에 저장합니다.
+    //--------------------------------------------------------------------------
+    template<UndistortSolver SOLVER, unsigned TERMS>
+    static bool UndistortTrackPoint( const simd::KernelCoeffs& kc, TrackState& st, double& x, double& y,
+                                     int max_iterations, double thr_x, double thr_y, size_t& lane_iterations )
+    {
+        using simd::ScalarD;
+
+        ScalarD tx, ty;
+        simd::NormalizeLanes<TERMS>( kc, ScalarD { x }, ScalarD { y }, tx, ty );
+
+        ScalarD ux, uy;
+        bool ok = false;
+
+        // 1. 역모델이 있으면 먼저 시도 (통과하면 반복 0회이므로 웜 스타트보다 우선)
+        if( kc.inv_enabled ) {
+            ok = simd::InverseLanes<TERMS>( kc, tx, ty, ux, uy, thr_x, thr_y );
+        }
+
+        // 2. 웜 스타트: u_prev + J^-1 * (d - d_prev)
+        //    수렴하더라도 야코비안 행렬식이 양수가 아니면(왜곡 모델이 접히는 반대쪽 해) 버리고 콜드 스타트
+        if( ok == false && st.has_prev ) {
+            const double ex = tx.v - st.prev_dx;
+            const double ey = ty.v - st.prev_dy;
+            ux.v = st.prev_ux + st.inv_j00 * ex + st.inv_j01 * ey;
+            uy.v = st.prev_uy + st.inv_j01 * ex + st.inv_j11 * ey;
+            ok = simd::IterateLanes<SOLVER, TERMS>( kc, tx, ty, ux, uy, true, max_iterations, thr_x, thr_y, lane_iterations );
+            if( ok ) {
+                ScalarD dx, dy, j00, j01, j11;
+                simd::DistortJacobianLanes<TERMS>( kc, ux, uy, dx, dy, j00, j01, j11 );
+                ok = ( j00.v * j11.v - j01.v * j01.v ) > 0.0 && j00.v > 0.0;
+            }
+            ++st.warm_starts;
+            if( ok == false ) {
+                ++st.cold_restarts;
+            }
+        }
+
+        // 3. 콜드 스타트 (직전 해가 없거나 웜 스타트 실패)
+        if( ok == false ) {
+            ScalarD px { x }, py { y };
+            ok = simd::UndistortLanes<SOLVER, TERMS>( kc, px, py, max_iterations, thr_x, thr_y, lane_iterations );
+            if( ok ) {
+                simd::NormalizeLanes<TERMS>( kc, px, py, ux, uy );
+            }
+        }
+
+        if( ok == false ) {
+            st.has_prev = false;
+            return false;
+        }
+
+        // 4. 다음 포인트를 위해 해와 역야코비안 저장 (특이에 가까우면 단위 행렬)
+        ScalarD dx, dy, j00, j01, j11;
+        simd::DistortJacobianLanes<TERMS>( kc, ux, uy, dx, dy, j00, j01, j11 );
+        const double det = j00.v * j11.v - j01.v * j01.v;
+        if( std::abs( det ) > Calibrator::CALIBRATE_INTERNAL_EPSILON ) {
+            st.inv_j00 =  j11.v / det;
+            st.inv_j01 = -j01.v / det;
+            st.inv_j11 =  j00.v / det;
+        }
+        else {
+            st.inv_j00 = 1.0;
+            st.inv_j01 = 0.0;
+            st.inv_j11 = 1.0;
+        }
+        st.has_prev = true;
+        st.prev_dx  = tx.v;
+        st.prev_dy  = ty.v;
+        st.prev_ux  = ux.v;
+        st.prev_uy  = uy.v;
+
+        ScalarD px, py;
+        simd::DeNormalizeLanes<TERMS>( kc, ux, uy, px, py );
+        x = px.v;
+        y = py.v;
+        return true;
+    }
+
+    // 활성 항 조합(0 ~ TERM_ALL)별 커널 인스턴스 테이블
+    using PointKernelFn = bool   (*)( const simd::KernelCoeffs&, double&, double&, int, double, double, size_t& );
+    using BatchKernelFn = size_t (*)( const simd::KernelCoeffs&, int, double, double, const float*, const float*, size_t,
+                                      float*, float*, uint64_t*, size_t& );
+    using TrackKernelFn = bool   (*)( const simd::KernelCoeffs&, TrackState&, double&, double&, int, double, double, size_t& );
+    using ProjectKernelFn = size_t (*)( const simd::KernelCoeffs&, const simd::HomographyCoeffs&, int, double, double,
+                                        const float*, const float*, size_t, float*, float*, uint8_t*, size_t& );
+
+    template<UndistortSolver SOLVER, size_t... TERMS>
+    static constexpr std::array<PointKernelFn, sizeof...( TERMS )> MakePointTable( std::index_sequence<TERMS...> )
+    {
+        return { { &UndistortPoint<SOLVER, static_cast<unsigned>( TERMS )>... } };
+    }
+
+    template<UndistortSolver SOLVER, size_t... TERMS>
+    static constexpr std::array<BatchKernelFn, sizeof...( TERMS )> MakeBatchTable( std::index_sequence<TERMS...> )
+    {
+        return { { &UndistortSoA<SOLVER, static_cast<unsigned>( TERMS )>... } };
+    }
+
+    template<UndistortSolver SOLVER, size_t... TERMS>
+    static constexpr std::array<TrackKernelFn, sizeof...( TERMS )> MakeTrackTable( std::index_sequence<TERMS...> )
+    {
+        return { { &UndistortTrackPoint<SOLVER, static_cast<unsigned>( TERMS )>... } };
+    }
+
+    template<UndistortSolver SOLVER, size_t... TERMS>
+    static constexpr std::array<ProjectKernelFn, sizeof...( TERMS )> MakeProjectTable( std::index_sequence<TERMS...> )
+    {
+        return { { &ProjectSoA<SOLVER, static_cast<unsigned>( TERMS )>... } };
+    }
+
+    using UnprojectKernelFn = size_t (*)( const simd::KernelCoeffs&, const simd::HomographyCoeffs&,
+                                          const float*, const float*, size_t, float*, float*, uint8_t* );
+
+    template<size_t... TERMS>
+    static constexpr std::array<UnprojectKernelFn, sizeof...( TERMS )> MakeUnprojectTable( std::index_sequence<TERMS...> )
+    {
+        return { { &UnprojectSoA<static_cast<unsigned>( TERMS )>... } };
+    }
+
+    using TermIndices = std::make_index_sequence<TERM_ALL + 1>;
+
+    //--------------------------------------------------------------------------
+    // 함수: SelectKernels
+    // 설명: 생성 시 한 번, 0이 아닌 항(terms)과 풀이 방식에 맞는 커널 인스턴스를 고릅니다.
+    //       예) k3 = p1 = p2 = skew = 0 이면 r^6/접선/skew 연산이 없는 커널이 선택됩니다.
+    //--------------------------------------------------------------------------
+    void Calibrator::SelectKernels() noexcept
+    {
+        static constexpr auto POINT_NEWTON = MakePointTable<UndistortSolver::Newton>( TermIndices {} );
+        static constexpr auto POINT_FIXED  = MakePointTable<UndistortSolver::FixedPoint>( TermIndices {} );
+        static constexpr auto BATCH_NEWTON = MakeBatchTable<UndistortSolver::Newton>( TermIndices {} );
+        static constexpr auto BATCH_FIXED  = MakeBatchTable<UndistortSolver::FixedPoint>( TermIndices {} );
+        static constexpr auto TRACK_NEWTON = MakeTrackTable<UndistortSolver::Newton>( TermIndices {} );
+        static constexpr auto TRACK_FIXED  = MakeTrackTable<UndistortSolver::FixedPoint>( TermIndices {} );
+        static constexpr auto PROJECT_NEWTON = MakeProjectTable<UndistortSolver::Newton>( TermIndices {} );
+        static constexpr auto PROJECT_FIXED  = MakeProjectTable<UndistortSolver::FixedPoint>( TermIndices {} );
+        static constexpr auto UNPROJECT      = MakeUnprojectTable( TermIndices {} );
+
+        const size_t index = terms & TERM_ALL;
+        const bool   newton = ( opts.solver == UndistortSolver::Newton );
+        point_kernel = newton ? POINT_NEWTON[ index ] : POINT_FIXED[ index ];
+        batch_kernel = newton ? BATCH_NEWTON[ index ] : BATCH_FIXED[ index ];
+        track_kernel = newton ? TRACK_NEWTON[ index ] : TRACK_FIXED[ index ];
+        project_kernel = newton ? PROJECT_NEWTON[ index ] : PROJECT_FIXED[ index ];
+        unproject_kernel = UNPROJECT[ index ];
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: SolveBatch
+    // 설명: 생성 시 선택된 배치 커널을 실행합니다. (격자 미사용, 역모델이 있으면 커널에서 먼저 사용)
+    //--------------------------------------------------------------------------
+    size_t Calibrator::SolveBatch( const float* src_x, const float* src_y, size_t count,
+                                   float* dst_x, float* dst_y, uint64_t* converged_mask,
+                                   const cv::Point2f& err_threshold, size_t& lane_iterations ) const
+    {
+        const simd::KernelCoeffs kc = simd::MakeCoeffs( c_info, &inverse_model );
+        return batch_kernel( kc, opts.max_iterations, err_threshold.x, err_threshold.y,
+                             src_x, src_y, count, dst_x, dst_y, converged_mask, lane_iterations );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: CalibrateBatch
+    // 설명: SoA 형태로 입력된 포인트들을 벡터 레인 단위로 묶어 왜곡 보정합니다.
+    //       격자가 있으면 먼저 격자 보간을 시도하고, 실패한 포인트만 모아서 반복 풀이합니다.
+    //       각 포인트의 수렴 여부는 converged_mask 비트로 기록됩니다.
+    //--------------------------------------------------------------------------
+    size_t Calibrator::CalibrateBatch( const float* src_x, const float* src_y, size_t count,
+                                       float* dst_x, float* dst_y, uint64_t* converged_mask,
+                                       const cv::Point2f& err_threshold, size_t* total_iterations ) const
+    {
+        if( total_iterations != nullptr ) {
+            *total_iterations = 0;
+        }
+        if( count == 0 ) {
+            return 0;
+        }
+
+        // 1. 수렴 비트마스크 초기화
+        std::fill_n( converged_mask, MaskWords( count ), uint64_t { 0 } );
+
+        // 2. 객체 유효성 검사: 유효하지 않으면 입력값을 그대로 출력하고 수렴 0개
+        if( is_valid == false ) {
+            std::copy_n( src_x, count, dst_x );
+            std::copy_n( src_y, count, dst_y );
+            return 0;
+        }
+
+        // 3. 왜곡 계수가 모두 0이면 항등 변환: 입력을 그대로 복사하고 전부 수렴 처리
+        if( isIdentity() ) {
+            if( dst_x != src_x ) {
+                std::copy_n( src_x, count, dst_x );
+            }
+            if( dst_y != src_y ) {
+                std::copy_n( src_y, count, dst_y );
+            }
+            std::fill_n( converged_mask, count >> 6, ~uint64_t { 0 } );
+            if( ( count & 63 ) != 0 ) {
+                converged_mask[ count >> 6 ] = ( uint64_t { 1 } << ( count & 63 ) ) - 1;
+            }
+            return count;
+        }
+
+        size_t lane_iterations = 0;
+        size_t converged_count = 0;
+
+        // 4-A. 격자 미사용 (또는 격자 보간 오차가 err_threshold보다 큼): 전체를 반복 풀이
+        if( !grid || grid->Accepts( err_threshold ) == false ) {
+            converged_count = SolveBatch( src_x, src_y, count, dst_x, dst_y, converged_mask, err_threshold, lane_iterations );
+        }
+        // 4-B. 격자 사용: 보간에 실패한 포인트만 모아서(gather) 반복 풀이 후 되돌려 씀(scatter)
+        else {
+            std::vector<size_t> miss_index;
+            std::vector<float>  miss_x, miss_y;
+            for( size_t i = 0; i < count; ++i ) {
+                cv::Point2f approx;
+                if( grid->Lookup( src_x[ i ], src_y[ i ], approx ) ) {
+                    dst_x[ i ] = approx.x;
+                    dst_y[ i ] = approx.y;
+                    converged_mask[ i >> 6 ] |= uint64_t { 1 } << ( i & 63 );
+                    ++converged_count;
+                }
+                else {
+                    miss_index.push_back( i );
+                    miss_x.push_back( src_x[ i ] );
+                    miss_y.push_back( src_y[ i ] );
+                }
+            }
+
+            if( miss_index.empty() == false ) {
+                const size_t misses = miss_index.size();
+                std::vector<uint64_t> miss_mask( MaskWords( misses ), 0 );
+                converged_count += SolveBatch( miss_x.data(), miss_y.data(), misses, miss_x.data(), miss_y.data(),
+                                               miss_mask.data(), err_threshold, lane_iterations );
+                for( size_t k = 0; k < misses; ++k ) {
+                    const size_t i = miss_index[ k ];
+                    dst_x[ i ] = miss_x[ k ];
+                    dst_y[ i ] = miss_y[ k ];
+                    if( ( miss_mask[ k >> 6 ] >> ( k & 63 ) ) & 1u ) {
+                        converged_mask[ i >> 6 ] |= uint64_t { 1 } << ( i & 63 );
+                    }
+                }
+            }
+        }
+
+        if( total_iterations != nullptr ) {
+            *total_iterations = lane_iterations;
+        }
+        return converged_count;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: CalibrateBatchParallel
+    // 설명: 입력을 64의 배수 크기 청크로 나누어 워커 풀에서 CalibrateBatch를 실행합니다.
+    //       청크 경계가 마스크 워드 경계와 일치하므로 청크 간 쓰기 충돌이 없고 결과 순서가 고정됩니다.
+    //--------------------------------------------------------------------------
+    size_t Calibrator::CalibrateBatchParallel( const float* src_x, const float* src_y, size_t count,
+                                               float* dst_x, float* dst_y, uint64_t* converged_mask,
+                                               const cv::Point2f& err_threshold, size_t* total_iterations,
+                                               MGEN::WorkerPool* pool ) const
+    {
+        static_assert( PARALLEL_CHUNK_POINTS % 64 == 0, "chunk must align with mask words" );
+
+        MGEN::WorkerPool& workers = ( pool != nullptr ) ? *pool : MGEN::WorkerPool::Shared();
+
+        std::atomic<size_t> converged_count { 0 };
+        std::atomic<size_t> iterations      { 0 };
+
+        workers.ParallelFor( count, PARALLEL_CHUNK_POINTS, [ & ]( size_t begin, size_t end ) {
+            size_t chunk_iterations = 0;
+            const size_t chunk_converged = CalibrateBatch( src_x + begin, src_y + begin, end - begin,
+                                                           dst_x + begin, dst_y + begin, converged_mask + ( begin >> 6 ),
+                                                           err_threshold, &chunk_iterations );
+            converged_count.fetch_add( chunk_converged, std::memory_order_relaxed );
+            iterations.fetch_add( chunk_iterations, std::memory_order_relaxed );
+        } );
+
+        if( total_iterations != nullptr ) {
+            *total_iterations = iterations.load( std::memory_order_relaxed );
+        }
+        return converged_count.load( std::memory_order_relaxed );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ProjectBatch
+    // 설명: 왜곡 보정 + 호모그래피 투영을 한 번에 수행합니다.
+    //       격자/항등 경로가 없으면 융합 커널(ProjectSoA) 하나로 끝나고,
+    //       있으면 CalibrateBatch 결과에 호모그래피만 적용합니다.
+    //--------------------------------------------------------------------------
+    size_t Calibrator::ProjectBatch( const float* src_x, const float* src_y, size_t count, const cv::Matx33d& homography,
+                                     float* dst_x, float* dst_y, uint8_t* status,
+                                     const cv::Point2f& err_threshold, size_t* total_iterations ) const
+    {
+        if( total_iterations != nullptr ) {
+            *total_iterations = 0;
+        }
+        if( count == 0 ) {
+            return 0;
+        }
+
+        // 1. 객체 유효성 검사
+        if( is_valid == false ) {
+            std::fill_n( dst_x, count, std::numeric_limits<float>::quiet_NaN() );
+            std::fill_n( dst_y, count, std::numeric_limits<float>::quiet_NaN() );
+            std::fill_n( status, count, static_cast<uint8_t>( PROJECT_INVALID ) );
+            return 0;
+        }
+
+        const simd::HomographyCoeffs hc = simd::MakeHomography( homography );
+
+        // 2. 융합 커널: 보정 좌표를 메모리에 쓰지 않음
+        if( isIdentity() == false && ( !grid || grid->Accepts( err_threshold ) == false ) ) {
+            const simd::KernelCoeffs kc = simd::MakeCoeffs( c_info, &inverse_model );
+            size_t lane_iterations = 0;
+            const size_t ok_count = project_kernel( kc, hc, opts.max_iterations, err_threshold.x, err_threshold.y,
+                                                    src_x, src_y, count, dst_x, dst_y, status, lane_iterations );
+            if( total_iterations != nullptr ) {
+                *total_iterations = lane_iterations;
+            }
+            return ok_count;
+        }
+
+        // 3. 격자/항등 경로: CalibrateBatch(격자 보간 + 미스만 반복 풀이) 후 호모그래피 적용
+        std::vector<uint64_t> converged_mask( MaskWords( count ) );
+        CalibrateBatch( src_x, src_y, count, dst_x, dst_y, converged_mask.data(), err_threshold, total_iterations );
+        for( size_t i = 0; i < count; ++i ) {
+            status[ i ] = ( ( converged_mask[ i >> 6 ] >> ( i & 63 ) ) & 1u ) ? PROJECT_OK : PROJECT_NOT_CONVERGED;
+        }
+        return HomographySoA( hc, dst_x, dst_y, count, dst_x, dst_y, status );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ProjectBatchParallel
+    // 설명: ProjectBatch를 청크 단위로 워커 풀에서 실행합니다. (청크 간 출력 구간이 겹치지 않음)
+    //--------------------------------------------------------------------------
+    size_t Calibrator::ProjectBatchParallel( const float* src_x, const float* src_y, size_t count, const cv::Matx33d& homography,
+                                             float* dst_x, float* dst_y, uint8_t* status,
+                                             const cv::Point2f& err_threshold, size_t* total_iterations,
+                                             MGEN::WorkerPool* pool ) const
+    {
+        MGEN::WorkerPool& workers = ( pool != nullptr ) ? *pool : MGEN::WorkerPool::Shared();
+
+        std::atomic<size_t> ok_count   { 0 };
+        std::atomic<size_t> iterations { 0 };
+
+        workers.ParallelFor( count, PARALLEL_CHUNK_POINTS, [ & ]( size_t begin, size_t end ) {
+            size_t chunk_iterations = 0;
+            const size_t chunk_ok = ProjectBatch( src_x + begin, src_y + begin, end - begin, homography,
+                                                  dst_x + begin, dst_y + begin, status + begin,
+                                                  err_threshold, &chunk_iterations );
+            ok_count.fetch_add( chunk_ok, std::memory_order_relaxed );
+            iterations.fetch_add( chunk_iterations, std::memory_order_relaxed );
+        } );
+
+        if( total_iterations != nullptr ) {
+            *total_iterations = iterations.load( std::memory_order_relaxed );
+        }
+        return ok_count.load( std::memory_order_relaxed );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: UnprojectBatch
+    // 설명: 지상 좌표를 왜곡된 픽셀 좌표로 역투영합니다. (반복 없는 융합 커널, 격자/역모델 미사용)
+    //--------------------------------------------------------------------------
+    size_t Calibrator::UnprojectBatch( const float* src_x, const float* src_y, size_t count, const cv::Matx33d& inverse_homography,
+                                       float* dst_x, float* dst_y, uint8_t* status ) const
+    {
+        if( count == 0 ) {
+            return 0;
+        }
+        if( is_valid == false ) {
+            std::fill_n( dst_x, count, std::numeric_limits<float>::quiet_NaN() );
+            std::fill_n( dst_y, count, std::numeric_limits<float>::quiet_NaN() );
+            std::fill_n( status, count, static_cast<uint8_t>( PROJECT_INVALID ) );
+            return 0;
+        }
+
+        const simd::KernelCoeffs     kc   = simd::MakeCoeffs( c_info );
+        const simd::HomographyCoeffs hinv = simd::MakeHomography( inverse_homography );
+        return unproject_kernel( kc, hinv, src_x, src_y, count, dst_x, dst_y, status );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: UnprojectBatchParallel
+    // 설명: UnprojectBatch를 청크 단위로 워커 풀에서 실행합니다.
+    //--------------------------------------------------------------------------
+    size_t Calibrator::UnprojectBatchParallel( const float* src_x, const float* src_y, size_t count, const cv::Matx33d& inverse_homography,
+                                               float* dst_x, float* dst_y, uint8_t* status, MGEN::WorkerPool* pool ) const
+    {
+        MGEN::WorkerPool& workers = ( pool != nullptr ) ? *pool : MGEN::WorkerPool::Shared();
+
+        std::atomic<size_t> ok_count { 0 };
+        workers.ParallelFor( count, PARALLEL_CHUNK_POINTS, [ & ]( size_t begin, size_t end ) {
+            ok_count.fetch_add( UnprojectBatch( src_x + begin, src_y + begin, end - begin, inverse_homography,
+                                                dst_x + begin, dst_y + begin, status + begin ),
+                                std::memory_order_relaxed );
+        } );
+        return ok_count.load( std::memory_order_relaxed );
+    }
+
+} // nsp::MGEN::MVEM
@@ -0,0 +1,105 @@
+#include "CalibratorCache.h"
+#include "MgenLogger.h"
+
+// JSON
+#include "json/json.hpp"
+
+// STL::C++
+#include <functional>
+#include <string>
+#include <utility>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    //--------------------------------------------------------------------------
+    // 함수: HashOptions / SameOptions / SameParams (파일 내부)
+    // 설명: 캐시 키에 옵션을 결합하고, 적중 시 충돌 여부를 확인합니다.
+    //--------------------------------------------------------------------------
+    static uint64_t HashOptions( uint64_t seed, const CalibratorOptions& o ) noexcept
+    {
+        const uint64_t parts[] = {
+            static_cast<uint64_t>( o.solver ), static_cast<uint64_t>( o.max_iterations ),
+            static_cast<uint64_t>( o.image_width ), static_cast<uint64_t>( o.image_height ),
+            static_cast<uint64_t>( o.inverse_model.enable ), std::hash<double> {}( o.inverse_model.tolerance_px ),
+            static_cast<uint64_t>( o.grid.enable ), static_cast<uint64_t>( o.grid.cell ),
+            static_cast<uint64_t>( std::hash<std::string> {}( o.grid.cache_dir ) ),
+        };
+        uint64_t hash = seed;
+        for( uint64_t v : parts ) {
+            hash ^= v + 0x9E3779B97F4A7C15ULL + ( hash << 6 ) + ( hash >> 2 );
+        }
+        return hash;
+    }
+
+    static bool SameOptions( const CalibratorOptions& a, const CalibratorOptions& b ) noexcept
+    {
+        return a.solver == b.solver && a.max_iterations == b.max_iterations
+            && a.image_width == b.image_width && a.image_height == b.image_height
+            && a.inverse_model.enable == b.inverse_model.enable && a.inverse_model.tolerance_px == b.inverse_model.tolerance_px
+            && a.grid.enable == b.grid.enable && a.grid.cell == b.grid.cell && a.grid.cache_dir == b.grid.cache_dir;
+    }
+
+    static bool SameParams( const CalibratorParams& a, const CalibratorParams& b ) noexcept
+    {
+        for( const CalibratorParamKey& key : CALIBRATOR_PARAM_KEYS ) {
+            if( a.*key.member != b.*key.member ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    CalibratorCache::CalibratorCache( size_t capacity )
+        : cache( capacity )
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Acquire
+    // 설명: 파라미터/옵션 해시로 캐시를 조회하고, 없으면 Calibrator를 생성하여 저장합니다.
+    //       같은 키의 동시 미스는 SingleFlight로 합쳐 한 번만 생성합니다. (격자/역모델 준비 비용)
+    //--------------------------------------------------------------------------
+    std::shared_ptr<const Calibrator> CalibratorCache::Acquire( const nlohmann::json& js, std::string* error )
+    {
+        // 1. 단일 패스 파싱 (유효성 검사 포함). 실패하면 모든 문제를 한 번에 보고
+        CalibratorParams params {};
+        std::string problems;
+        if( Calibrator::ParseParams( js, params, &problems ) == false ) {
+            MLOG_WARN("CalibratorCache: invalid calibration JSON: %s", problems.c_str());
+            if( error != nullptr ) {
+                *error = std::move( problems );
+            }
+            return nullptr;
+        }
+        const CalibratorOptions options = Calibrator::ParseOptions( js );
+        const uint64_t key = HashOptions( HashCalibratorParams( params ), options );
+
+        // 2. 캐시 적중: 충돌이 아닌지 확인 후 반환
+        if( auto hit = cache.get( key ) ) {
+            const auto& calibrator = *hit;
+            if( SameParams( calibrator->getParams(), params ) && SameOptions( calibrator->getOptions(), options ) ) {
+                return calibrator;
+            }
+            MLOG_WARN("CalibratorCache: hash collision on key %016llx. Creating an uncached instance.", static_cast<unsigned long long>( key ));
+            return std::make_shared<const Calibrator>( params, options );
+        }
+
+        // 3. 캐시 미스: 이미 파싱한 값으로 생성 (JSON 재순회 없음)
+        //    같은 키를 동시에 놓친 호출은 리더가 만든 인스턴스를 함께 받음
+        auto created = inflight.Do( key, [&]() -> std::shared_ptr<const Calibrator> {
+            if( auto raced = cache.get( key ) ) { // 직전 리더가 방금 저장한 경우
+                return *raced;
+            }
+            auto instance = std::make_shared<const Calibrator>( params, options );
+            cache.put( key, instance );
+            MLOG_INFO("CalibratorCache: new Calibrator cached (key %016llx).", static_cast<unsigned long long>( key ));
+            return instance;
+        } );
+        if( SameParams( created->getParams(), params ) && SameOptions( created->getOptions(), options ) ) {
+            return created;
+        }
+        MLOG_WARN("CalibratorCache: hash collision on key %016llx. Creating an uncached instance.", static_cast<unsigned long long>( key ));
+        return std::make_shared<const Calibrator>( params, options );
+    }
+
+} // nsp::MGEN::MVEM
@@ -0,0 +1,76 @@
+#ifndef _MGEN_MVEM_CALIBRATOR_CACHE_H_
+#define _MGEN_MVEM_CALIBRATOR_CACHE_H_
+
+/* ====================================
+ * Calibrator Instance Cache Class Header
+ * ------------------------------------
+ * Desc   : 캘리브레이션 파라미터 해시를 키로 불변(immutable) Calibrator 객체를 공유하는 LRU 캐시.
+ * 같은 카메라 파라미터로 반복되는 요청은 Calibrator 생성(격자 등 파생 테이블 포함)을 건너뛰고
+ * 캐시된 인스턴스를 그대로 사용합니다. (키를 만들기 위한 파라미터 파싱은 매번 수행)
+ * ==================================== */
+
+#include "Calibrator.h"
+#include "LruCache.h"
+#include "SingleFlight.h"
+
+// JSON Forward Declaration
+#include "json/json_fwd.hpp"
+
+// STL
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    /**
+     * @brief 공유 가능한 Calibrator 인스턴스 캐시.
+     * 키는 10개 파라미터의 정규화 해시(HashCalibratorParams)와 CalibratorOptions를 결합한 값이며,
+     * 해시 충돌에 대비하여 캐시 적중 시 실제 파라미터/옵션이 같은지 다시 확인합니다.
+     * 적중하더라도 키를 만들기 위해 설정 JSON의 파라미터/옵션은 매번 한 번 파싱하며, 건너뛰는 것은 Calibrator 생성
+     * (커널 선택, 격자/역모델 준비)입니다. 같은 키의 동시 미스는 하나로 합쳐 한 번만 생성합니다.
+     * 여러 스레드에서 동시에 호출할 수 있습니다.
+     */
+    class CalibratorCache
+    {
+    public:
+        using Stats = MGEN::LruCache<uint64_t, std::shared_ptr<const Calibrator>>::Stats;
+
+        /** 기본 최대 캐시 항목 수 */
+        static constexpr size_t DEFAULT_CAPACITY = 64;
+
+        /**
+         * @param capacity 최대 캐시 항목 수 (LRU로 제거).
+         */
+        explicit CalibratorCache( size_t capacity = DEFAULT_CAPACITY );
+
+        CalibratorCache( const CalibratorCache& ) = delete;
+        CalibratorCache& operator=( const CalibratorCache& ) = delete;
+
+        /**
+         * @brief 설정 JSON에 해당하는 Calibrator를 캐시에서 찾거나 새로 생성하여 반환합니다.
+         * 설정의 "UndistortOptions"도 키에 포함됩니다.
+         * @param json Calibrator 생성에 사용하는 설정 JSON ({ "CalibrationInfo": {...} }).
+         * @param error (선택) 설정이 유효하지 않을 때 발견한 모든 문제를 받을 문자열.
+         * @return 유효한 Calibrator. 설정이 유효하지 않으면 nullptr (캐시에 저장하지 않음).
+         */
+        std::shared_ptr<const Calibrator> Acquire( const nlohmann::json& json, std::string* error = nullptr );
+
+        /**
+         * @brief 캐시 통계 (적중/실패/제거 횟수, 현재 크기)를 반환합니다.
+         */
+        Stats getStats() const { return cache.stats(); }
+
+        /**
+         * @brief 동시 미스 병합 통계 (생성한 횟수, 다른 호출의 생성 결과를 기다린 횟수).
+         */
+        MGEN::SingleFlight<uint64_t, std::shared_ptr<const Calibrator>>::Stats getFlightStats() const { return inflight.stats(); }
+
+    private:
+        MGEN::LruCache<uint64_t, std::shared_ptr<const Calibrator>> cache;
+        MGEN::SingleFlight<uint64_t, std::shared_ptr<const Calibrator>> inflight; // 같은 키의 동시 생성 병합
+    }; // cls::CalibratorCache
+
+} // nsp::MGEN::MVEM
+
+#endif // _MGEN_MVEM_CALIBRATOR_CACHE_H_
@@ -0,0 +1,496 @@
+#ifndef _MGEN_MVEM_CALIBRATOR_KERNELS_H_
+#define _MGEN_MVEM_CALIBRATOR_KERNELS_H_
+
+/* ====================================
+ * Calibrator SIMD Kernel Header (Internal)
+ * ------------------------------------
+ * Desc   : Calibrator 배치 연산에서 사용하는 SIMD 벡터 래퍼와 왜곡/보정 커널.
+ * 컴파일 시점의 명령어 집합(__AVX512F__ / __AVX2__)에 따라 벡터 타입이 결정되며,
+ * 커널은 벡터 타입에 대한 템플릿으로 한 번만 작성되어 스칼라 경로와 공유됩니다.
+ * 주의: Calibrator 계열 및 호모그래피 추정/평가(HomographyRansac, HomographyMetrics) 구현 파일(.cpp)에서만 포함하는 내부 헤더입니다.
+ * ==================================== */
+
+#include "Calibrator.h"
+
+// SIMD Intrinsics
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// STL
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace MGEN::MVEM::simd
+{
+    /**
+     * @brief 커널에서 사용하는 캘리브레이션 계수 묶음.
+     * 나눗셈을 곱셈으로 바꾸기 위해 초점 거리의 역수를 미리 계산해 둡니다.
+     */
+    struct KernelCoeffs
+    {
+        double fx, fy, cx, cy, skew;
+        double k1, k2, k3, p1, p2;
+        double inv_fx, inv_fy;
+
+        // 역왜곡 다항식 모델 (inv_enabled == false면 사용 안 함)
+        bool   inv_enabled;
+        double inv_r2_max, inv_tolerance;
+        double ia1, ia2, ia3, ia4, iq1, iq2;
+    };
+
+    /** CalibratorParams(및 선택적 역모델)로부터 KernelCoeffs 생성 (fx, fy가 0이 아님을 가정) */
+    inline KernelCoeffs MakeCoeffs( const CalibratorParams& p, const InverseDistortionModel* inv = nullptr ) noexcept
+    {
+        const bool use_inv = ( inv != nullptr && inv->valid );
+        return KernelCoeffs {
+            p.fx, p.fy, p.cx, p.cy, p.skew,
+            p.k1, p.k2, p.k3, p.p1, p.p2,
+            1.0 / p.fx, 1.0 / p.fy,
+            use_inv,
+            use_inv ? inv->r2_max    : 0.0,
+            use_inv ? inv->tolerance : 0.0,
+            use_inv ? inv->a1 : 0.0, use_inv ? inv->a2 : 0.0, use_inv ? inv->a3 : 0.0, use_inv ? inv->a4 : 0.0,
+            use_inv ? inv->q1 : 0.0, use_inv ? inv->q2 : 0.0
+        };
+    }
+
+    /**
+     * @brief 호모그래피 행렬 H (3x3, 행 우선) 계수. 투영 커널에서 사용합니다.
+     */
+    struct HomographyCoeffs
+    {
+        double h00, h01, h02;
+        double h10, h11, h12;
+        double h20, h21, h22;
+    };
+
+    /** cv::Matx33d로부터 HomographyCoeffs 생성 */
+    inline HomographyCoeffs MakeHomography( const cv::Matx33d& H ) noexcept
+    {
+        return HomographyCoeffs {
+            H( 0, 0 ), H( 0, 1 ), H( 0, 2 ),
+            H( 1, 0 ), H( 1, 1 ), H( 1, 2 ),
+            H( 2, 0 ), H( 2, 1 ), H( 2, 2 )
+        };
+    }
+
+    /* ------------------------------------------------------------------------
+     | 스칼라 레인 (1 lane) : SIMD 미지원 빌드 및 배치 꼬리(tail) 처리에 사용
+     +------------------------------------------------------------------------ */
+    struct ScalarD
+    {
+        using Mask = bool;
+        static constexpr size_t LANES = 1;
+
+        double v;
+
+        static ScalarD Set1( double a )         noexcept { return { a }; }
+        static ScalarD LoadF( const float* p )  noexcept { return { static_cast<double>( *p ) }; }
+        void           StoreF( float* p ) const noexcept { *p = static_cast<float>( v ); }
+        static Mask    AllTrue()                noexcept { return true; }
+        static Mask    NoneTrue()               noexcept { return false; }
+    };
+
+    inline ScalarD operator+( ScalarD a, ScalarD b ) noexcept { return { a.v + b.v }; }
+    inline ScalarD operator-( ScalarD a, ScalarD b ) noexcept { return { a.v - b.v }; }
+    inline ScalarD operator*( ScalarD a, ScalarD b ) noexcept { return { a.v * b.v }; }
+    inline ScalarD operator/( ScalarD a, ScalarD b ) noexcept { return { a.v / b.v }; }
+    inline ScalarD Abs( ScalarD a )                  noexcept { return { std::fabs( a.v ) }; }
+    inline ScalarD Sqrt( ScalarD a )                 noexcept { return { std::sqrt( a.v ) }; }
+    inline bool    Less( ScalarD a, ScalarD b )      noexcept { return a.v < b.v; }
+    inline ScalarD Select( bool m, ScalarD t, ScalarD f ) noexcept { return m ? t : f; }
+    inline bool    MaskAnd( bool a, bool b )         noexcept { return a && b; }
+    inline bool    MaskOr( bool a, bool b )          noexcept { return a || b; }
+    inline bool    MaskAndNot( bool a, bool b )      noexcept { return a && !b; }
+    inline bool    MaskAny( bool m )                 noexcept { return m; }
+    inline unsigned MaskBits( bool m )               noexcept { return m ? 1u : 0u; }
+
+#if defined(__AVX512F__)
+    /* ------------------------------------------------------------------------
+     | AVX-512 (8 lanes, double)
+     +------------------------------------------------------------------------ */
+    struct VecD
+    {
+        using Mask = __mmask8;
+        static constexpr size_t LANES = 8;
+
+        __m512d v;
+
+        static VecD Set1( double a )         noexcept { return { _mm512_set1_pd( a ) }; }
+        static VecD LoadF( const float* p )  noexcept { return { _mm512_cvtps_pd( _mm256_loadu_ps( p ) ) }; }
+        void        StoreF( float* p ) const noexcept { _mm256_storeu_ps( p, _mm512_cvtpd_ps( v ) ); }
+        static Mask AllTrue()                noexcept { return static_cast<Mask>( 0xFF ); }
+        static Mask NoneTrue()               noexcept { return static_cast<Mask>( 0x00 ); }
+    };
+
+    inline VecD operator+( VecD a, VecD b ) noexcept { return { _mm512_add_pd( a.v, b.v ) }; }
+    inline VecD operator-( VecD a, VecD b ) noexcept { return { _mm512_sub_pd( a.v, b.v ) }; }
+    inline VecD operator*( VecD a, VecD b ) noexcept { return { _mm512_mul_pd( a.v, b.v ) }; }
+    inline VecD operator/( VecD a, VecD b ) noexcept { return { _mm512_div_pd( a.v, b.v ) }; }
+    inline VecD Abs( VecD a )               noexcept { return { _mm512_abs_pd( a.v ) }; }
+    inline VecD Sqrt( VecD a )              noexcept { return { _mm512_sqrt_pd( a.v ) }; }
+    inline __mmask8 Less( VecD a, VecD b )  noexcept { return _mm512_cmp_pd_mask( a.v, b.v, _CMP_LT_OQ ); }
+    inline VecD Select( __mmask8 m, VecD t, VecD f ) noexcept { return { _mm512_mask_blend_pd( m, f.v, t.v ) }; }
+    inline __mmask8 MaskAnd( __mmask8 a, __mmask8 b )    noexcept { return static_cast<__mmask8>( a & b ); }
+    inline __mmask8 MaskOr( __mmask8 a, __mmask8 b )     noexcept { return static_cast<__mmask8>( a | b ); }
+    inline __mmask8 MaskAndNot( __mmask8 a, __mmask8 b ) noexcept { return static_cast<__mmask8>( a & ~b ); }
+    inline bool     MaskAny( __mmask8 m )                noexcept { return m != 0; }
+    inline unsigned MaskBits( __mmask8 m )               noexcept { return static_cast<unsigned>( m ); }
+
+    constexpr const char* BACKEND_NAME = "avx512";
+
+#elif defined(__AVX2__)
+    /* ------------------------------------------------------------------------
+     | AVX2 (4 lanes, double)
+     +------------------------------------------------------------------------ */
+    struct VecD
+    {
+        using Mask = __m256d;
+        static constexpr size_t LANES = 4;
+
+        __m256d v;
+
+        static VecD Set1( double a )         noexcept { return { _mm256_set1_pd( a ) }; }
+        static VecD LoadF( const float* p )  noexcept { return { _mm256_cvtps_pd( _mm_loadu_ps( p ) ) }; }
+        void        StoreF( float* p ) const noexcept { _mm_storeu_ps( p, _mm256_cvtpd_ps( v ) ); }
+        static Mask AllTrue()                noexcept { return _mm256_castsi256_pd( _mm256_set1_epi64x( -1 ) ); }
+        static Mask NoneTrue()               noexcept { return _mm256_setzero_pd(); }
+    };
+
+    inline VecD operator+( VecD a, VecD b ) noexcept { return { _mm256_add_pd( a.v, b.v ) }; }
+    inline VecD operator-( VecD a, VecD b ) noexcept { return { _mm256_sub_pd( a.v, b.v ) }; }
+    inline VecD operator*( VecD a, VecD b ) noexcept { return { _mm256_mul_pd( a.v, b.v ) }; }
+    inline VecD operator/( VecD a, VecD b ) noexcept { return { _mm256_div_pd( a.v, b.v ) }; }
+    inline VecD Abs( VecD a )               noexcept { return { _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), a.v ) }; }
+    inline VecD Sqrt( VecD a )              noexcept { return { _mm256_sqrt_pd( a.v ) }; }
+    inline __m256d Less( VecD a, VecD b )   noexcept { return _mm256_cmp_pd( a.v, b.v, _CMP_LT_OQ ); }
+    inline VecD Select( __m256d m, VecD t, VecD f ) noexcept { return { _mm256_blendv_pd( f.v, t.v, m ) }; }
+    inline __m256d  MaskAnd( __m256d a, __m256d b )    noexcept { return _mm256_and_pd( a, b ); }
+    inline __m256d  MaskOr( __m256d a, __m256d b )     noexcept { return _mm256_or_pd( a, b ); }
+    inline __m256d  MaskAndNot( __m256d a, __m256d b ) noexcept { return _mm256_andnot_pd( b, a ); }
+    inline bool     MaskAny( __m256d m )               noexcept { return _mm256_movemask_pd( m ) != 0; }
+    inline unsigned MaskBits( __m256d m )              noexcept { return static_cast<unsigned>( _mm256_movemask_pd( m ) ); }
+
+    constexpr const char* BACKEND_NAME = "avx2";
+
+#else
+    /* ------------------------------------------------------------------------
+     | SIMD 미지원 빌드 : 스칼라 레인을 그대로 사용
+     +------------------------------------------------------------------------ */
+    using VecD = ScalarD;
+
+    constexpr const char* BACKEND_NAME = "scalar";
+#endif
+
+    /* ------------------------------------------------------------------------
+     | 커널 (벡터 타입 V에 대한 템플릿)
+     | TERMS(DistortionTerm 비트 조합)는 컴파일 시점 상수로, 0인 항의 연산은 코드에서 제거됩니다.
+     | 기본값 TERM_ALL은 모든 항을 계산하므로 어떤 파라미터에도 정확합니다.
+     +------------------------------------------------------------------------ */
+
+    /** 픽셀 좌표 -> 정규화 좌표 (Calibrator::Normalize와 동일한 수식) */
+    template<unsigned TERMS = TERM_ALL, class V>
+    inline void NormalizeLanes( const KernelCoeffs& c, const V& px, const V& py, V& nx, V& ny ) noexcept
+    {
+        ny = ( py - V::Set1( c.cy ) ) * V::Set1( c.inv_fy );
+        nx = ( px - V::Set1( c.cx ) ) * V::Set1( c.inv_fx );
+        if constexpr( ( TERMS & TERM_SKEW ) != 0 ) {
+            nx = nx - V::Set1( c.skew ) * ny;
+        }
+    }
+
+    /** 정규화 좌표 -> 픽셀 좌표 (Calibrator::DeNormalize와 동일한 수식) */
+    template<unsigned TERMS = TERM_ALL, class V>
+    inline void DeNormalizeLanes( const KernelCoeffs& c, const V& nx, const V& ny, V& px, V& py ) noexcept
+    {
+        if constexpr( ( TERMS & TERM_SKEW ) != 0 ) {
+            px = V::Set1( c.fx ) * ( nx + V::Set1( c.skew ) * ny ) + V::Set1( c.cx );
+        }
+        else {
+            px = V::Set1( c.fx ) * nx + V::Set1( c.cx );
+        }
+        py = V::Set1( c.fy ) * ny + V::Set1( c.cy );
+    }
+
+    /** 방사 왜곡 계수 R = 1 + k1*r^2 + k2*r^4 (+ k3*r^6) 와 그 도함수 dR/d(r^2) (Horner) */
+    template<unsigned TERMS, class V>
+    inline V RadialLanes( const KernelCoeffs& c, const V& r2 ) noexcept
+    {
+        if constexpr( ( TERMS & TERM_K3 ) != 0 ) {
+            return V::Set1( 1.0 ) + r2 * ( V::Set1( c.k1 ) + r2 * ( V::Set1( c.k2 ) + r2 * V::Set1( c.k3 ) ) );
+        }
+        else {
+            return V::Set1( 1.0 ) + r2 * ( V::Set1( c.k1 ) + r2 * V::Set1( c.k2 ) );
+        }
+    }
+
+    template<unsigned TERMS, class V>
+    inline V RadialDerivLanes( const KernelCoeffs& c, const V& r2 ) noexcept
+    {
+        if constexpr( ( TERMS & TERM_K3 ) != 0 ) {
+            return V::Set1( c.k1 ) + r2 * ( V::Set1( 2.0 * c.k2 ) + r2 * V::Set1( 3.0 * c.k3 ) );
+        }
+        else {
+            return V::Set1( c.k1 ) + r2 * V::Set1( 2.0 * c.k2 );
+        }
+    }
+
+    /** 정규화 좌표에 왜곡 모델 적용 (Calibrator::DistortNormal과 동일한 수식) */
+    template<unsigned TERMS = TERM_ALL, class V>
+    inline void DistortLanes( const KernelCoeffs& c, const V& x, const V& y, V& dx, V& dy ) noexcept
+    {
+        constexpr bool RADIAL     = ( TERMS & ( TERM_RADIAL | TERM_K3 ) ) != 0;
+        constexpr bool TANGENTIAL = ( TERMS & TERM_TANGENTIAL ) != 0;
+
+        dx = x;
+        dy = y;
+        if constexpr( RADIAL || TANGENTIAL )
+        {
+            const V xx = x * x;
+            const V yy = y * y;
+            const V r2 = xx + yy;
+            if constexpr( RADIAL ) {
+                const V radial = RadialLanes<TERMS>( c, r2 );
+                dx = radial * x;
+                dy = radial * y;
+            }
+            if constexpr( TANGENTIAL ) {
+                const V two = V::Set1( 2.0 );
+                const V xy  = x * y;
+                const V p1  = V::Set1( c.p1 );
+                const V p2  = V::Set1( c.p2 );
+                dx = dx + two * p1 * xy + p2 * ( r2 + two * xx );
+                dy = dy + p1 * ( r2 + two * yy ) + two * p2 * xy;
+            }
+        }
+    }
+
+    /**
+     * @brief 왜곡 모델과 그 해석적 야코비안을 함께 계산합니다.
+     * 야코비안은 대칭(d(dx)/dy == d(dy)/dx)이므로 세 성분(j00, j01, j11)만 반환합니다.
+     *   R  = 1 + k1*r^2 + k2*r^4 + k3*r^6,  D = dR/d(r^2) = k1 + 2*k2*r^2 + 3*k3*r^4
+     *   j00 = R + 2*x^2*D + 2*p1*y + 6*p2*x
+     *   j01 = 2*x*y*D + 2*p1*x + 2*p2*y
+     *   j11 = R + 2*y^2*D + 6*p1*y + 2*p2*x
+     */
+    template<unsigned TERMS = TERM_ALL, class V>
+    inline void DistortJacobianLanes( const KernelCoeffs& c, const V& x, const V& y,
+                                      V& dx, V& dy, V& j00, V& j01, V& j11 ) noexcept
+    {
+        constexpr bool RADIAL     = ( TERMS & ( TERM_RADIAL | TERM_K3 ) ) != 0;
+        constexpr bool TANGENTIAL = ( TERMS & TERM_TANGENTIAL ) != 0;
+
+        const V two = V::Set1( 2.0 );
+        const V xx  = x * x;
+        const V yy  = y * y;
+        const V xy  = x * y;
+        const V r2  = xx + yy;
+
+        if constexpr( RADIAL ) {
+            const V radial  = RadialLanes<TERMS>( c, r2 );
+            const V dradial = RadialDerivLanes<TERMS>( c, r2 );
+            dx  = radial * x;
+            dy  = radial * y;
+            j00 = radial + two * xx * dradial;
+            j01 = two * xy * dradial;
+            j11 = radial + two * yy * dradial;
+        }
+        else {
+            dx  = x;
+            dy  = y;
+            j00 = V::Set1( 1.0 );
+            j01 = V::Set1( 0.0 );
+            j11 = V::Set1( 1.0 );
+        }
+
+        if constexpr( TANGENTIAL ) {
+            const V p1  = V::Set1( c.p1 );
+            const V p2  = V::Set1( c.p2 );
+            const V six = V::Set1( 6.0 );
+            dx  = dx + two * p1 * xy + p2 * ( r2 + two * xx );
+            dy  = dy + p1 * ( r2 + two * yy ) + two * p2 * xy;
+            j00 = j00 + two * p1 * y + six * p2 * x;
+            j01 = j01 + two * p1 * x + two * p2 * y;
+            j11 = j11 + six * p1 * y + two * p2 * x;
+        }
+    }
+
+    /**
+     * @brief 역왜곡 다항식 모델로 정규화 좌표를 반복 없이 보정합니다.
+     * 다항식 평가 후 고정 1회의 뉴턴 보정을 적용하고, 보정 결과를 다시 왜곡시켜 잔차를 검사합니다.
+     * 분기 없는 고정 연산이므로 벡터화가 잘 되고 지연 시간이 일정합니다.
+     * 잔차 허용치는 모델의 tolerance와 호출자의 err_threshold 중 작은 값이므로,
+     * 통과한 레인은 반복 풀이의 수렴 조건(|distort(u) - d| < err_threshold)도 만족합니다.
+     * @param tx, ty 왜곡된 정규화 좌표 (목표).
+     * @param ux, uy 보정된 정규화 좌표 (출력, 모든 레인에 기록).
+     * @param thr_x, thr_y 호출자의 수렴 임계값 (정규화 좌표, IterateLanes와 동일).
+     * @return 적합 범위 안이고 잔차 검사를 통과한 레인의 마스크.
+     */
+    template<unsigned TERMS = TERM_ALL, class V>
+    inline typename V::Mask InverseLanes( const KernelCoeffs& c, const V& tx, const V& ty, V& ux, V& uy,
+                                          double thr_x, double thr_y ) noexcept
+    {
+        const V two = V::Set1( 2.0 );
+        const V xx  = tx * tx;
+        const V yy  = ty * ty;
+        const V r2  = xx + yy;
+
+        // 1. 다항식 평가 (Horner, 접선 왜곡이 없으면 q1, q2 항 생략)
+        const V poly = r2 * ( V::Set1( c.ia1 ) + r2 * ( V::Set1( c.ia2 ) + r2 * ( V::Set1( c.ia3 ) + r2 * V::Set1( c.ia4 ) ) ) );
+        V x0 = tx + tx * poly;
+        V y0 = ty + ty * poly;
+        if constexpr( ( TERMS & TERM_TANGENTIAL ) != 0 ) {
+            const V xy = tx * ty;
+            const V q1 = V::Set1( c.iq1 );
+            const V q2 = V::Set1( c.iq2 );
+            x0 = x0 + two * q1 * xy + q2 * ( r2 + two * xx );
+            y0 = y0 + q1 * ( r2 + two * yy ) + two * q2 * xy;
+        }
+
+        // 2. 고정 1회 뉴턴 보정
+        V dx, dy, j00, j01, j11;
+        DistortJacobianLanes<TERMS>( c, x0, y0, dx, dy, j00, j01, j11 );
+        const V ex       = dx - tx;
+        const V ey       = dy - ty;
+        const V det      = j00 * j11 - j01 * j01;
+        const auto sane  = Less( V::Set1( Calibrator::CALIBRATE_INTERNAL_EPSILON ), Abs( det ) );
+        const V safe_det = Select( sane, det, V::Set1( 1.0 ) );
+        ux = x0 - Select( sane, ( j11 * ex - j01 * ey ) / safe_det, V::Set1( 0.0 ) );
+        uy = y0 - Select( sane, ( j00 * ey - j01 * ex ) / safe_det, V::Set1( 0.0 ) );
+
+        // 3. 잔차 검사 (적합 범위 안 && |distort(u) - d| < min(tolerance, err_threshold))
+        V rx, ry;
+        DistortLanes<TERMS>( c, ux, uy, rx, ry );
+        const V tol_x = V::Set1( std::min( c.inv_tolerance, thr_x ) );
+        const V tol_y = V::Set1( std::min( c.inv_tolerance, thr_y ) );
+        const auto inside = Less( r2, V::Set1( c.inv_r2_max ) );
+        return MaskAnd( inside, MaskAnd( Less( Abs( rx - tx ), tol_x ), Less( Abs( ry - ty ), tol_y ) ) );
+    }
+
+    /**
+     * @brief 정규화 좌표에서 반복 보정을 수행합니다. (UndistortLanes의 반복 루프)
+     * 고정점 반복(FixedPoint)은 기존 Calibrator::Calibrate와 동일한 갱신식(u -= e)을 사용하고,
+     * 뉴턴 반복(Newton)은 해석적 야코비안으로 u -= J^-1 * e 를 계산합니다.
+     * 야코비안이 특이(singular)에 가까운 레인은 해당 반복에서 고정점 갱신으로 대체합니다.
+     * @param tx, ty 목표(왜곡된) 정규화 좌표.
+     * @param ux, uy 초기 추정값 (입력) / 보정 결과 (출력). active 레인만 갱신됩니다.
+     * @param active 반복할 레인의 마스크.
+     * @param lane_iterations 레인별로 수행한 반복 횟수의 합을 누적합니다.
+     * @return active 중 수렴한 레인의 마스크.
+     */
+    template<UndistortSolver SOLVER, unsigned TERMS = TERM_ALL, class V>
+    inline typename V::Mask IterateLanes( const KernelCoeffs& c, const V& tx, const V& ty, V& ux, V& uy,
+                                          typename V::Mask active, int max_iterations,
+                                          double thr_x, double thr_y, size_t& lane_iterations ) noexcept
+    {
+        const V thx = V::Set1( thr_x );
+        const V thy = V::Set1( thr_y );
+        typename V::Mask converged = V::NoneTrue();
+
+        for( int it = 0; it < max_iterations && MaskAny( active ); ++it )
+        {
+            lane_iterations += static_cast<size_t>( __builtin_popcount( MaskBits( active ) ) );
+
+            V ex, ey; // 현재 추정값의 왜곡 좌표와 목표 좌표의 차이
+            V sx, sy; // 이번 반복의 갱신량
+            if constexpr( SOLVER == UndistortSolver::Newton )
+            {
+                V dx, dy, j00, j01, j11;
+                DistortJacobianLanes<TERMS>( c, ux, uy, dx, dy, j00, j01, j11 );
+                ex = dx - tx;
+                ey = dy - ty;
+
+                const V det      = j00 * j11 - j01 * j01;
+                const auto sane  = Less( V::Set1( Calibrator::CALIBRATE_INTERNAL_EPSILON ), Abs( det ) );
+                const V safe_det = Select( sane, det, V::Set1( 1.0 ) );
+                sx = Select( sane, ( j11 * ex - j01 * ey ) / safe_det, ex );
+                sy = Select( sane, ( j00 * ey - j01 * ex ) / safe_det, ey );
+            }
+            else
+            {
+                V dx, dy;
+                DistortLanes<TERMS>( c, ux, uy, dx, dy );
+                ex = dx - tx;
+                ey = dy - ty;
+                sx = ex;
+                sy = ey;
+            }
+
+            // 아직 수렴하지 않은 레인만 갱신 (스칼라 경로와 동일하게 종료 직전 보정도 적용)
+            ux = Select( active, ux - sx, ux );
+            uy = Select( active, uy - sy, uy );
+
+            const typename V::Mask done = MaskAnd( active, MaskAnd( Less( Abs( ex ), thx ), Less( Abs( ey ), thy ) ) );
+            converged = MaskOr( converged, done );
+            active    = MaskAndNot( active, done );
+        }
+        return converged;
+    }
+
+    /**
+     * @brief 픽셀 좌표 레인들을 반복법으로 왜곡 보정합니다.
+     * 초기값은 왜곡된 정규화 좌표이며, 반복은 IterateLanes를 따릅니다.
+     * 역모델이 있으면 먼저 InverseLanes로 보정하고, 범위 밖이거나 잔차 검사에 실패한 레인만
+     * 기존과 같은 초기값(왜곡된 좌표)에서 반복 계산합니다. (역모델로 끝난 레인의 반복 횟수는 0)
+     * 수렴한 레인만 보정된 픽셀 좌표로 덮어쓰며, 수렴하지 못한 레인은 입력값을 유지합니다.
+     * @param lane_iterations 레인별로 수행한 반복 횟수의 합을 누적합니다.
+     * @return 수렴한 레인의 마스크.
+     */
+    template<UndistortSolver SOLVER, unsigned TERMS = TERM_ALL, class V>
+    inline typename V::Mask UndistortLanes( const KernelCoeffs& c, V& px, V& py, int max_iterations,
+                                            double thr_x, double thr_y, size_t& lane_iterations ) noexcept
+    {
+        V tx, ty; // 목표(왜곡된) 정규화 좌표
+        NormalizeLanes<TERMS>( c, px, py, tx, ty );
+
+        V ux = tx, uy = ty; // 초기 추정값: 왜곡된 좌표
+        typename V::Mask active    = V::AllTrue();
+        typename V::Mask converged = V::NoneTrue();
+
+        // 역모델로 먼저 보정 (통과한 레인은 반복 대상에서 제외)
+        if( c.inv_enabled ) {
+            V ix, iy;
+            const typename V::Mask accepted = InverseLanes<TERMS>( c, tx, ty, ix, iy, thr_x, thr_y );
+            ux        = Select( accepted, ix, ux );
+            uy        = Select( accepted, iy, uy );
+            converged = accepted;
+            active    = MaskAndNot( active, accepted );
+        }
+
+        converged = MaskOr( converged, IterateLanes<SOLVER, TERMS>( c, tx, ty, ux, uy, active, max_iterations,
+                                                                     thr_x, thr_y, lane_iterations ) );
+
+        V ox, oy;
+        DeNormalizeLanes<TERMS>( c, ux, uy, ox, oy );
+        px = Select( converged, ox, px );
+        py = Select( converged, oy, py );
+        return converged;
+    }
+
+    /**
+     * @brief 보정된 픽셀 좌표에 호모그래피를 적용하고 원근 나눗셈을 수행합니다.
+     *   (X, Y, W) = H * (x, y, 1),  (gx, gy) = (X / W, Y / W)
+     * |W|가 Calibrator::CALIBRATE_INTERNAL_EPSILON 이하인 레인(무한원점)은 NaN을 기록합니다.
+     * @return 유한한 결과를 가진 레인의 마스크.
+     */
+    template<class V>
+    inline typename V::Mask HomographyLanes( const HomographyCoeffs& h, const V& x, const V& y, V& gx, V& gy ) noexcept
+    {
+        const V X = V::Set1( h.h00 ) * x + V::Set1( h.h01 ) * y + V::Set1( h.h02 );
+        const V Y = V::Set1( h.h10 ) * x + V::Set1( h.h11 ) * y + V::Set1( h.h12 );
+        const V W = V::Set1( h.h20 ) * x + V::Set1( h.h21 ) * y + V::Set1( h.h22 );
+
+        const auto finite = Less( V::Set1( Calibrator::CALIBRATE_INTERNAL_EPSILON ), Abs( W ) );
+        const V    nan    = V::Set1( std::numeric_limits<double>::quiet_NaN() );
+        const V    inv_w  = V::Set1( 1.0 ) / Select( finite, W, V::Set1( 1.0 ) );
+        gx = Select( finite, X * inv_w, nan );
+        gy = Select( finite, Y * inv_w, nan );
+        return finite;
+    }
+
+} // nsp::MGEN::MVEM::simd
+
+#endif // _MGEN_MVEM_CALIBRATOR_KERNELS_H_
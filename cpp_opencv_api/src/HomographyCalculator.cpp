@@ -2,6 +2,11 @@
 
 #include "HomographyCalculator.h"
 #include "MgenLogger.h" // 사용자 제공 로거
+#include "HomographyMetrics.h" // 대응점별 재투영 오차 (SIMD), leave-one-out 진단
+#include "WorkerPool.h" // 공용 워커 스레드 풀 (일괄 계산)
+#include <chrono>       // 풀이 경로별 지연 시간
+#include <cmath>        // std::isfinite
+#include <limits>       // std::numeric_limits
 
 // POST 요청 JSON 본문 내에서 기대하는 주요 키 이름들
 // 예시 요청 본문 구조:
@@ -63,7 +68,7 @@ cv::Point2f HomographyCalculator::getCoordFromJsonArray(const nlohmann::json& ob
     }
 }
 
-json HomographyCalculator::homographyMatrixToJson(const cv::Mat& matrix) {
+json HomographyCalculator::homographyMatrixToJson(const cv::Mat& matrix) const {
     // 행렬 유효성 검사 (타입: CV_64F, 크기: 3x3)
     if (matrix.empty() || matrix.rows != 3 || matrix.cols != 3 || matrix.type() != CV_64F) {
         MLOG_WARN("Invalid or empty matrix provided to homographyMatrixToJson. Matrix type: %d, dims: %d, rows: %d, cols: %d",
@@ -82,28 +87,583 @@ json HomographyCalculator::homographyMatrixToJson(const cv::Mat& matrix) {
     return json_matrix;
 }
 
+bool HomographyCalculator::jsonToHomographyMatrix(const nlohmann::json& json_matrix, cv::Matx33d& matrix) const {
+    if (!json_matrix.is_array() || json_matrix.size() != 3) {
+        return false;
+    }
+    for (int i = 0; i < 3; ++i) {
+        const auto& row = json_matrix.at(i);
+        if (!row.is_array() || row.size() != 3) {
+            return false;
+        }
+        for (int j = 0; j < 3; ++j) {
+            if (!row.at(j).is_number()) {
+                return false;
+            }
+            matrix(i, j) = row.at(j).get<double>();
+            if (!std::isfinite(matrix(i, j))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool HomographyCalculator::jsonToPointArrays(const nlohmann::json& points_json,
+                                             std::vector<float>& xs, std::vector<float>& ys,
+                                             std::string& error) const {
+    if (!points_json.is_object() || !points_json.contains("x") || !points_json.contains("y") ||
+        !points_json.at("x").is_array() || !points_json.at("y").is_array() ||
+        points_json.at("x").size() != points_json.at("y").size()) {
+        error = "Points must be an object with 'x' and 'y' arrays of equal length.";
+        return false;
+    }
+    const auto& json_x = points_json.at("x");
+    const auto& json_y = points_json.at("y");
+    const size_t count = json_x.size();
+    xs.resize(count);
+    ys.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (!json_x[i].is_number() || !json_y[i].is_number()) {
+            error = "Point " + std::to_string(i) + " is not a pair of numbers.";
+            return false;
+        }
+        xs[i] = json_x[i].get<float>();
+        ys[i] = json_y[i].get<float>();
+    }
+    return true;
+}
+
+json HomographyCalculator::getStatistics() const {
+    const auto cache_stats = calibrator_cache_.getStats();
+    const auto calibrator_flight_stats = calibrator_cache_.getFlightStats();
+    json stats;
+    stats["calibrator_cache"] = {
+        {"hits", cache_stats.hits},
+        {"misses", cache_stats.misses},
+        {"hit_ratio", cache_stats.hitRatio()},
+        {"evictions", cache_stats.evictions},
+        {"size", cache_stats.size},
+        {"capacity", cache_stats.capacity},
+        {"constructions", calibrator_flight_stats.leaders},
+        {"coalesced_misses", calibrator_flight_stats.coalesced}
+    };
+    const auto remap_stats = image_undistorter_.getStats();
+    stats["remap_cache"] = {
+        {"hits", remap_stats.hits},
+        {"misses", remap_stats.misses},
+        {"hit_ratio", remap_stats.hitRatio()},
+        {"evictions", remap_stats.evictions},
+        {"size", remap_stats.size},
+        {"capacity", remap_stats.capacity}
+    };
+    const auto model_stats = model_registry_.getStats();
+    const auto result_stats = result_cache_.getStats();
+    stats["result_cache"] = {
+        {"hits", result_stats.hits},
+        {"misses", result_stats.misses},
+        {"hit_ratio", result_stats.hitRatio()},
+        {"expirations", result_stats.expirations},
+        {"evictions", result_stats.evictions},
+        {"size", result_stats.size},
+        {"capacity", result_stats.capacity},
+        {"bytes", result_stats.bytes},
+        {"max_bytes", result_stats.max_bytes}
+    };
+    const auto flight_stats = inflight_calculations_.stats();
+    stats["coalescing"] = {
+        {"leaders", flight_stats.leaders},
+        {"coalesced", flight_stats.coalesced},
+        {"in_flight", flight_stats.in_flight}
+    };
+    stats["models"] = {
+        {"count", model_stats.models},
+        {"version", model_stats.version},
+        {"reclaimed_snapshots", model_stats.reclaimed_tables},
+        {"last_grace_period_us", model_stats.last_grace_us},
+        {"snapshot_writes", model_stats.snapshot_writes},
+        {"snapshot_errors", model_stats.snapshot_errors},
+        {"restored", model_stats.restored_models},
+        {"restore_ms", model_stats.restore_ms}
+    };
+    stats["sessions"] = {
+        {"count", sessions_.size()}
+    };
+    json solver_paths = json::object();
+    for (size_t i = 0; i < solver_latency_.size(); ++i) {
+        const uint64_t count = solver_latency_[i].count.load(std::memory_order_relaxed);
+        const uint64_t total_ns = solver_latency_[i].total_ns.load(std::memory_order_relaxed);
+        solver_paths[MGEN::MVEM::HomographyEstimator::PathName(static_cast<MGEN::MVEM::HomographySolverPath>(i))] = {
+            {"count", count},
+            {"mean_us", count > 0 ? static_cast<double>(total_ns) / static_cast<double>(count) / 1000.0 : 0.0},
+            {"max_us", static_cast<double>(solver_latency_[i].max_ns.load(std::memory_order_relaxed)) / 1000.0}
+        };
+    }
+    stats["solver_paths"] = solver_paths;
+    return stats;
+}
+
+void HomographyCalculator::recordSolverLatency(MGEN::MVEM::HomographySolverPath path, std::chrono::steady_clock::duration elapsed) {
+    SolverLatency& latency = solver_latency_[static_cast<size_t>(path)];
+    const uint64_t ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    latency.count.fetch_add(1, std::memory_order_relaxed);
+    latency.total_ns.fetch_add(ns, std::memory_order_relaxed);
+    uint64_t previous = latency.max_ns.load(std::memory_order_relaxed);
+    while (previous < ns && !latency.max_ns.compare_exchange_weak(previous, ns, std::memory_order_relaxed)) {
+    }
+}
+
+json HomographyCalculator::projectPoints(const nlohmann::json& calibration_config_json,
+                                         const nlohmann::json& homography_json,
+                                         const nlohmann::json& points_json) {
+    json result_json;
+    result_json["success"] = false;
+
+    // 1. 호모그래피 검사
+    cv::Matx33d homography;
+    if (!jsonToHomographyMatrix(homography_json, homography)) {
+        result_json["error"] = "Homography matrix must be a 3x3 array of finite numbers.";
+        MLOG_WARN("Invalid homography matrix in projection request.");
+        return result_json;
+    }
+
+    // 2. Calibrator 획득 (좌표 보정과 같은 캐시를 공유)
+    std::string calibration_error;
+    std::shared_ptr<const MGEN::MVEM::Calibrator> calibrator = calibrator_cache_.Acquire(calibration_config_json, &calibration_error);
+    if (!calibrator) {
+        result_json["error"] = "Provided calibration_config JSON is invalid: " + calibration_error;
+        MLOG_ERROR("Calibrator could not be created from provided calibration_config_json.");
+        return result_json;
+    }
+
+    return projectWith(*calibrator, homography, points_json);
+}
+
+json HomographyCalculator::projectPointsWithModel(const std::string& model_id, const nlohmann::json& points_json) {
+    const auto model = model_registry_.Find(model_id);
+    if (!model) {
+        return {{"success", false}, {"error", "Unknown model_id '" + model_id + "'."}, {"status_code", 404}};
+    }
+    json result_json = projectWith(*model->calibrator, model->homography, points_json);
+    result_json["model_id"] = model_id;
+    result_json["model_version"] = model->version;
+    return result_json;
+}
+
+json HomographyCalculator::projectWith(const MGEN::MVEM::Calibrator& calibrator, const cv::Matx33d& homography,
+                                       const nlohmann::json& points_json) {
+    json result_json;
+    result_json["success"] = false;
+
+    // 1. SoA 버퍼로 복사
+    std::vector<float> src_x, src_y;
+    std::string points_error;
+    if (!jsonToPointArrays(points_json, src_x, src_y, points_error)) {
+        result_json["error"] = points_error;
+        MLOG_WARN("Invalid points object in projection request: %s", points_error.c_str());
+        return result_json;
+    }
+
+    // 2. 융합 커널로 보정 + 투영 (대량 입력은 워커 풀에서 병렬 처리)
+    const size_t count = src_x.size();
+    std::vector<float> ground_x(count), ground_y(count);
+    std::vector<uint8_t> status(count);
+    const size_t projected = calibrator.ProjectBatchParallel(src_x.data(), src_y.data(), count, homography,
+                                                             ground_x.data(), ground_y.data(), status.data());
+    MLOG_DEBUG("Projected %zu / %zu points to the ground plane.", projected, count);
+
+    // 3. 결과 JSON 구성 (실패한 포인트의 NaN 좌표는 null로 직렬화됨)
+    result_json["success"] = true;
+    result_json["ground"] = {{"x", ground_x}, {"y", ground_y}};
+    result_json["status"] = status;
+    result_json["points_projected"] = projected;
+    result_json["points_failed"] = count - projected;
+    return result_json;
+}
+
+json HomographyCalculator::unprojectPoints(const nlohmann::json& calibration_config_json,
+                                           const nlohmann::json& homography_json,
+                                           const nlohmann::json& points_json) {
+    json result_json;
+    result_json["success"] = false;
+
+    // 1. 입력 검사 및 역행렬 계산 (지상 -> 보정된 픽셀)
+    cv::Matx33d homography;
+    if (!jsonToHomographyMatrix(homography_json, homography)) {
+        result_json["error"] = "Homography matrix must be a 3x3 array of finite numbers.";
+        MLOG_WARN("Invalid homography matrix in inverse projection request.");
+        return result_json;
+    }
+    bool invertible = false;
+    const cv::Matx33d inverse_homography = homography.inv(cv::DECOMP_LU, &invertible);
+    if (!invertible) {
+        result_json["error"] = "Homography matrix is singular and cannot be inverted.";
+        MLOG_WARN("Singular homography matrix in inverse projection request.");
+        return result_json;
+    }
+
+    // 2. Calibrator 획득
+    std::string calibration_error;
+    std::shared_ptr<const MGEN::MVEM::Calibrator> calibrator = calibrator_cache_.Acquire(calibration_config_json, &calibration_error);
+    if (!calibrator) {
+        result_json["error"] = "Provided calibration_config JSON is invalid: " + calibration_error;
+        MLOG_ERROR("Calibrator could not be created from provided calibration_config_json.");
+        return result_json;
+    }
+
+    return unprojectWith(*calibrator, inverse_homography, points_json);
+}
+
+json HomographyCalculator::unprojectPointsWithModel(const std::string& model_id, const nlohmann::json& points_json) {
+    const auto model = model_registry_.Find(model_id);
+    if (!model) {
+        return {{"success", false}, {"error", "Unknown model_id '" + model_id + "'."}, {"status_code", 404}};
+    }
+    json result_json = unprojectWith(*model->calibrator, model->inverse_homography, points_json);
+    result_json["model_id"] = model_id;
+    result_json["model_version"] = model->version;
+    return result_json;
+}
+
+json HomographyCalculator::unprojectWith(const MGEN::MVEM::Calibrator& calibrator, const cv::Matx33d& inverse_homography,
+                                         const nlohmann::json& points_json) {
+    json result_json;
+    result_json["success"] = false;
+
+    // 1. SoA 버퍼로 복사
+    std::vector<float> ground_x, ground_y;
+    std::string points_error;
+    if (!jsonToPointArrays(points_json, ground_x, ground_y, points_error)) {
+        result_json["error"] = points_error;
+        MLOG_WARN("Invalid points object in inverse projection request: %s", points_error.c_str());
+        return result_json;
+    }
+
+    // 2. 융합 커널로 역투영 + 왜곡 (반복 없음)
+    const size_t count = ground_x.size();
+    std::vector<float> image_x(count), image_y(count);
+    std::vector<uint8_t> status(count);
+    const size_t mapped = calibrator.UnprojectBatchParallel(ground_x.data(), ground_y.data(), count, inverse_homography,
+                                                            image_x.data(), image_y.data(), status.data());
+    MLOG_DEBUG("Unprojected %zu / %zu ground points to the distorted image.", mapped, count);
+
+    // 3. 결과 JSON 구성
+    result_json["success"] = true;
+    result_json["image"] = {{"x", image_x}, {"y", image_y}};
+    result_json["status"] = status;
+    result_json["points_projected"] = mapped;
+    result_json["points_failed"] = count - mapped;
+    return result_json;
+}
+
+json HomographyCalculator::listModels() const {
+    json models = json::array();
+    for (const auto& model : model_registry_.List()) {
+        models.push_back({
+            {"model_id", model->id},
+            {"model_version", model->version},
+            {"homography_matrix", homographyMatrixToJson(cv::Mat(model->homography))},
+            {"inliers", model->inlier_image_points.size()},
+            {"survey_points", model->survey_points}
+        });
+    }
+    return {{"success", true}, {"models", models}};
+}
+
+bool HomographyCalculator::removeModel(const std::string& model_id) {
+    return model_registry_.Remove(model_id);
+}
+
+size_t HomographyCalculator::restoreModels(const std::string& snapshot_path) {
+    return model_registry_.EnableSnapshot(snapshot_path);
+}
+
+bool HomographyCalculator::jsonToSurveyPair(const nlohmann::json& point_json, MGEN::MVEM::SurveyPair& pair,
+                                            std::string& error) const {
+    if (!point_json.is_object()) {
+        error = "Point must be a JSON object.";
+        return false;
+    }
+    for (const char* key : {CAMERA_COORDS_ARRAY_KEY_IN_POINT_OBJECT, GROUND_COORDS_ARRAY_KEY_IN_POINT_OBJECT}) {
+        if (!point_json.contains(key) || !point_json.at(key).is_array() || point_json.at(key).size() != 2 ||
+            !point_json.at(key).at(0).is_number() || !point_json.at(key).at(1).is_number()) {
+            error = std::string("Point must contain '") + key + "' as [x, y] numbers.";
+            return false;
+        }
+    }
+    const auto& camera = point_json.at(CAMERA_COORDS_ARRAY_KEY_IN_POINT_OBJECT);
+    const auto& ground = point_json.at(GROUND_COORDS_ARRAY_KEY_IN_POINT_OBJECT);
+    pair.camera = cv::Point2f(camera.at(0).get<float>(), camera.at(1).get<float>());
+    pair.ground = cv::Point2f(ground.at(0).get<float>(), ground.at(1).get<float>());
+    if (!std::isfinite(pair.camera.x) || !std::isfinite(pair.camera.y) ||
+        !std::isfinite(pair.ground.x) || !std::isfinite(pair.ground.y)) {
+        error = "Point coordinates must be finite.";
+        return false;
+    }
+    return true;
+}
+
+json HomographyCalculator::sessionToJson(MGEN::MVEM::HomographySession& session, bool include_points) const {
+    // 해와 포인트 목록은 한 번의 잠금으로 함께 읽음 (사이에 다른 편집이 끼어들면 H와 인라이어 목록이 어긋남)
+    std::vector<MGEN::MVEM::HomographySession::SurveyPoint> session_points;
+    const MGEN::MVEM::HomographySession::Solution solution = include_points ? session.Solve(session_points) : session.Solve();
+    json result_json;
+    result_json["success"] = true;
+    result_json["session_id"] = session.getId();
+    if (include_points) {
+        result_json["estimator"] = MGEN::MVEM::HomographyEstimator::MethodName(session.getEstimatorOptions().method);
+    }
+    result_json["revision"] = solution.revision;
+    result_json["homography_matrix"] = solution.valid ? homographyMatrixToJson(cv::Mat(solution.homography)) : json(nullptr);
+    result_json["points"] = solution.points;
+    result_json["active_points"] = solution.active_points;
+    result_json["rms_error"] = solution.rms_error;
+    result_json["solve_us"] = solution.solve_us;
+
+    if (include_points) {
+        json survey_points = json::array();
+        for (const auto& point : session_points) {
+            survey_points.push_back({
+                {"point_id", point.id},
+                {CAMERA_COORDS_ARRAY_KEY_IN_POINT_OBJECT, {point.camera.x, point.camera.y}},
+                {GROUND_COORDS_ARRAY_KEY_IN_POINT_OBJECT, {point.ground.x, point.ground.y}},
+                {"inlier", point.active}
+            });
+        }
+        result_json["survey_points"] = survey_points;
+    }
+    return result_json;
+}
+
+json HomographyCalculator::createSession(const nlohmann::json& calibration_config_json, const nlohmann::json& survey_data_json,
+                                        const nlohmann::json& estimator_json) {
+    std::string calibration_error;
+    std::shared_ptr<const MGEN::MVEM::Calibrator> calibrator = calibrator_cache_.Acquire(calibration_config_json, &calibration_error);
+    if (!calibrator) {
+        return {{"success", false}, {"error", "Provided calibration_config JSON is invalid: " + calibration_error}, {"status_code", 400}};
+    }
+
+    // 초기 포인트는 세션을 만들기 전에 모두 검사 (형식 오류면 세션을 만들지 않음)
+    std::vector<MGEN::MVEM::SurveyPair> survey_pairs;
+    if (!survey_data_json.is_null()) {
+        if (!survey_data_json.is_object() || !survey_data_json.contains(SURVEY_POINTS_ARRAY_KEY_IN_SURVEY_DATA) ||
+            !survey_data_json.at(SURVEY_POINTS_ARRAY_KEY_IN_SURVEY_DATA).is_array()) {
+            return {{"success", false},
+                    {"error", std::string("Survey data JSON must contain a '") + SURVEY_POINTS_ARRAY_KEY_IN_SURVEY_DATA + "' array."},
+                    {"status_code", 400}};
+        }
+        const auto& survey_points_array = survey_data_json.at(SURVEY_POINTS_ARRAY_KEY_IN_SURVEY_DATA);
+        survey_pairs.reserve(survey_points_array.size());
+        for (size_t i = 0; i < survey_points_array.size(); ++i) {
+            MGEN::MVEM::SurveyPair pair;
+            std::string point_error;
+            if (!jsonToSurveyPair(survey_points_array.at(i), pair, point_error)) {
+                return {{"success", false}, {"error", "Survey point " + std::to_string(i) + ": " + point_error}, {"status_code", 400}};
+            }
+            survey_pairs.push_back(pair);
+        }
+    }
+
+    const MGEN::MVEM::HomographyEstimatorOptions estimator_options = MGEN::MVEM::HomographyEstimator::ParseOptions(estimator_json);
+    auto session = sessions_.Create(calibrator, estimator_options);
+    if (!session) {
+        MLOG_WARN("Session limit reached. Rejecting new homography session.");
+        return {{"success", false}, {"error", "Too many active sessions. Delete an unused session and retry."}, {"status_code", 429}};
+    }
+
+    // 보정에 실패한 포인트는 calculate_dynamic과 같이 제외하고 개수만 알림
+    size_t skipped = 0;
+    for (const auto& pair : survey_pairs) {
+        uint64_t point_id = 0;
+        if (session->AddPoint(pair.camera, pair.ground, point_id) != MGEN::MVEM::HomographySession::EditStatus::OK) {
+            MLOG_WARN("Calibration failed for camera point (%.2f, %.2f). Excluded from session.", pair.camera.x, pair.camera.y);
+            ++skipped;
+        }
+    }
+    session->Rebuild(); // 정규화를 초기 포인트 전체 분포로 맞춤
+
+    MLOG_INFO("Homography session '%s' created with %zu point(s).", session->getId().c_str(), survey_pairs.size() - skipped);
+    json result_json = sessionToJson(*session, true);
+    result_json["skipped_points"] = skipped;
+    return result_json;
+}
+
+json HomographyCalculator::getSession(const std::string& session_id) {
+    const auto session = sessions_.Find(session_id);
+    if (!session) {
+        return {{"success", false}, {"error", "Unknown session_id '" + session_id + "'."}, {"status_code", 404}};
+    }
+    return sessionToJson(*session, true);
+}
+
+bool HomographyCalculator::deleteSession(const std::string& session_id) {
+    return sessions_.Remove(session_id);
+}
+
+json HomographyCalculator::addSessionPoint(const std::string& session_id, const nlohmann::json& point_json) {
+    const auto session = sessions_.Find(session_id);
+    if (!session) {
+        return {{"success", false}, {"error", "Unknown session_id '" + session_id + "'."}, {"status_code", 404}};
+    }
+    MGEN::MVEM::SurveyPair pair;
+    std::string point_error;
+    if (!jsonToSurveyPair(point_json, pair, point_error)) {
+        return {{"success", false}, {"error", point_error}, {"status_code", 400}};
+    }
+
+    uint64_t point_id = 0;
+    if (session->AddPoint(pair.camera, pair.ground, point_id) != MGEN::MVEM::HomographySession::EditStatus::OK) {
+        return {{"success", false}, {"error", "Calibration failed for the camera point."}, {"status_code", 422}};
+    }
+    json result_json = sessionToJson(*session, false);
+    result_json["point_id"] = point_id;
+    return result_json;
+}
+
+json HomographyCalculator::updateSessionPoint(const std::string& session_id, uint64_t point_id, const nlohmann::json& point_json) {
+    const auto session = sessions_.Find(session_id);
+    if (!session) {
+        return {{"success", false}, {"error", "Unknown session_id '" + session_id + "'."}, {"status_code", 404}};
+    }
+    MGEN::MVEM::SurveyPair pair;
+    std::string point_error;
+    if (!jsonToSurveyPair(point_json, pair, point_error)) {
+        return {{"success", false}, {"error", point_error}, {"status_code", 400}};
+    }
+
+    switch (session->UpdatePoint(point_id, pair.camera, pair.ground)) {
+        case MGEN::MVEM::HomographySession::EditStatus::NOT_FOUND:
+            return {{"success", false}, {"error", "Unknown point_id " + std::to_string(point_id) + "."}, {"status_code", 404}};
+        case MGEN::MVEM::HomographySession::EditStatus::CALIBRATION_FAILED:
+            return {{"success", false}, {"error", "Calibration failed for the camera point."}, {"status_code", 422}};
+        default:
+            break;
+    }
+    json result_json = sessionToJson(*session, false);
+    result_json["point_id"] = point_id;
+    return result_json;
+}
+
+json HomographyCalculator::removeSessionPoint(const std::string& session_id, uint64_t point_id) {
+    const auto session = sessions_.Find(session_id);
+    if (!session) {
+        return {{"success", false}, {"error", "Unknown session_id '" + session_id + "'."}, {"status_code", 404}};
+    }
+    if (session->RemovePoint(point_id) != MGEN::MVEM::HomographySession::EditStatus::OK) {
+        return {{"success", false}, {"error", "Unknown point_id " + std::to_string(point_id) + "."}, {"status_code", 404}};
+    }
+    json result_json = sessionToJson(*session, false);
+    result_json["point_id"] = point_id;
+    return result_json;
+}
+
+json HomographyCalculator::refitSession(const std::string& session_id, const std::string& model_id) {
+    if (!model_id.empty() && !MGEN::MVEM::ModelRegistry::IsValidId(model_id)) {
+        return {{"success", false}, {"error", "Invalid model_id '" + model_id + "'. Use 1-64 characters of [A-Za-z0-9_.-]."}, {"status_code", 400}};
+    }
+    const auto session = sessions_.Find(session_id);
+    if (!session) {
+        return {{"success", false}, {"error", "Unknown session_id '" + session_id + "'."}, {"status_code", 404}};
+    }
+
+    MGEN::MVEM::ResultCache::Result result;
+    std::string refit_error;
+    if (!session->Refit(result, refit_error)) {
+        MLOG_ERROR("Refit failed for session '%s': %s", session_id.c_str(), refit_error.c_str());
+        return {{"success", false}, {"error", refit_error}, {"status_code", 422}};
+    }
+
+    // 재계산 결과는 calculate_dynamic과 같은 형식으로 만들고(모델 등록 포함), 세션 상태를 덧붙임
+    json ransac_json = finishCalculation(json::object(), session->getCalibrator(), result, model_id);
+    if (!ransac_json.value("success", false)) {
+        return ransac_json;
+    }
+    json result_json = sessionToJson(*session, true);
+    result_json["ransac_homography_matrix"] = ransac_json["homography_matrix"];
+    for (const char* key : {"points_used_for_homography", "solver_path", "model_id", "inliers", "model_version"}) {
+        if (ransac_json.contains(key)) {
+            result_json[key] = ransac_json[key];
+        }
+    }
+    return result_json;
+}
+
+json HomographyCalculator::undistortImage(const nlohmann::json& calibration_config_json,
+                                          const std::string& image_bytes,
+                                          const std::string& output_format,
+                                          std::vector<unsigned char>& output_bytes) {
+    json result_json;
+    result_json["success"] = false;
+
+    // 1. Calibrator 획득 (좌표 보정과 같은 캐시를 공유)
+    std::string calibration_error;
+    std::shared_ptr<const MGEN::MVEM::Calibrator> calibrator = calibrator_cache_.Acquire(calibration_config_json, &calibration_error);
+    if (!calibrator) {
+        result_json["error"] = "Provided calibration_config JSON is invalid: " + calibration_error;
+        MLOG_ERROR("Calibrator could not be created from provided calibration_config_json.");
+        return result_json;
+    }
+
+    // 2. 이미지 디코딩 (원본 채널 유지)
+    const std::vector<unsigned char> encoded(image_bytes.begin(), image_bytes.end());
+    cv::Mat source = cv::imdecode(encoded, cv::IMREAD_UNCHANGED);
+    if (source.empty()) {
+        result_json["error"] = "Failed to decode the uploaded image.";
+        MLOG_ERROR("cv::imdecode failed. Uploaded image size: %zu bytes", image_bytes.size());
+        return result_json;
+    }
+
+    // 3. 왜곡 보정 (remap 맵 캐시 + 행 단위 병렬 remap)
+    cv::Mat undistorted;
+    bool cache_hit = false;
+    if (!image_undistorter_.Undistort(*calibrator, source, undistorted, nullptr, &cache_hit)) {
+        result_json["error"] = "Failed to undistort the image.";
+        MLOG_ERROR("ImageUndistorter failed for a %dx%d image.", source.cols, source.rows);
+        return result_json;
+    }
+
+    // 4. 인코딩
+    output_bytes.clear();
+    if (!cv::imencode(output_format, undistorted, output_bytes)) {
+        result_json["error"] = "Failed to encode the undistorted image as '" + output_format + "'.";
+        MLOG_ERROR("cv::imencode failed for format '%s'.", output_format.c_str());
+        return result_json;
+    }
+
+    result_json["success"] = true;
+    result_json["width"] = undistorted.cols;
+    result_json["height"] = undistorted.rows;
+    result_json["remap_cache_hit"] = cache_hit;
+    result_json["content_type"] = (output_format == ".png") ? "image/png" : "image/jpeg";
+    return result_json;
+}
+
 json HomographyCalculator::calculateWithProvidedData(const nlohmann::json& calibration_config_json,
-                                                   const nlohmann::json& survey_data_json_root) {
+                                                   const nlohmann::json& survey_data_json_root,
+                                                   const std::string& model_id,
+                                                   const nlohmann::json& estimator_json,
+                                                   const nlohmann::json& diagnostics_json) {
     json result_json; // 최종 반환될 JSON 객체
     result_json["success"] = false; // 기본적으로 실패로 설정
 
-    // 1. Calibrator 객체 생성 및 유효성 검사
-    // Calibrator 생성자는 내부적으로 CheckJsonValidation을 호출할 것으로 예상됨 (사용자 제공 코드 기반)
-    // calibration_config_json 자체가 Calibrator가 기대하는 최상위 JSON 구조여야 합니다.
-    // (예: { "CalibrationInfo": { "fx": ..., ... } })
-    if (!MGEN::MVEM::Calibrator::CheckJsonValidation(calibration_config_json)) {
-        result_json["error"] = "Provided calibration_config JSON is invalid according to Calibrator::CheckJsonValidation.";
-        MLOG_ERROR("Static validation of provided calibration_config_json failed.");
+    // 0. 모델 ID 형식 검사 (지정된 경우에만)
+    if (!model_id.empty() && !MGEN::MVEM::ModelRegistry::IsValidId(model_id)) {
+        result_json["error"] = "Invalid model_id '" + model_id + "'. Use 1-64 characters of [A-Za-z0-9_.-].";
+        result_json["status_code"] = 400;
         return result_json;
     }
 
-    MGEN::MVEM::Calibrator calibrator(calibration_config_json);
-    if (!calibrator.isValid()) { // Calibrator 인스턴스 생성 후 유효성 재확인
-        result_json["error"] = "Calibrator instance is invalid after construction with provided calibration data.";
-        MLOG_ERROR("Calibrator instance is invalid. Provided calibration_config_json: %s", calibration_config_json.dump(2).c_str());
+    // 1. Calibrator 획득 (파라미터/옵션은 매번 한 번 파싱하여 키를 만들고, 캐시 적중 시 Calibrator 생성(격자/역모델 준비)을 건너뜀)
+    // calibration_config_json 자체가 Calibrator가 기대하는 최상위 JSON 구조여야 합니다.
+    // (예: { "CalibrationInfo": { "fx": ..., ... }, "UndistortOptions": { ... } })
+    std::string calibration_error;
+    std::shared_ptr<const MGEN::MVEM::Calibrator> calibrator = calibrator_cache_.Acquire(calibration_config_json, &calibration_error);
+    if (!calibrator) {
+        result_json["error"] = "Provided calibration_config JSON is invalid: " + calibration_error;
+        MLOG_ERROR("Calibrator could not be created from provided calibration_config_json.");
         return result_json;
     }
-    MLOG_INFO("Calibrator created successfully from provided JSON data.");
+    MLOG_DEBUG("Calibrator acquired from cache (or created) for provided JSON data.");
 
     // 2. 서베이 데이터 파싱
     // survey_data_json_root 객체에서 실제 포인트 배열을 포함하는 키(예: "data")를 확인
@@ -116,19 +676,84 @@ json HomographyCalculator::calculateWithProvidedData(const nlohmann::json& calib
     }
     const auto& survey_points_array = survey_data_json_root.at(SURVEY_POINTS_ARRAY_KEY_IN_SURVEY_DATA);
 
-    std::vector<cv::Point2f> camera_points_for_homography; // 왜곡 보정된 카메라 좌표 (호모그래피 입력용)
-    std::vector<cv::Point2f> ground_points_for_homography; // 해당 지상 좌표 (호모그래피 입력용)
+    std::vector<MGEN::MVEM::SurveyPair> survey_pairs; // 원본(왜곡된) 카메라 좌표와 지상 좌표 쌍
+    std::vector<size_t> survey_item_index;            // survey_pairs[i]의 "data" 배열 내 인덱스 (인라이어 마스크 복원용)
+    survey_pairs.reserve(survey_points_array.size());
+    survey_item_index.reserve(survey_points_array.size());
 
     MLOG_INFO("Processing %d survey point objects from provided survey_data JSON.", survey_points_array.size());
-    for (const auto& survey_obj : survey_points_array) {
+    for (size_t item_index = 0; item_index < survey_points_array.size(); ++item_index) {
+        const auto& survey_obj = survey_points_array[item_index];
         if (!survey_obj.is_object()) {
             MLOG_WARN("Skipping an item in survey points array as it's not a JSON object.");
             continue;
         }
 
         // 각 서베이 객체에서 카메라 좌표와 지상 좌표를 파싱
-        cv::Point2f raw_camera_point = getCoordFromJsonArray(survey_obj, CAMERA_COORDS_ARRAY_KEY_IN_POINT_OBJECT);
-        cv::Point2f ground_point     = getCoordFromJsonArray(survey_obj, GROUND_COORDS_ARRAY_KEY_IN_POINT_OBJECT);
+        survey_item_index.push_back(item_index);
+        survey_pairs.push_back({getCoordFromJsonArray(survey_obj, CAMERA_COORDS_ARRAY_KEY_IN_POINT_OBJECT),
+                                getCoordFromJsonArray(survey_obj, GROUND_COORDS_ARRAY_KEY_IN_POINT_OBJECT)});
+    }
+
+    // 2-1. 요청 정규화 후 결과 캐시 조회: 같은 포인트 집합이면 순서와 관계없이 같은 키/같은 결과
+    // 추정 방식/파라미터도 결과를 바꾸므로 키에 포함
+    const MGEN::MVEM::HomographyEstimatorOptions estimator_options = MGEN::MVEM::HomographyEstimator::ParseOptions(estimator_json);
+    result_json["estimator"] = MGEN::MVEM::HomographyEstimator::MethodName(estimator_options.method);
+    std::vector<size_t> canonical_order; // 정렬 후 k번째 쌍의 survey_pairs 인덱스
+    MGEN::MVEM::ResultCache::Canonicalize(survey_pairs, canonical_order);
+    std::string cache_key = MGEN::MVEM::ResultCache::MakeKey(calibrator->getParams(), calibrator->getOptions(), survey_pairs);
+    MGEN::MVEM::HomographyEstimator::AppendKey(estimator_options, cache_key);
+    // 진단 요청 여부도 결과 내용을 바꾸므로 키에 포함
+    const bool leave_one_out = diagnostics_json.is_object() && diagnostics_json.contains("leave_one_out") &&
+                               diagnostics_json.at("leave_one_out").is_boolean() && diagnostics_json.at("leave_one_out").get<bool>();
+    cache_key.push_back(leave_one_out ? '\x01' : '\x00');
+    if (auto cached = result_cache_.Find(cache_key)) {
+        MLOG_INFO("Homography result served from cache (%zu point pairs).", cached->points_used);
+        result_json["result_cache_hit"] = true;
+        result_json["request_coalesced"] = false;
+        addPointResults(result_json, *cached, canonical_order, survey_item_index, survey_points_array.size());
+        return finishCalculation(std::move(result_json), calibrator, *cached, model_id);
+    }
+
+    // 2-2. 동일 요청 병합: 같은 키의 계산이 진행 중이면 새로 계산하지 않고 그 결과를 기다림
+    bool coalesced = false;
+    const CalculationOutcome outcome = inflight_calculations_.Do(cache_key, [&]() {
+        return computeCalculation(*calibrator, survey_pairs, survey_points_array.size(), estimator_options, leave_one_out, cache_key);
+    }, &coalesced);
+    if (!outcome.result) {
+        for (const auto& item : outcome.failure.items()) {
+            result_json[item.key()] = item.value();
+        }
+        return result_json;
+    }
+
+    result_json["result_cache_hit"] = false;
+    result_json["request_coalesced"] = coalesced;
+    addPointResults(result_json, *outcome.result, canonical_order, survey_item_index, survey_points_array.size());
+    return finishCalculation(std::move(result_json), calibrator, *outcome.result, model_id);
+}
+
+HomographyCalculator::CalculationOutcome HomographyCalculator::computeCalculation(const MGEN::MVEM::Calibrator& calibrator,
+                                                                                const std::vector<MGEN::MVEM::SurveyPair>& survey_pairs,
+                                                                                size_t survey_object_count,
+                                                                                const MGEN::MVEM::HomographyEstimatorOptions& estimator_options,
+                                                                                bool leave_one_out, const std::string& cache_key) {
+    CalculationOutcome outcome;
+
+    // 직전 리더가 방금 끝내고 캐시에 저장했을 수 있으므로 다시 확인
+    if (auto cached = result_cache_.Find(cache_key)) {
+        outcome.result = std::move(cached);
+        return outcome;
+    }
+
+    // 1. 왜곡 보정
+    std::vector<cv::Point2f> camera_points_for_homography; // 왜곡 보정된 카메라 좌표 (호모그래피 입력용)
+    std::vector<cv::Point2f> ground_points_for_homography; // 해당 지상 좌표 (호모그래피 입력용)
+    std::vector<size_t> pair_index_for_homography;         // 각 보정 성공 쌍의 survey_pairs 인덱스 (인라이어 마스크용)
+
+    for (size_t pair_index = 0; pair_index < survey_pairs.size(); ++pair_index) {
+        const cv::Point2f& raw_camera_point = survey_pairs[pair_index].camera;
+        const cv::Point2f& ground_point     = survey_pairs[pair_index].ground;
 
         // Calibrator를 사용하여 카메라 좌표의 왜곡 보정
         std::optional<cv::Point2f> calibrated_camera_point_opt = calibrator.Calibrate(raw_camera_point);
@@ -136,6 +761,7 @@ json HomographyCalculator::calculateWithProvidedData(const nlohmann::json& calib
         if (calibrated_camera_point_opt) {
             camera_points_for_homography.push_back(*calibrated_camera_point_opt);
             ground_points_for_homography.push_back(ground_point); // 보정 성공 시 대응하는 지상점 추가
+            pair_index_for_homography.push_back(pair_index);
             MLOG_DEBUG("Raw cam pt: (%.2f, %.2f) -> Calibrated: (%.2f, %.2f), Ground pt: (%.2f, %.2f)",
                        raw_camera_point.x, raw_camera_point.y,
                        calibrated_camera_point_opt->x, calibrated_camera_point_opt->y,
@@ -148,32 +774,257 @@ json HomographyCalculator::calculateWithProvidedData(const nlohmann::json& calib
 
     // 호모그래피 계산을 위한 최소 포인트 수 확인 (보통 4개 이상)
     if (camera_points_for_homography.size() < 4) {
-        result_json["error"] = "Not enough valid and calibratable point pairs to calculate homography (minimum 4 required).";
+        outcome.failure["error"] = "Not enough valid and calibratable point pairs to calculate homography (minimum 4 required).";
         MLOG_ERROR("Insufficient points for homography calculation. Successfully calibrated pairs: %d. Total survey objects: %d",
-                   camera_points_for_homography.size(), survey_points_array.size());
-        result_json["points_summary"] = {
-            {"total_survey_point_objects", survey_points_array.size()},
+                   camera_points_for_homography.size(), survey_object_count);
+        outcome.failure["points_summary"] = {
+            {"total_survey_point_objects", survey_object_count},
             {"successfully_calibrated_and_paired_points", camera_points_for_homography.size()}
         };
-        return result_json;
+        return outcome;
     }
 
-    // 3. 호모그래피 행렬 계산
-    // cv::findHomography는 입력 포인트가 float 타입이어야 함 (cv::Point2f)
-    MLOG_INFO("Calculating homography with %d point pairs.", camera_points_for_homography.size());
-    cv::Mat homography_matrix = cv::findHomography(camera_points_for_homography, ground_points_for_homography, cv::RANSAC);
+    // 2. 호모그래피 행렬 계산 (선택된 추정 방식)
+    MLOG_INFO("Calculating homography with %d point pairs (estimator: %s).", camera_points_for_homography.size(),
+              MGEN::MVEM::HomographyEstimator::MethodName(estimator_options.method));
+    MGEN::MVEM::HomographyEstimate estimate; // H + 인라이어 여부 (모델 등록 시 사용)
+    std::string estimate_error;
+    const auto estimate_started = std::chrono::steady_clock::now();
+    if (!MGEN::MVEM::HomographyEstimator::Estimate(camera_points_for_homography, ground_points_for_homography,
+                                                   estimator_options, estimate, estimate_error)) {
+        outcome.failure["error"] = estimate_error;
+        MLOG_ERROR("Homography estimation failed: %s Input points count: %d", estimate_error.c_str(), camera_points_for_homography.size());
+        return outcome;
+    }
+    recordSolverLatency(estimate.path, std::chrono::steady_clock::now() - estimate_started);
+    MLOG_INFO("Homography matrix calculated successfully (solver path: %s).", MGEN::MVEM::HomographyEstimator::PathName(estimate.path));
+    const std::vector<unsigned char>& inlier_mask = estimate.inlier_mask;
 
-    if (homography_matrix.empty()) {
-        result_json["error"] = "Failed to calculate homography matrix (cv::findHomography returned an empty matrix).";
-        MLOG_ERROR("cv::findHomography returned an empty matrix. Input points count: %d", camera_points_for_homography.size());
-        return result_json;
+    // 3. 결과 캐시에 저장 (H, H^-1, 인라이어)
+    auto computed = std::make_shared<MGEN::MVEM::ResultCache::Result>();
+    computed->homography = estimate.homography;
+    computed->inverse_homography = computed->homography.inv(cv::DECOMP_LU, &computed->invertible);
+    computed->inlier_mask.assign(survey_pairs.size(), 0); // 보정 실패 쌍은 0
+    for (size_t i = 0; i < camera_points_for_homography.size(); ++i) {
+        if (i < inlier_mask.size() && inlier_mask[i] != 0) {
+            computed->inlier_image_points.push_back(camera_points_for_homography[i]);
+            computed->inlier_ground_points.push_back(ground_points_for_homography[i]);
+            computed->inlier_mask[pair_index_for_homography[i]] = 1;
+        }
+    }
+    computed->points_used = camera_points_for_homography.size();
+    computed->iterations = estimate.iterations;
+    computed->solver_path = estimate.path;
+
+    // 3-1. 대응점별 전방/역방향 재투영 오차 (SoA 한 번 순회, 정렬 순서로 저장)
+    const size_t calibrated_count = camera_points_for_homography.size();
+    std::vector<float> soa(calibrated_count * 6);
+    float* cam_x = soa.data();
+    float* cam_y = cam_x + calibrated_count;
+    float* ground_x = cam_y + calibrated_count;
+    float* ground_y = ground_x + calibrated_count;
+    float* forward = ground_y + calibrated_count;
+    float* backward = forward + calibrated_count;
+    for (size_t i = 0; i < calibrated_count; ++i) {
+        cam_x[i] = camera_points_for_homography[i].x;
+        cam_y[i] = camera_points_for_homography[i].y;
+        ground_x[i] = ground_points_for_homography[i].x;
+        ground_y[i] = ground_points_for_homography[i].y;
+    }
+    MGEN::MVEM::ComputeTransferErrors(cam_x, cam_y, ground_x, ground_y, calibrated_count, computed->homography,
+                                      computed->invertible ? &computed->inverse_homography : nullptr, forward, backward);
+    computed->forward_errors.assign(survey_pairs.size(), std::numeric_limits<float>::quiet_NaN());
+    computed->backward_errors.assign(survey_pairs.size(), std::numeric_limits<float>::quiet_NaN());
+    for (size_t i = 0; i < calibrated_count; ++i) {
+        computed->forward_errors[pair_index_for_homography[i]] = forward[i];
+        computed->backward_errors[pair_index_for_homography[i]] = backward[i];
+    }
+
+    // 3-2. (선택) leave-one-out 진단: 반환한 모델의 인라이어만으로 DLT 방정식을 만들고 한 쌍씩 빼서 풀이
+    //      (아웃라이어를 넣으면 기준 해와 influence가 아웃라이어에 끌려가므로 제외하고, 아웃라이어 항목은 null)
+    if (leave_one_out) {
+        std::vector<size_t> inlier_pair_index;
+        inlier_pair_index.reserve(computed->inlier_image_points.size());
+        for (size_t i = 0; i < calibrated_count; ++i) {
+            if (i < inlier_mask.size() && inlier_mask[i] != 0) {
+                inlier_pair_index.push_back(pair_index_for_homography[i]);
+            }
+        }
+        std::vector<MGEN::MVEM::LeaveOneOut> diagnostics;
+        if (MGEN::MVEM::ComputeLeaveOneOut(computed->inlier_image_points, computed->inlier_ground_points, diagnostics,
+                                           computed->leave_one_out_reference_rms)) {
+            constexpr float NO_VALUE = std::numeric_limits<float>::quiet_NaN();
+            computed->leave_one_out.assign(survey_pairs.size(), MGEN::MVEM::LeaveOneOut{NO_VALUE, NO_VALUE, NO_VALUE});
+            for (size_t k = 0; k < inlier_pair_index.size(); ++k) {
+                computed->leave_one_out[inlier_pair_index[k]] = diagnostics[k];
+            }
+            computed->leave_one_out_points = inlier_pair_index.size();
+        } else {
+            MLOG_WARN("Leave-one-out diagnostics skipped (%zu inlier point pairs, minimum 5 required).", inlier_pair_index.size());
+        }
+    }
+    result_cache_.Insert(cache_key, computed);
+
+    outcome.result = std::move(computed);
+    return outcome;
+}
+
+std::vector<json> HomographyCalculator::calculateBatch(const std::vector<CalculationJob>& jobs) {
+    std::vector<json> results(jobs.size());
+    if (jobs.empty()) {
+        return results;
+    }
+    MLOG_INFO("Calculating %zu homography job(s) in parallel.", jobs.size());
+
+    // 작업 하나가 한 청크. 각 청크는 자기 결과 슬롯에만 쓰므로 순서가 유지됨
+    MGEN::WorkerPool::Shared().ParallelFor(jobs.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const CalculationJob& job = jobs[i];
+            try {
+                results[i] = calculateWithProvidedData(*job.calibration_config_json, *job.survey_data_json, job.model_id,
+                                                       job.estimator_json ? *job.estimator_json : nlohmann::json(),
+                                                       job.diagnostics_json ? *job.diagnostics_json : nlohmann::json());
+            } catch (const std::exception& e) { // ParallelFor 본문은 예외를 던지면 안 됨
+                MLOG_ERROR("Exception in batch homography job %zu: %s", i, e.what());
+                results[i] = {{"success", false}, {"error", "Homography calculation processing failed on server."},
+                              {"details", e.what()}, {"status_code", 500}};
+            }
+        }
+    });
+    return results;
+}
+
+void HomographyCalculator::addPointResults(json& result_json, const MGEN::MVEM::ResultCache::Result& result,
+                                           const std::vector<size_t>& canonical_order, const std::vector<size_t>& survey_item_index,
+                                           size_t survey_object_count) const {
+    constexpr float NO_VALUE = std::numeric_limits<float>::quiet_NaN();
+    std::vector<int> inlier_mask(survey_object_count, 0);
+    std::vector<float> forward(survey_object_count, NO_VALUE);
+    std::vector<float> backward(survey_object_count, NO_VALUE);
+    size_t inlier_count = 0;
+    for (size_t k = 0; k < canonical_order.size(); ++k) {
+        const size_t item = survey_item_index[canonical_order[k]];
+        if (k < result.inlier_mask.size() && result.inlier_mask[k] != 0) {
+            inlier_mask[item] = 1;
+            ++inlier_count;
+        }
+        if (k < result.forward_errors.size()) {
+            forward[item] = result.forward_errors[k];
+            backward[item] = result.backward_errors[k];
+        }
+    }
+    result_json["inlier_mask"] = inlier_mask;
+    result_json["inlier_count"] = inlier_count;
+    if (result.iterations != MGEN::MVEM::ITERATIONS_NOT_MEASURED) { // OpenCV 추정기는 반복 횟수를 알 수 없으므로 생략
+        result_json["iterations"] = result.iterations;
+    }
+
+    // 대응점별 오차 ("data" 배열 순서, 값이 없으면 null) + 전체/인라이어 요약
+    // forward(지상 좌표 단위)와 backward(보정된 픽셀 단위)는 단위가 달라 합치지 않고 따로 보고
+    MGEN::MVEM::ErrorSummary summary[2][2]; // [forward, backward][all, inliers]
+    json forward_json = json::array(), backward_json = json::array();
+    for (size_t i = 0; i < survey_object_count; ++i) {
+        const double values[2] = {forward[i], backward[i]};
+        json* arrays[2] = {&forward_json, &backward_json};
+        for (int m = 0; m < 2; ++m) {
+            if (std::isfinite(values[m])) {
+                arrays[m]->push_back(values[m]);
+            } else {
+                arrays[m]->push_back(nullptr);
+            }
+            summary[m][0].Add(values[m]);
+            if (inlier_mask[i] != 0) {
+                summary[m][1].Add(values[m]);
+            }
+        }
+    }
+    result_json["point_errors"] = {
+        {"forward", std::move(forward_json)},
+        {"backward", std::move(backward_json)}
+    };
+
+    json summary_json;
+    const char* metric_names[2] = {"forward", "backward"};
+    const char* subset_names[2] = {"all", "inliers"};
+    for (int m = 0; m < 2; ++m) {
+        for (int subset = 0; subset < 2; ++subset) {
+            MGEN::MVEM::ErrorSummary& stats = summary[m][subset];
+            stats.Finish();
+            summary_json[metric_names[m]][subset_names[subset]] = {
+                {"count", stats.count}, {"rms", stats.rms}, {"mean", stats.mean}, {"max", stats.max}
+            };
+        }
     }
-    MLOG_INFO("Homography matrix calculated successfully.");
+    result_json["error_summary"] = std::move(summary_json);
 
+    // leave-one-out 진단 (요청했고 계산된 경우만)
+    if (!result.leave_one_out.empty()) {
+        json prediction_json = json::array(), rms_without_json = json::array(), influence_json = json::array();
+        std::vector<const MGEN::MVEM::LeaveOneOut*> by_item(survey_object_count, nullptr);
+        for (size_t k = 0; k < canonical_order.size() && k < result.leave_one_out.size(); ++k) {
+            by_item[survey_item_index[canonical_order[k]]] = &result.leave_one_out[k];
+        }
+        json most_influential = nullptr;
+        float max_influence = -1.0f;
+        for (size_t i = 0; i < survey_object_count; ++i) {
+            const float values[3] = {by_item[i] ? by_item[i]->prediction_error : NO_VALUE,
+                                     by_item[i] ? by_item[i]->rms_without : NO_VALUE,
+                                     by_item[i] ? by_item[i]->influence : NO_VALUE};
+            json* arrays[3] = {&prediction_json, &rms_without_json, &influence_json};
+            for (int m = 0; m < 3; ++m) {
+                if (std::isfinite(values[m])) {
+                    arrays[m]->push_back(values[m]);
+                } else {
+                    arrays[m]->push_back(nullptr);
+                }
+            }
+            if (std::isfinite(values[2]) && values[2] > max_influence) {
+                max_influence = values[2];
+                most_influential = i;
+            }
+        }
+        result_json["leave_one_out"] = {
+            {"basis", "inliers"},
+            {"points", result.leave_one_out_points},
+            {"reference_rms", result.leave_one_out_reference_rms},
+            {"prediction_error", std::move(prediction_json)},
+            {"rms_without", std::move(rms_without_json)},
+            {"influence", std::move(influence_json)},
+            {"most_influential", std::move(most_influential)}
+        };
+    }
+}
+
+json HomographyCalculator::finishCalculation(json result_json,
+                                             const std::shared_ptr<const MGEN::MVEM::Calibrator>& calibrator,
+                                             const MGEN::MVEM::ResultCache::Result& result,
+                                             const std::string& model_id) {
     // 4. 결과 JSON 구성
     result_json["success"] = true;
-    result_json["homography_matrix"] = homographyMatrixToJson(homography_matrix); // 변환 함수 사용
-    result_json["points_used_for_homography"] = camera_points_for_homography.size();
+    result_json["homography_matrix"] = homographyMatrixToJson(cv::Mat(result.homography)); // 변환 함수 사용
+    result_json["points_used_for_homography"] = result.points_used;
+    result_json["solver_path"] = MGEN::MVEM::HomographyEstimator::PathName(result.solver_path);
+
+    // 5. 모델 등록 (model_id가 지정된 경우): 이후 투영 요청은 ID만으로 이 모델을 사용
+    if (!model_id.empty()) {
+        if (!result.invertible) {
+            result_json["success"] = false;
+            result_json["error"] = "Calculated homography is singular and cannot be stored as a model.";
+            MLOG_ERROR("Singular homography for model '%s'.", model_id.c_str());
+            return result_json;
+        }
+        auto model = std::make_shared<MGEN::MVEM::HomographyModel>();
+        model->id = model_id;
+        model->calibrator = calibrator;
+        model->homography = result.homography;
+        model->inverse_homography = result.inverse_homography;
+        model->inlier_image_points = result.inlier_image_points;
+        model->inlier_ground_points = result.inlier_ground_points;
+        model->survey_points = result.points_used;
+        result_json["model_id"] = model_id;
+        result_json["inliers"] = model->inlier_image_points.size();
+        result_json["model_version"] = model_registry_.Publish(std::move(model));
+    }
 
     return result_json;
 }
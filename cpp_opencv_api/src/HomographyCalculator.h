@@ -3,8 +3,18 @@
 #pragma once
 
 #include "Calibrator.h"      // 사용자 제공: MGEN::MVEM::Calibrator
+#include "CalibratorCache.h" // 파라미터 해시 기반 Calibrator 인스턴스 캐시
+#include "ImageUndistorter.h" // 카메라별 remap 맵 캐시 + 병렬 이미지 왜곡 보정
+#include "HomographyEstimator.h" // 호모그래피 추정 방식 선택 (자동 / OpenCV 강건 추정기 / 자체 DLT, RANSAC)
+#include "HomographySession.h" // 증분 호모그래피 편집 세션 (포인트 단위 추가/이동/삭제)
+#include "ModelRegistry.h"    // 모델 ID -> 호모그래피 모델 (Calibrator, H, H^-1, 인라이어)
+#include "ResultCache.h"      // 정규화된 요청 내용 -> 호모그래피 계산 결과 (LRU/TTL)
+#include "SingleFlight.h"     // 동시에 들어온 동일 요청 병합
 #include "json/json.hpp"     // nlohmann/json 라이브러리
 #include <opencv2/opencv.hpp> // OpenCV (cv::Mat, cv::findHomography 등)
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <string>
 #include <vector>
 #include <optional> // std::optional (Calibrator.Calibrate 반환 타입)
@@ -45,12 +55,211 @@ public:
      * 일반적으로 "data"라는 키 아래에 각 포인트 쌍을 나타내는 객체 배열이 있을 것으로 예상합니다.
      * 각 포인트 객체는 카메라 좌표와 지상 좌표를 포함해야 합니다. (예: "camera_coords": [x,y], "ground_coords": [x,y])
      *
+     * @param model_id              (선택) 지정하면 계산된 모델(Calibrator, H, H^-1, 인라이어)을 이 ID로 등록합니다.
+     * 같은 ID의 모델이 있으면 교체합니다. 이후 투영 요청은 ID만으로 이 모델을 사용할 수 있습니다.
+     * @param estimator_json        (선택) 추정 방식 {"method": "ransac" | "lmeds" | "rho" | "usac_default" | "usac_parallel" | "usac_fast" |
+     * "usac_accurate" | "usac_prosac" | "usac_magsac" | "dlt" | "parallel_ransac", "threshold": 3.0, "confidence": 0.995,
+     * "max_iterations": 2000, "refine_iterations": 10, "seed": N}. 생략하면 "auto"(임계값 3.0): 4쌍은 닫힌 형식,
+     * 8쌍 이하의 깨끗한 포인트는 최소제곱, 그 밖에는 OpenCV RANSAC (HomographyEstimator::Estimate 참고).
+     * "dlt"는 할당 없는 자체 최소제곱 추정(아웃라이어 제거 없음)이고, "parallel_ransac"은 대량 대응점용 자체 병렬 RANSAC
+     * (고정 시드로 결정적, HomographyRansac.h)입니다.
+     * @param diagnostics_json      (선택) 추가 진단 {"leave_one_out": true}. 반환한 모델의 인라이어가 5쌍 이상이면 인라이어마다 그 포인트를 뺀
+     * 인라이어 DLT 해로 진단 값을 계산합니다 (MGEN::MVEM::ComputeLeaveOneOut 참고). 기준 해는 인라이어 전체의 LM 보정 없는 DLT 해이므로
+     * 반환한 호모그래피와 조금 다를 수 있으며, 아웃라이어는 기준 해를 오염시키지 않도록 제외합니다.
+     *
      * @return 계산 결과를 담은 JSON 객체를 반환합니다.
      * 성공 시: {"success": true, "homography_matrix": [[h11,h12,h13],[h21,h22,h23],[h31,h32,h33]], "points_used_for_homography": N}
+     * (model_id 지정 시 "model_id", "inliers", "model_version" 추가, 성공 시 결과 캐시 적중 여부 "result_cache_hit", 사용한 방식 "estimator")
+     * 성공 시 실제 풀이 경로 "solver_path" ("closed_form_4pt" | "least_squares" | "robust"),
+     * "data" 배열 순서의 "inlier_mask" (0/1, 보정 실패/건너뛴 항목은 0), "inlier_count", 측정한 반복 횟수 "iterations" (OpenCV 추정기는 생략, HomographyEstimator::Estimate 참고),
+     * 포인트별 재투영 오차 "point_errors": {"forward": [지상 좌표 단위], "backward": [보정된 픽셀 단위]}
+     * (보정 실패/건너뛴 항목은 null, 단위가 달라 둘을 합친 값은 제공하지 않음)와
+     * 요약 "error_summary": {"forward" | "backward": {"all" | "inliers": {"count", "rms", "mean", "max"}}} 포함.
+     * leave-one-out 진단을 요청하면 "leave_one_out": {"basis": "inliers", "points": 사용한 인라이어 수, "reference_rms": 인라이어 DLT 해의 RMS,
+     * "prediction_error": [...], "rms_without": [...], "influence": [...], "most_influential": "data" 인덱스} 추가
+     * (값은 지상 좌표 단위, 아웃라이어/계산하지 못한 항목은 null).
+     * 서베이 포인트는 정렬된 순서로 계산하며, 같은 파라미터/포인트 집합의 결과는 캐시에서 바로 반환합니다.
+     * 같은 요청이 동시에 들어오면 한 번만 계산하고 나머지는 그 결과를 공유합니다 ("request_coalesced": true).
      * 실패 시: {"success": false, "error": "에러 메시지"}
      */
     json calculateWithProvidedData(const nlohmann::json& calibration_config_json,
-                                   const nlohmann::json& survey_data_json);
+                                   const nlohmann::json& survey_data_json,
+                                   const std::string& model_id = std::string(),
+                                   const nlohmann::json& estimator_json = nlohmann::json(),
+                                   const nlohmann::json& diagnostics_json = nlohmann::json());
+
+    /**
+     * @brief calculateBatch의 작업 하나. JSON은 호출이 끝날 때까지 호출자가 소유합니다.
+     */
+    struct CalculationJob {
+        const nlohmann::json* calibration_config_json = nullptr; // calculateWithProvidedData의 calibration_config_json
+        const nlohmann::json* survey_data_json = nullptr;        // calculateWithProvidedData의 survey_data_json
+        std::string model_id;                                    // (선택) 등록할 모델 ID
+        const nlohmann::json* estimator_json = nullptr;          // (선택) 추정 방식
+        const nlohmann::json* diagnostics_json = nullptr;        // (선택) 추가 진단
+    };
+
+    /**
+     * @brief 여러 카메라의 호모그래피를 공용 워커 풀에서 병렬로 계산합니다.
+     * 작업마다 calculateWithProvidedData와 같은 결과를 입력 순서대로 반환하며,
+     * 한 작업의 실패(예외 포함)는 그 작업의 결과에만 영향을 줍니다.
+     * 결과 캐시와 동일 요청 병합은 작업 사이에도 적용됩니다.
+     *
+     * @param jobs 계산할 작업 목록.
+     * @return jobs와 같은 길이/순서의 결과 JSON 배열.
+     */
+    std::vector<json> calculateBatch(const std::vector<CalculationJob>& jobs);
+
+    /**
+     * @brief 왜곡된 카메라 픽셀 좌표 배열을 지상 좌표로 일괄 투영합니다.
+     * 왜곡 보정 -> 호모그래피 곱 -> 원근 나눗셈을 하나의 SIMD 커널로 수행하며(Calibrator::ProjectBatchParallel),
+     * 포인트별 결과 상태를 함께 반환합니다.
+     *
+     * @param calibration_config_json Calibrator 생성용 JSON (calculateWithProvidedData와 동일한 구조).
+     * @param homography_json         보정된 픽셀 -> 지상 좌표 호모그래피 (3x3 배열, calculate_dynamic의 "homography_matrix").
+     * @param points_json             입력 포인트 (SoA): {"x": [x1, x2, ...], "y": [y1, y2, ...]}
+     *
+     * @return 처리 결과를 담은 JSON 객체.
+     * 성공 시: {"success": true, "ground": {"x": [...], "y": [...]}, "status": [0, 0, 1, ...], "points_projected": N, "points_failed": M}
+     * status 값: 0 = 성공, 1 = 왜곡 보정 미수렴, 2 = 소실선 위의 점 (실패한 포인트의 좌표는 null)
+     * 실패 시: {"success": false, "error": "에러 메시지"}
+     */
+    json projectPoints(const nlohmann::json& calibration_config_json,
+                       const nlohmann::json& homography_json,
+                       const nlohmann::json& points_json);
+
+    /**
+     * @brief 등록된 모델로 포인트를 투영합니다. (projectPoints와 같은 결과 형식, "model_id", "model_version" 추가)
+     * "model_version"은 결과를 계산한 모델의 버전이므로, 처리 중 모델이 교체되어도 어느 모델의 결과인지 알 수 있습니다.
+     * 모델이 없으면 {"success": false, "status_code": 404, ...}.
+     */
+    json projectPointsWithModel(const std::string& model_id, const nlohmann::json& points_json);
+
+    /**
+     * @brief 지상 좌표 배열을 왜곡된 카메라 픽셀 좌표로 일괄 역투영합니다. (projectPoints의 역)
+     * 역호모그래피 -> 왜곡 모델 적용을 반복 없는 SIMD 커널로 수행합니다(Calibrator::UnprojectBatchParallel).
+     * 지상 영역/격자를 실시간 영상 위에 그리는 용도입니다.
+     *
+     * @param calibration_config_json Calibrator 생성용 JSON.
+     * @param homography_json         보정된 픽셀 -> 지상 좌표 호모그래피 (projectPoints와 같은 행렬, 내부에서 역행렬 계산).
+     * @param points_json             지상 좌표 (SoA): {"x": [...], "y": [...]}
+     *
+     * @return 성공 시: {"success": true, "image": {"x": [...], "y": [...]}, "status": [...], "points_projected": N, "points_failed": M}
+     * status 값: 0 = 성공, 2 = 영상의 무한원점으로 가는 점, 4 = 왜곡 모델이 접히는 반경 밖 (실패한 포인트의 좌표는 null)
+     * 실패 시: {"success": false, "error": "에러 메시지"}
+     */
+    json unprojectPoints(const nlohmann::json& calibration_config_json,
+                         const nlohmann::json& homography_json,
+                         const nlohmann::json& points_json);
+
+    /**
+     * @brief 등록된 모델로 지상 좌표를 역투영합니다. (unprojectPoints와 같은 결과 형식, "model_id", "model_version" 추가)
+     * 모델이 없으면 {"success": false, "status_code": 404, ...}.
+     */
+    json unprojectPointsWithModel(const std::string& model_id, const nlohmann::json& points_json);
+
+    /**
+     * @brief 등록된 모델 목록을 반환합니다.
+     * 예: {"success": true, "models": [{"model_id": "cam-01", "model_version": V, "homography_matrix": [...], "inliers": N, "survey_points": M}]}
+     */
+    json listModels() const;
+
+    /**
+     * @brief 등록된 모델을 삭제합니다.
+     * @return 삭제했으면 true, 없는 ID면 false.
+     */
+    bool removeModel(const std::string& model_id);
+
+    /**
+     * @brief 모델 레지스트리 스냅샷 파일을 사용합니다. (서버 시작 전에 호출)
+     * 파일이 있으면 mmap으로 읽어 모든 모델을 복원하고, 이후 모델 등록/삭제 때마다 파일을 갱신합니다.
+     * 재시작 직후에도 Node 앱이 캘리브레이션/서베이를 다시 보내지 않고 바로 model_id로 투영할 수 있습니다.
+     * @param snapshot_path 스냅샷 파일 경로.
+     * @return 복원한 모델 수.
+     */
+    size_t restoreModels(const std::string& snapshot_path);
+
+    /**
+     * @brief 증분 편집 세션을 만듭니다. (주석 UI에서 포인트를 하나씩 고치며 결과를 바로 확인하는 용도)
+     * 세션은 보정된 포인트와 정규화된 DLT 정규 방정식을 메모리에 유지하므로, 이후 포인트 하나의 편집은
+     * 전체 재계산 없이 랭크 2 갱신 + 9x9 고유값 분해로 수 마이크로초 안에 새 호모그래피를 돌려줍니다.
+     * 일정 시간(30분) 사용하지 않은 세션은 정리됩니다.
+     *
+     * @param calibration_config_json Calibrator 생성용 JSON (calculateWithProvidedData와 동일한 구조).
+     * @param survey_data_json        (선택) 초기 서베이 포인트 ({"data": [...]}, calculateWithProvidedData와 동일). null이면 빈 세션.
+     * @param estimator_json          (선택) refitSession에 사용할 추정 방식 (calculate_dynamic의 "estimator"와 같은 형식). null이면 기본값(Auto).
+     *
+     * @return 성공 시: {"success": true, "session_id": "...", "estimator": "auto" | ..., "revision": R, "homography_matrix": [...] | null,
+     *                   "points": N, "active_points": A, "rms_error": e, "solve_us": us,
+     *                   "survey_points": [{"point_id": id, "camera_coords": [x,y], "ground_coords": [gx,gy], "inlier": bool}, ...]}
+     * homography_matrix는 DLT 최소제곱 해이며, 활성 포인트가 4개 미만이면 null.
+     * 실패 시: {"success": false, "error": "...", "status_code": 400 | 429}
+     */
+    json createSession(const nlohmann::json& calibration_config_json, const nlohmann::json& survey_data_json,
+                       const nlohmann::json& estimator_json = nlohmann::json());
+
+    /**
+     * @brief 세션의 현재 상태를 반환합니다. (createSession과 같은 형식, 없으면 status_code 404)
+     */
+    json getSession(const std::string& session_id);
+
+    /**
+     * @brief 세션을 삭제합니다.
+     * @return 삭제했으면 true, 없는 ID면 false.
+     */
+    bool deleteSession(const std::string& session_id);
+
+    /**
+     * @brief 세션 편집: 포인트 추가 / 이동 / 삭제.
+     * point_json: {"camera_coords": [x, y], "ground_coords": [gx, gy]}
+     * @return 성공 시: {"success": true, "session_id": "...", "point_id": id, "revision": R, "homography_matrix": [...] | null,
+     *                   "points": N, "active_points": A, "rms_error": e, "solve_us": us}
+     * 실패 시: {"success": false, "error": "...", "status_code": 400 | 404 | 422}
+     */
+    json addSessionPoint(const std::string& session_id, const nlohmann::json& point_json);
+    json updateSessionPoint(const std::string& session_id, uint64_t point_id, const nlohmann::json& point_json);
+    json removeSessionPoint(const std::string& session_id, uint64_t point_id);
+
+    /**
+     * @brief 세션의 전체 포인트로 세션 생성 시 지정한 추정 방식(HomographyEstimator) 재계산을 수행합니다. (요청할 때만 수행하는 전체 재계산)
+     * 포인트는 calculate_dynamic과 같은 정렬 순서로 추정하므로, 같은 포인트/estimator의 calculate_dynamic과 같은 결과입니다.
+     * 인라이어 판정 결과가 세션에 반영되어 이후 편집은 인라이어만으로 계산합니다.
+     *
+     * @param model_id (선택) 지정하면 calculateWithProvidedData와 같이 결과를 모델로 등록합니다.
+     * @return 성공 시: getSession 형식 + 재계산 결과 ("ransac_homography_matrix", "points_used_for_homography", "solver_path",
+     *                  model_id 지정 시 "model_id", "inliers", "model_version")
+     */
+    json refitSession(const std::string& session_id, const std::string& model_id = std::string());
+
+    /**
+     * @brief 왜곡된 카메라 이미지 전체를 보정된 이미지로 변환합니다.
+     * remap 맵은 카메라 파라미터와 이미지 크기별로 캐시되므로, 같은 카메라의 반복 요청은 remap 비용만 듭니다.
+     *
+     * @param calibration_config_json Calibrator 생성용 JSON (calculateWithProvidedData와 동일한 구조).
+     * @param image_bytes             인코딩된 입력 이미지 (PNG, JPEG 등 OpenCV가 디코딩할 수 있는 형식).
+     * @param output_format           출력 인코딩 확장자 (".png" 또는 ".jpg").
+     * @param output_bytes            [출력] 인코딩된 보정 이미지.
+     *
+     * @return 처리 결과를 담은 JSON 객체.
+     * 성공 시: {"success": true, "width": W, "height": H, "remap_cache_hit": bool, "content_type": "image/png"}
+     * 실패 시: {"success": false, "error": "에러 메시지"}
+     */
+    json undistortImage(const nlohmann::json& calibration_config_json,
+                        const std::string& image_bytes,
+                        const std::string& output_format,
+                        std::vector<unsigned char>& output_bytes);
+
+    /**
+     * @brief 내부 캐시 등 런타임 통계를 JSON 객체로 반환합니다.
+     * 예: {"calibrator_cache": {"hits": N, "misses": M, "hit_ratio": r, "size": S, "capacity": C, "evictions": E,
+     *                            "constructions": 생성 횟수, "coalesced_misses": 다른 호출의 생성을 기다린 동시 미스 수},
+     *      "remap_cache": {...}, "result_cache": {..., "expirations": X, "bytes": B, "max_bytes": M},
+     *      "coalescing": {"leaders": L, "coalesced": C, "in_flight": F}, "models": {"count": N, "version": V, "reclaimed_snapshots": R, "last_grace_period_us": us,
+     *      "snapshot_writes": W, "snapshot_errors": F, "restored": M, "restore_ms": ms},
+     *      "sessions": {"count": N},
+     *      "solver_paths": {"closed_form_4pt": {"count": N, "mean_us": us, "max_us": us}, "least_squares": {...}, "robust": {...}}}
+     */
+    json getStatistics() const;
 
 private:
     /**
@@ -79,5 +288,109 @@ private:
      * @return 호모그래피 행렬의 JSON 배열 표현.
      * 입력 행렬이 유효하지 않거나 비어있으면 빈 JSON 배열을 반환합니다.
      */
-    json homographyMatrixToJson(const cv::Mat& matrix);
+    json homographyMatrixToJson(const cv::Mat& matrix) const;
+
+    /**
+     * @brief JSON 3x3 배열을 호모그래피 행렬로 변환합니다. (homographyMatrixToJson의 역)
+     *
+     * @param json_matrix 3개의 행 배열, 각 행은 3개의 숫자.
+     * @param matrix      [출력] 변환된 행렬.
+     *
+     * @return 형식이 올바르고 모든 값이 유한하면 true.
+     */
+    bool jsonToHomographyMatrix(const nlohmann::json& json_matrix, cv::Matx33d& matrix) const;
+
+    /**
+     * @brief SoA 형식의 좌표 JSON({"x": [...], "y": [...]})을 float 배열로 변환합니다.
+     *
+     * @param points_json 좌표 JSON 객체.
+     * @param xs, ys      [출력] 좌표 배열.
+     * @param error       [출력] 실패 시 에러 메시지.
+     *
+     * @return 두 배열의 길이가 같고 모든 값이 숫자이면 true.
+     */
+    bool jsonToPointArrays(const nlohmann::json& points_json, std::vector<float>& xs, std::vector<float>& ys,
+                           std::string& error) const;
+
+    /**
+     * @brief 주어진 Calibrator와 호모그래피로 포인트를 투영/역투영합니다. (projectPoints / unprojectPoints 공용 구현)
+     */
+    json projectWith(const MGEN::MVEM::Calibrator& calibrator, const cv::Matx33d& homography, const nlohmann::json& points_json);
+    json unprojectWith(const MGEN::MVEM::Calibrator& calibrator, const cv::Matx33d& inverse_homography, const nlohmann::json& points_json);
+
+    /**
+     * @brief 서베이 포인트 보정 + 호모그래피 추정 결과. result가 nullptr이면 failure에 에러 JSON.
+     */
+    struct CalculationOutcome {
+        std::shared_ptr<const MGEN::MVEM::ResultCache::Result> result;
+        json failure;
+    };
+
+    /**
+     * @brief 정렬된 서베이 포인트를 왜곡 보정하고 선택된 방식으로 호모그래피를 추정한 뒤 결과 캐시에 저장합니다.
+     * 동일 요청 병합의 리더만 호출합니다.
+     */
+    CalculationOutcome computeCalculation(const MGEN::MVEM::Calibrator& calibrator,
+                                          const std::vector<MGEN::MVEM::SurveyPair>& survey_pairs,
+                                          size_t survey_object_count,
+                                          const MGEN::MVEM::HomographyEstimatorOptions& estimator_options,
+                                          bool leave_one_out, const std::string& cache_key);
+
+    /**
+     * @brief 계산 결과(새로 계산했거나 캐시에서 찾은 것)로 응답을 완성하고, model_id가 있으면 모델을 등록합니다.
+     */
+    json finishCalculation(json result_json, const std::shared_ptr<const MGEN::MVEM::Calibrator>& calibrator,
+                           const MGEN::MVEM::ResultCache::Result& result, const std::string& model_id);
+
+    /**
+     * @brief 정렬 순서로 저장된 포인트별 결과(인라이어 여부, 재투영 오차)를 요청의 "data" 배열 순서로 되돌려 응답에 추가합니다.
+     * (inlier_mask, inlier_count, iterations, point_errors, error_summary, 계산했다면 leave_one_out) 객체가 아니어서 건너뛴 항목은 0/null입니다.
+     * @param canonical_order   정렬 후 k번째 쌍의 파싱 순서 인덱스 (ResultCache::Canonicalize 출력)
+     * @param survey_item_index 파싱 순서 i번째 쌍의 "data" 배열 인덱스
+     */
+    void addPointResults(json& result_json, const MGEN::MVEM::ResultCache::Result& result,
+                         const std::vector<size_t>& canonical_order, const std::vector<size_t>& survey_item_index,
+                         size_t survey_object_count) const;
+
+    /**
+     * @brief 풀이 경로별 지연 시간 통계에 한 번의 추정 시간을 더합니다. (스레드 안전)
+     */
+    void recordSolverLatency(MGEN::MVEM::HomographySolverPath path, std::chrono::steady_clock::duration elapsed);
+
+    /**
+     * @brief {"camera_coords": [x, y], "ground_coords": [gx, gy]} 형식의 포인트 JSON을 엄격하게 파싱합니다.
+     * (getCoordFromJsonArray와 달리 누락/형식 오류를 (0,0)으로 대체하지 않고 실패로 처리)
+     */
+    bool jsonToSurveyPair(const nlohmann::json& point_json, MGEN::MVEM::SurveyPair& pair, std::string& error) const;
+
+    /**
+     * @brief 세션의 현재 해를 응답 JSON으로 만듭니다. include_points이면 포인트 목록을 포함합니다.
+     */
+    json sessionToJson(MGEN::MVEM::HomographySession& session, bool include_points) const;
+
+    // 카메라 파라미터 해시를 키로 Calibrator 인스턴스를 재사용하는 캐시 (스레드 안전)
+    MGEN::MVEM::CalibratorCache calibrator_cache_;
+
+    // 카메라 파라미터 + 이미지 크기를 키로 remap 맵을 재사용하는 캐시 (스레드 안전)
+    MGEN::MVEM::ImageUndistorter image_undistorter_;
+
+    // 정규화된 calculate_dynamic 요청 -> 계산 결과 캐시 (스레드 안전)
+    MGEN::MVEM::ResultCache result_cache_;
+
+    // 결과 캐시 키 -> 진행 중인 계산 (같은 요청이 동시에 오면 한 번만 계산)
+    MGEN::SingleFlight<std::string, CalculationOutcome> inflight_calculations_;
+
+    // 모델 ID로 등록된 호모그래피 모델 (조회는 쓰기 잠금 없음)
+    MGEN::MVEM::ModelRegistry model_registry_;
+
+    // 세션 ID -> 증분 편집 세션 (스레드 안전, 유휴 세션 자동 정리)
+    MGEN::MVEM::SessionStore sessions_;
+
+    // 풀이 경로별 추정 횟수/지연 시간 (결과 캐시 적중은 제외)
+    struct SolverLatency {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> max_ns{0};
+    };
+    std::array<SolverLatency, static_cast<size_t>(MGEN::MVEM::HomographySolverPath::COUNT)> solver_latency_;
 };
@@ -0,0 +1,582 @@
+#include "HomographyDlt.h"
+
+// STL::C++
+#include <algorithm>
+#include <cmath>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    //--------------------------------------------------------------------------
+    // 함수: FromPoints
+    // 설명: 중심과 평균 거리로 Hartley 정규화를 만듭니다.
+    //--------------------------------------------------------------------------
+    PointNormalization PointNormalization::FromPoints( const std::vector<cv::Point2f>& points ) noexcept
+    {
+        return FromPoints( points.data(), points.size() );
+    }
+
+    PointNormalization PointNormalization::FromPoints( const cv::Point2f* points, size_t count ) noexcept
+    {
+        PointNormalization norm;
+        if( count == 0 ) {
+            return norm;
+        }
+
+        double sx = 0.0, sy = 0.0;
+        for( size_t i = 0; i < count; ++i ) {
+            sx += points[ i ].x;
+            sy += points[ i ].y;
+        }
+        norm.cx = sx / static_cast<double>( count );
+        norm.cy = sy / static_cast<double>( count );
+
+        double dist = 0.0;
+        for( size_t i = 0; i < count; ++i ) {
+            dist += std::hypot( points[ i ].x - norm.cx, points[ i ].y - norm.cy );
+        }
+        dist /= static_cast<double>( count );
+        norm.scale = ( dist > 1e-12 ) ? std::sqrt( 2.0 ) / dist : 1.0;
+        return norm;
+    }
+
+    cv::Matx33d PointNormalization::Matrix() const noexcept
+    {
+        return cv::Matx33d( scale, 0.0, -scale * cx,
+                            0.0, scale, -scale * cy,
+                            0.0, 0.0, 1.0 );
+    }
+
+    cv::Matx33d PointNormalization::Inverse() const noexcept
+    {
+        const double inv = 1.0 / scale;
+        return cv::Matx33d( inv, 0.0, cx,
+                            0.0, inv, cy,
+                            0.0, 0.0, 1.0 );
+    }
+
+    void DltSystem::Reset() noexcept
+    {
+        std::fill( m, m + N * N, 0.0 );
+        pair_count = 0;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Accumulate
+    // 설명: 두 DLT 행 r1, r2에 대해 M += weight * (r1 r1^T + r2 r2^T). (81회 곱셈-덧셈)
+    //--------------------------------------------------------------------------
+    void DltSystem::Accumulate( const cv::Point2d& src, const cv::Point2d& dst, double weight ) noexcept
+    {
+        const double x = src.x, y = src.y, u = dst.x, v = dst.y;
+        const double r1[ N ] = { x, y, 1.0, 0.0, 0.0, 0.0, -u * x, -u * y, -u };
+        const double r2[ N ] = { 0.0, 0.0, 0.0, x, y, 1.0, -v * x, -v * y, -v };
+
+        for( int i = 0; i < N; ++i ) {
+            const double a = weight * r1[ i ];
+            const double b = weight * r2[ i ];
+            for( int j = 0; j < N; ++j ) {
+                m[ i * N + j ] += a * r1[ j ] + b * r2[ j ];
+            }
+        }
+        pair_count += ( weight > 0.0 ) ? 1 : -1;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: SmallestEigenJacobi (파일 내부)
+    // 설명: 순환 Jacobi 회전으로 대칭 행렬을 대각화한 뒤 최소 고유값의 고유벡터를 고릅니다.
+    //       고유값 간격과 무관하게 수렴하므로 역반복이 실패했을 때의 대체 경로로 사용합니다.
+    //--------------------------------------------------------------------------
+    static bool SmallestEigenJacobi( const double* m, double* eigenvector, double* min_eigenvalue ) noexcept
+    {
+        constexpr int N = DltSystem::N;
+        double a[ N * N ];
+        double vec[ N * N ]; // 열이 고유벡터
+        std::copy( m, m + N * N, a );
+        for( int i = 0; i < N * N; ++i ) {
+            vec[ i ] = ( i % ( N + 1 ) == 0 ) ? 1.0 : 0.0;
+        }
+
+        double scale = 0.0;
+        for( int i = 0; i < N * N; ++i ) {
+            scale = std::max( scale, std::abs( a[ i ] ) );
+        }
+        if( !( scale > 0.0 ) || !std::isfinite( scale ) ) {
+            return false;
+        }
+
+        constexpr int MAX_SWEEPS = 50;
+        for( int sweep = 0; sweep < MAX_SWEEPS; ++sweep )
+        {
+            double off = 0.0;
+            for( int p = 0; p < N; ++p ) {
+                for( int q = p + 1; q < N; ++q ) {
+                    off += a[ p * N + q ] * a[ p * N + q ];
+                }
+            }
+            if( off <= 1e-30 * scale * scale ) {
+                break;
+            }
+
+            for( int p = 0; p < N; ++p ) {
+                for( int q = p + 1; q < N; ++q )
+                {
+                    const double apq = a[ p * N + q ];
+                    if( std::abs( apq ) <= 1e-300 ) {
+                        continue;
+                    }
+                    const double theta = ( a[ q * N + q ] - a[ p * N + p ] ) / ( 2.0 * apq );
+                    const double t = ( theta >= 0.0 ? 1.0 : -1.0 ) / ( std::abs( theta ) + std::sqrt( theta * theta + 1.0 ) );
+                    const double c = 1.0 / std::sqrt( t * t + 1.0 );
+                    const double s = t * c;
+
+                    // A <- J^T A J (p, q 행/열만 바뀜)
+                    for( int k = 0; k < N; ++k ) {
+                        const double akp = a[ k * N + p ];
+                        const double akq = a[ k * N + q ];
+                        a[ k * N + p ] = c * akp - s * akq;
+                        a[ k * N + q ] = s * akp + c * akq;
+                    }
+                    for( int k = 0; k < N; ++k ) {
+                        const double apk = a[ p * N + k ];
+                        const double aqk = a[ q * N + k ];
+                        a[ p * N + k ] = c * apk - s * aqk;
+                        a[ q * N + k ] = s * apk + c * aqk;
+                    }
+                    for( int k = 0; k < N; ++k ) {
+                        const double vkp = vec[ k * N + p ];
+                        const double vkq = vec[ k * N + q ];
+                        vec[ k * N + p ] = c * vkp - s * vkq;
+                        vec[ k * N + q ] = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+
+        int best = 0;
+        for( int i = 1; i < N; ++i ) {
+            if( a[ i * N + i ] < a[ best * N + best ] ) {
+                best = i;
+            }
+        }
+        for( int i = 0; i < N; ++i ) {
+            const double value = vec[ i * N + best ];
+            if( !std::isfinite( value ) ) {
+                return false;
+            }
+            eigenvector[ i ] = value;
+        }
+        *min_eigenvalue = std::max( 0.0, a[ best * N + best ] );
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: SmallestEigenInverseIteration (파일 내부)
+    // 설명: M + sigma*I를 Cholesky 분해하고 역반복(inverse iteration)으로 최소 고유벡터를 구합니다.
+    //       DLT에서는 최소 고유값이 나머지보다 훨씬 작아 수 회 반복으로 수렴하며, Jacobi보다 수 배 빠릅니다.
+    //       분해 실패나 미수렴(고유값 간격이 작은 퇴화 배치)이면 false.
+    //--------------------------------------------------------------------------
+    static bool SmallestEigenInverseIteration( const double* m, double scale, double* eigenvector, double* min_eigenvalue ) noexcept
+    {
+        constexpr int N = DltSystem::N;
+        const double sigma = 1e-13 * scale;
+
+        double l[ N * N ];
+        for( int j = 0; j < N; ++j ) {
+            double d = m[ j * N + j ] + sigma;
+            for( int k = 0; k < j; ++k ) {
+                d -= l[ j * N + k ] * l[ j * N + k ];
+            }
+            if( !( d > 0.0 ) ) {
+                return false;
+            }
+            l[ j * N + j ] = std::sqrt( d );
+            for( int i = j + 1; i < N; ++i ) {
+                double s = m[ i * N + j ];
+                for( int k = 0; k < j; ++k ) {
+                    s -= l[ i * N + k ] * l[ j * N + k ];
+                }
+                l[ i * N + j ] = s / l[ j * N + j ];
+            }
+        }
+
+        double v[ N ];
+        for( int i = 0; i < N; ++i ) {
+            v[ i ] = 1.0 / 3.0;
+        }
+        constexpr int MAX_ITERATIONS = 40;
+        for( int iter = 0; iter < MAX_ITERATIONS; ++iter )
+        {
+            // (L L^T) w = v
+            double y[ N ], w[ N ];
+            for( int i = 0; i < N; ++i ) {
+                double s = v[ i ];
+                for( int k = 0; k < i; ++k ) {
+                    s -= l[ i * N + k ] * y[ k ];
+                }
+                y[ i ] = s / l[ i * N + i ];
+            }
+            for( int i = N - 1; i >= 0; --i ) {
+                double s = y[ i ];
+                for( int k = i + 1; k < N; ++k ) {
+                    s -= l[ k * N + i ] * w[ k ];
+                }
+                w[ i ] = s / l[ i * N + i ];
+            }
+
+            double norm = 0.0, dot = 0.0;
+            for( int i = 0; i < N; ++i ) {
+                norm += w[ i ] * w[ i ];
+            }
+            norm = std::sqrt( norm );
+            if( !( norm > 0.0 ) || !std::isfinite( norm ) ) {
+                return false;
+            }
+            for( int i = 0; i < N; ++i ) {
+                w[ i ] /= norm;
+                dot += w[ i ] * v[ i ];
+            }
+            std::copy( w, w + N, v );
+
+            // 방향이 더 이상 바뀌지 않으면 수렴 (부호는 무관)
+            if( iter > 0 && 1.0 - std::abs( dot ) < 1e-15 ) {
+                double rayleigh = 0.0;
+                for( int i = 0; i < N; ++i ) {
+                    double mv = 0.0;
+                    for( int k = 0; k < N; ++k ) {
+                        mv += m[ i * N + k ] * v[ k ];
+                    }
+                    rayleigh += v[ i ] * mv;
+                }
+                std::copy( v, v + N, eigenvector );
+                *min_eigenvalue = std::max( 0.0, rayleigh );
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Solve
+    // 설명: 최소 고유값의 고유벡터를 구합니다. 역반복을 먼저 시도하고, 실패하면 Jacobi로 대체합니다.
+    //       할당 없이 스택에서만 계산합니다.
+    //--------------------------------------------------------------------------
+    bool DltSystem::Solve( cv::Matx33d& h_normalized, double* min_eigenvalue ) const noexcept
+    {
+        if( pair_count < 4 ) {
+            return false;
+        }
+
+        double scale = 0.0;
+        for( int i = 0; i < N; ++i ) {
+            scale = std::max( scale, std::abs( m[ i * N + i ] ) );
+        }
+        if( !( scale > 0.0 ) || !std::isfinite( scale ) ) {
+            return false;
+        }
+
+        double eigenvector[ N ];
+        double eigenvalue = 0.0;
+        if( !SmallestEigenInverseIteration( m, scale, eigenvector, &eigenvalue ) &&
+            !SmallestEigenJacobi( m, eigenvector, &eigenvalue ) ) {
+            return false;
+        }
+        for( int i = 0; i < N; ++i ) {
+            h_normalized.val[ i ] = eigenvector[ i ];
+        }
+        if( min_eigenvalue != nullptr ) {
+            *min_eigenvalue = eigenvalue;
+        }
+        return true;
+    }
+
+    cv::Matx33d DenormalizeHomography( const cv::Matx33d& h_normalized, const PointNormalization& src,
+                                       const PointNormalization& dst ) noexcept
+    {
+        cv::Matx33d h = dst.Inverse() * h_normalized * src.Matrix();
+
+        double norm = 0.0;
+        for( int i = 0; i < 9; ++i ) {
+            norm += h.val[ i ] * h.val[ i ];
+        }
+        norm = std::sqrt( norm );
+        const double w = h.val[ 8 ];
+        const double divisor = ( std::abs( w ) > 1e-12 * norm ) ? w : norm;
+        if( divisor != 0.0 ) {
+            for( int i = 0; i < 9; ++i ) {
+                h.val[ i ] /= divisor;
+            }
+        }
+        return h;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: SolveCholesky8 (파일 내부)
+    // 설명: 8x8 대칭 양의 정부호 행렬 A로 A x = b를 풉니다. (A는 덮어씀)
+    //--------------------------------------------------------------------------
+    static bool SolveCholesky8( double a[ 64 ], const double b[ 8 ], double x[ 8 ] ) noexcept
+    {
+        constexpr int N = 8;
+        for( int j = 0; j < N; ++j ) {
+            double d = a[ j * N + j ];
+            for( int k = 0; k < j; ++k ) {
+                d -= a[ j * N + k ] * a[ j * N + k ];
+            }
+            if( !( d > 0.0 ) ) {
+                return false;
+            }
+            a[ j * N + j ] = std::sqrt( d );
+            for( int i = j + 1; i < N; ++i ) {
+                double s = a[ i * N + j ];
+                for( int k = 0; k < j; ++k ) {
+                    s -= a[ i * N + k ] * a[ j * N + k ];
+                }
+                a[ i * N + j ] = s / a[ j * N + j ];
+            }
+        }
+        double y[ N ];
+        for( int i = 0; i < N; ++i ) {
+            double s = b[ i ];
+            for( int k = 0; k < i; ++k ) {
+                s -= a[ i * N + k ] * y[ k ];
+            }
+            y[ i ] = s / a[ i * N + i ];
+        }
+        for( int i = N - 1; i >= 0; --i ) {
+            double s = y[ i ];
+            for( int k = i + 1; k < N; ++k ) {
+                s -= a[ k * N + i ] * x[ k ];
+            }
+            x[ i ] = s / a[ i * N + i ];
+        }
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ReprojectionCost (파일 내부)
+    // 설명: 정규화 좌표계에서 H(2,2) = 1인 8개 파라미터 h의 재투영 오차 제곱합.
+    //--------------------------------------------------------------------------
+    static double ReprojectionCost( const double h[ 8 ], const cv::Point2f* src, const cv::Point2f* dst, size_t count,
+                                    const PointNormalization& src_norm, const PointNormalization& dst_norm ) noexcept
+    {
+        double cost = 0.0;
+        for( size_t i = 0; i < count; ++i ) {
+            const cv::Point2d s = src_norm.Apply( src[ i ] );
+            const cv::Point2d d = dst_norm.Apply( dst[ i ] );
+            const double w  = h[ 6 ] * s.x + h[ 7 ] * s.y + 1.0;
+            const double du = ( h[ 0 ] * s.x + h[ 1 ] * s.y + h[ 2 ] ) / w - d.x;
+            const double dv = ( h[ 3 ] * s.x + h[ 4 ] * s.y + h[ 5 ] ) / w - d.y;
+            cost += du * du + dv * dv;
+        }
+        return cost;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: RefineLevenbergMarquardt (파일 내부)
+    // 설명: 정규화 좌표계에서 재투영 오차를 최소화합니다. 8x8 근사 헤시안(J^T J)을 스택에 누적하고
+    //       감쇠 계수 lambda로 가우스-뉴턴과 경사 하강 사이를 조절합니다. 수행한 반복 횟수를 반환합니다.
+    //--------------------------------------------------------------------------
+    static int RefineLevenbergMarquardt( double h[ 8 ], const cv::Point2f* src, const cv::Point2f* dst, size_t count,
+                                         const PointNormalization& src_norm, const PointNormalization& dst_norm,
+                                         int iterations ) noexcept
+    {
+        double cost   = ReprojectionCost( h, src, dst, count, src_norm, dst_norm );
+        double lambda = 1e-3;
+        int iter = 0;
+        for( ; iter < iterations && cost > 1e-24; ++iter )
+        {
+            double jtj[ 64 ] = {};
+            double jtr[ 8 ]  = {};
+            for( size_t i = 0; i < count; ++i ) {
+                const cv::Point2d s = src_norm.Apply( src[ i ] );
+                const cv::Point2d d = dst_norm.Apply( dst[ i ] );
+                const double inv_w = 1.0 / ( h[ 6 ] * s.x + h[ 7 ] * s.y + 1.0 );
+                const double u = ( h[ 0 ] * s.x + h[ 1 ] * s.y + h[ 2 ] ) * inv_w;
+                const double v = ( h[ 3 ] * s.x + h[ 4 ] * s.y + h[ 5 ] ) * inv_w;
+                const double ju[ 8 ] = { s.x * inv_w, s.y * inv_w, inv_w, 0.0, 0.0, 0.0, -u * s.x * inv_w, -u * s.y * inv_w };
+                const double jv[ 8 ] = { 0.0, 0.0, 0.0, s.x * inv_w, s.y * inv_w, inv_w, -v * s.x * inv_w, -v * s.y * inv_w };
+                const double ru = u - d.x, rv = v - d.y;
+                for( int r = 0; r < 8; ++r ) {
+                    jtr[ r ] += ju[ r ] * ru + jv[ r ] * rv;
+                    for( int c = 0; c <= r; ++c ) {
+                        jtj[ r * 8 + c ] += ju[ r ] * ju[ c ] + jv[ r ] * jv[ c ];
+                    }
+                }
+            }
+            for( int r = 0; r < 8; ++r ) {
+                for( int c = r + 1; c < 8; ++c ) {
+                    jtj[ r * 8 + c ] = jtj[ c * 8 + r ];
+                }
+            }
+
+            // 감쇠를 키워 가며 비용이 줄어드는 스텝을 찾음
+            bool improved = false;
+            while( !improved && lambda < 1e10 )
+            {
+                double a[ 64 ];
+                std::copy( jtj, jtj + 64, a );
+                for( int r = 0; r < 8; ++r ) {
+                    a[ r * 8 + r ] *= ( 1.0 + lambda );
+                    a[ r * 8 + r ] += 1e-12;
+                }
+                double neg_jtr[ 8 ], step[ 8 ], trial[ 8 ];
+                for( int r = 0; r < 8; ++r ) {
+                    neg_jtr[ r ] = -jtr[ r ];
+                }
+                if( SolveCholesky8( a, neg_jtr, step ) ) {
+                    for( int r = 0; r < 8; ++r ) {
+                        trial[ r ] = h[ r ] + step[ r ];
+                    }
+                    const double trial_cost = ReprojectionCost( trial, src, dst, count, src_norm, dst_norm );
+                    if( std::isfinite( trial_cost ) && trial_cost < cost ) {
+                        const double gain = cost - trial_cost;
+                        std::copy( trial, trial + 8, h );
+                        cost     = trial_cost;
+                        lambda   = std::max( lambda * 0.1, 1e-12 );
+                        improved = true;
+                        if( gain <= 1e-12 * cost ) {
+                            return iter + 1; // 수렴
+                        }
+                        break;
+                    }
+                }
+                lambda *= 10.0;
+            }
+            if( !improved ) {
+                return iter + 1;
+            }
+        }
+        return iter;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: FitHomographyDlt
+    // 설명: 정규화 -> DLT -> (선택) LM -> 역정규화. 모든 중간값은 스택에 있으며 O(count) 두세 번 순회합니다.
+    //--------------------------------------------------------------------------
+    bool FitHomographyDlt( const cv::Point2f* src, const cv::Point2f* dst, size_t count, cv::Matx33d& h,
+                           int refine_iterations, int* lm_iterations ) noexcept
+    {
+        if( lm_iterations != nullptr ) {
+            *lm_iterations = 0;
+        }
+        if( count < 4 || src == nullptr || dst == nullptr ) {
+            return false;
+        }
+
+        const PointNormalization src_norm = PointNormalization::FromPoints( src, count );
+        const PointNormalization dst_norm = PointNormalization::FromPoints( dst, count );
+        DltSystem system;
+        for( size_t i = 0; i < count; ++i ) {
+            system.Accumulate( src_norm.Apply( src[ i ] ), dst_norm.Apply( dst[ i ] ) );
+        }
+
+        cv::Matx33d h_normalized;
+        if( !system.Solve( h_normalized ) ) {
+            return false;
+        }
+
+        // 정규화 좌표계에서 H(2,2)가 충분히 크면 (대부분의 경우) 1로 맞추고 LM 보정
+        if( refine_iterations > 0 && count > 4 && std::abs( h_normalized.val[ 8 ] ) > 1e-8 ) {
+            double params[ 8 ];
+            for( int i = 0; i < 8; ++i ) {
+                params[ i ] = h_normalized.val[ i ] / h_normalized.val[ 8 ];
+            }
+            const int performed = RefineLevenbergMarquardt( params, src, dst, count, src_norm, dst_norm, refine_iterations );
+            if( lm_iterations != nullptr ) {
+                *lm_iterations = performed;
+            }
+            for( int i = 0; i < 8; ++i ) {
+                h_normalized.val[ i ] = params[ i ];
+            }
+            h_normalized.val[ 8 ] = 1.0;
+        }
+
+        h = DenormalizeHomography( h_normalized, src_norm, dst_norm );
+        for( int i = 0; i < 9; ++i ) {
+            if( !std::isfinite( h.val[ i ] ) ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: SquareToQuad (파일 내부)
+    // 설명: 단위 정사각형 (0,0), (1,0), (1,1), (0,1)을 사각형 q[0..3]으로 보내는 사상 (Heckbert).
+    //       네 점 중 어느 세 점이라도 (범위 대비) 한 직선 위에 있으면 false.
+    //--------------------------------------------------------------------------
+    static bool SquareToQuad( const cv::Point2f* q, cv::Matx33d& m ) noexcept
+    {
+        static constexpr int TRIPLES[ 4 ][ 3 ] = { { 0, 1, 2 }, { 0, 1, 3 }, { 0, 2, 3 }, { 1, 2, 3 } };
+        double extent = 0.0;
+        for( int i = 1; i < 4; ++i ) {
+            extent = std::max( { extent, std::fabs( static_cast<double>( q[ i ].x ) - q[ 0 ].x ),
+                                         std::fabs( static_cast<double>( q[ i ].y ) - q[ 0 ].y ) } );
+        }
+        for( const auto& t : TRIPLES ) {
+            const cv::Point2f& a = q[ t[ 0 ] ];
+            const cv::Point2f& b = q[ t[ 1 ] ];
+            const cv::Point2f& c = q[ t[ 2 ] ];
+            const double area = ( static_cast<double>( b.x ) - a.x ) * ( static_cast<double>( c.y ) - a.y ) -
+                                ( static_cast<double>( b.y ) - a.y ) * ( static_cast<double>( c.x ) - a.x );
+            if( !( std::fabs( area ) > 1e-10 * extent * extent ) ) {
+                return false;
+            }
+        }
+
+        const double x0 = q[ 0 ].x, y0 = q[ 0 ].y, x1 = q[ 1 ].x, y1 = q[ 1 ].y;
+        const double x2 = q[ 2 ].x, y2 = q[ 2 ].y, x3 = q[ 3 ].x, y3 = q[ 3 ].y;
+        const double sx  = x0 - x1 + x2 - x3;
+        const double sy  = y0 - y1 + y2 - y3;
+        const double dx1 = x1 - x2, dx2 = x3 - x2;
+        const double dy1 = y1 - y2, dy2 = y3 - y2;
+        const double den = dx1 * dy2 - dx2 * dy1; // 점 1, 2, 3이 한 직선 위가 아니므로 0이 아님
+        const double g   = ( sx * dy2 - dx2 * sy ) / den;
+        const double h   = ( dx1 * sy - sx * dy1 ) / den;
+        m = cv::Matx33d( x1 - x0 + g * x1, x3 - x0 + h * x3, x0,
+                         y1 - y0 + g * y1, y3 - y0 + h * y3, y0,
+                         g,                h,                1.0 );
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: FitHomography4Point
+    // 설명: H = S_dst * adj(S_src). 역행렬 대신 수반 행렬을 쓰므로 나눗셈은 마지막 스케일 한 번뿐입니다.
+    //--------------------------------------------------------------------------
+    bool FitHomography4Point( const cv::Point2f* src, const cv::Point2f* dst, cv::Matx33d& h ) noexcept
+    {
+        cv::Matx33d s, d;
+        if( !SquareToQuad( src, s ) || !SquareToQuad( dst, d ) ) {
+            return false;
+        }
+
+        const cv::Matx33d adj( s( 1, 1 ) * s( 2, 2 ) - s( 1, 2 ) * s( 2, 1 ), s( 0, 2 ) * s( 2, 1 ) - s( 0, 1 ) * s( 2, 2 ), s( 0, 1 ) * s( 1, 2 ) - s( 0, 2 ) * s( 1, 1 ),
+                               s( 1, 2 ) * s( 2, 0 ) - s( 1, 0 ) * s( 2, 2 ), s( 0, 0 ) * s( 2, 2 ) - s( 0, 2 ) * s( 2, 0 ), s( 0, 2 ) * s( 1, 0 ) - s( 0, 0 ) * s( 1, 2 ),
+                               s( 1, 0 ) * s( 2, 1 ) - s( 1, 1 ) * s( 2, 0 ), s( 0, 1 ) * s( 2, 0 ) - s( 0, 0 ) * s( 2, 1 ), s( 0, 0 ) * s( 1, 1 ) - s( 0, 1 ) * s( 1, 0 ) );
+        cv::Matx33d result;
+        for( int r = 0; r < 3; ++r ) {
+            for( int c = 0; c < 3; ++c ) {
+                result( r, c ) = d( r, 0 ) * adj( 0, c ) + d( r, 1 ) * adj( 1, c ) + d( r, 2 ) * adj( 2, c );
+            }
+        }
+
+        // DenormalizeHomography와 같은 스케일 규칙 (H(2,2) = 1, 0에 가까우면 Frobenius 노름 1)
+        double norm = 0.0;
+        for( int i = 0; i < 9; ++i ) {
+            norm += result.val[ i ] * result.val[ i ];
+        }
+        norm = std::sqrt( norm );
+        const double w = result.val[ 8 ];
+        const double divisor = ( std::abs( w ) > 1e-12 * norm ) ? w : norm;
+        if( divisor == 0.0 ) {
+            return false;
+        }
+        for( int i = 0; i < 9; ++i ) {
+            result.val[ i ] /= divisor;
+            if( !std::isfinite( result.val[ i ] ) ) {
+                return false;
+            }
+        }
+        h = result;
+        return true;
+    }
+
+} // nsp::MGEN::MVEM
@@ -0,0 +1,122 @@
+#ifndef _MGEN_MVEM_HOMOGRAPHY_DLT_H_
+#define _MGEN_MVEM_HOMOGRAPHY_DLT_H_
+
+/* ====================================
+ * Normalized DLT Homography Solver Header
+ * ------------------------------------
+ * Desc   : 정규화된 DLT(Direct Linear Transform)의 정규 방정식 A^T A (9x9)를 누적하고,
+ * 최소 고유값의 고유벡터로 호모그래피를 구합니다.
+ * 포인트 쌍 하나는 A의 두 행이므로 추가/삭제가 랭크 2 갱신이 되어, 포인트 하나를 바꿀 때
+ * 전체 포인트를 다시 읽지 않고 O(1)로 방정식을 갱신할 수 있습니다.
+ * ==================================== */
+
+// OpenCV Core Types
+#include <opencv2/core/types.hpp> // cv::Matx33d, cv::Point2f, cv::Point2d
+
+// STL
+#include <cstddef>
+#include <vector>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    /**
+     * @brief Hartley 정규화: 중심을 원점으로 옮기고 평균 거리가 sqrt(2)가 되도록 등방 스케일.
+     *   x' = scale * (x - cx),  y' = scale * (y - cy)
+     */
+    struct PointNormalization
+    {
+        double scale = 1.0; /**< 등방 스케일 */
+        double cx    = 0.0; /**< 중심 x */
+        double cy    = 0.0; /**< 중심 y */
+
+        /**
+         * @brief 포인트 집합으로부터 정규화를 만듭니다. 포인트가 없거나 한 점에 모여 있으면 항등 스케일.
+         */
+        static PointNormalization FromPoints( const std::vector<cv::Point2f>& points ) noexcept;
+        static PointNormalization FromPoints( const cv::Point2f* points, size_t count ) noexcept;
+
+        cv::Point2d Apply( const cv::Point2f& p ) const noexcept { return { scale * ( p.x - cx ), scale * ( p.y - cy ) }; }
+
+        /** 정규화 행렬 T (동차 좌표) */
+        cv::Matx33d Matrix() const noexcept;
+
+        /** 역정규화 행렬 T^-1 */
+        cv::Matx33d Inverse() const noexcept;
+    };
+
+    /**
+     * @brief 정규화된 DLT 정규 방정식 M = A^T A.
+     * 정규화 좌표 (x, y) -> (u, v) 한 쌍은 A에 다음 두 행을 더합니다.
+     *   [ x, y, 1, 0, 0, 0, -u*x, -u*y, -u ]
+     *   [ 0, 0, 0, x, y, 1, -v*x, -v*y, -v ]
+     * 해 h는 M의 최소 고유값에 대응하는 단위 고유벡터입니다.
+     * 스레드 안전하지 않습니다 (소유자가 직렬화).
+     */
+    class DltSystem
+    {
+    public:
+        /** 미지수 개수 (H의 9개 원소) */
+        static constexpr int N = 9;
+
+        DltSystem() { Reset(); }
+
+        /** 방정식을 비웁니다. */
+        void Reset() noexcept;
+
+        /**
+         * @brief 포인트 쌍을 더하거나(weight = +1) 뺍니다(weight = -1). 랭크 2 갱신.
+         * @param src 정규화된 원본 좌표 (보정된 카메라 픽셀).
+         * @param dst 정규화된 대상 좌표 (지상 좌표).
+         */
+        void Accumulate( const cv::Point2d& src, const cv::Point2d& dst, double weight = 1.0 ) noexcept;
+
+        /**
+         * @brief 정규화 좌표계의 호모그래피를 구합니다. (9x9 대칭 행렬의 최소 고유벡터: Cholesky 역반복, 실패 시 Jacobi)
+         * @param h_normalized [출력] 정규화 좌표계의 H (||h|| = 1).
+         * @param min_eigenvalue (선택) 최소 고유값 (정규화 좌표계의 대수 잔차 제곱합).
+         * @return 누적된 쌍이 4개 이상이고 해가 유한하면 true.
+         */
+        bool Solve( cv::Matx33d& h_normalized, double* min_eigenvalue = nullptr ) const noexcept;
+
+        /** 누적된 포인트 쌍 개수 (더한 수 - 뺀 수) */
+        long pairs() const noexcept { return pair_count; }
+
+    private:
+        double m[ N * N ]; // 대칭 행렬 (행 우선, 위/아래 삼각 모두 유지)
+        long   pair_count = 0;
+    }; // cls::DltSystem
+
+    /**
+     * @brief 정규화 좌표계의 H를 원래 좌표계로 되돌립니다: H = T_dst^-1 * H_n * T_src.
+     * 결과는 H(2,2) = 1 이 되도록 스케일합니다 (H(2,2)가 0에 가까우면 Frobenius 노름 1).
+     */
+    cv::Matx33d DenormalizeHomography( const cv::Matx33d& h_normalized, const PointNormalization& src,
+                                       const PointNormalization& dst ) noexcept;
+
+    /**
+     * @brief 포인트 쌍 전체로 호모그래피를 최소제곱 추정합니다. (힙 할당 없음)
+     * Hartley 정규화 -> 9x9 정규 방정식 고유값 분해(DLT) -> (선택) Levenberg-Marquardt로 재투영 오차 최소화.
+     * 아웃라이어 제거는 하지 않으므로 수동 서베이처럼 깨끗한 포인트 또는 RANSAC 인라이어 재추정에 사용합니다.
+     *
+     * @param src, dst          대응점 배열 (보정된 카메라 픽셀 -> 지상 좌표), 길이 count.
+     * @param h                 [출력] 호모그래피 (H(2,2) = 1).
+     * @param refine_iterations LM 최대 반복 횟수 (0이면 DLT 해 그대로).
+     * @param lm_iterations     (선택) 실제로 수행한 LM 반복 횟수를 받을 포인터. nullptr이면 무시.
+     * @return count >= 4이고 해가 유한하면 true.
+     */
+    bool FitHomographyDlt( const cv::Point2f* src, const cv::Point2f* dst, size_t count, cv::Matx33d& h,
+                           int refine_iterations = 0, int* lm_iterations = nullptr ) noexcept;
+
+    /**
+     * @brief 정확히 4쌍의 대응점으로 호모그래피를 닫힌 형식으로 구합니다. (고유값 분해/반복 없음)
+     * 단위 정사각형 -> 사각형 사상 S_src, S_dst를 각각 직접 계산하고 H = S_dst * adj(S_src)로 합성합니다.
+     *
+     * @param src, dst 대응점 4개씩.
+     * @param h        [출력] 호모그래피 (H(2,2) = 1).
+     * @return 어느 쪽이든 세 점이 한 직선 위에 있으면(퇴화) false.
+     */
+    bool FitHomography4Point( const cv::Point2f* src, const cv::Point2f* dst, cv::Matx33d& h ) noexcept;
+
+} // nsp::MGEN::MVEM
+
+#endif // _MGEN_MVEM_HOMOGRAPHY_DLT_H_
@@ -0,0 +1,294 @@
+#include "HomographyEstimator.h"
+#include "HomographyDlt.h"
+#include "HomographyRansac.h"
+#include "MgenLogger.h"
+
+// 3rdParty
+#include "json/json.hpp"
+
+// OpenCV
+#include <opencv2/calib3d.hpp> // cv::findHomography
+
+// STL::C++
+#include <algorithm>
+#include <cmath>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    // 방식 이름 <-> 열거형 <-> OpenCV 플래그 (Dlt는 OpenCV 플래그 없음)
+    struct MethodEntry
+    {
+        const char*      name;
+        HomographyMethod method;
+        int              cv_flag;
+    };
+    static constexpr MethodEntry METHOD_TABLE[] = {
+        { "auto",            HomographyMethod::Auto,           cv::RANSAC },
+        { "ransac",          HomographyMethod::Ransac,         cv::RANSAC },
+        { "lmeds",           HomographyMethod::Lmeds,          cv::LMEDS },
+        { "rho",             HomographyMethod::Rho,            cv::RHO },
+        { "usac_default",    HomographyMethod::UsacDefault,    cv::USAC_DEFAULT },
+        { "usac_parallel",   HomographyMethod::UsacParallel,   cv::USAC_PARALLEL },
+        { "usac_fast",       HomographyMethod::UsacFast,       cv::USAC_FAST },
+        { "usac_accurate",   HomographyMethod::UsacAccurate,   cv::USAC_ACCURATE },
+        { "usac_prosac",     HomographyMethod::UsacProsac,     cv::USAC_PROSAC },
+        { "usac_magsac",     HomographyMethod::UsacMagsac,     cv::USAC_MAGSAC },
+        { "dlt",             HomographyMethod::Dlt,            -1 },
+        { "parallel_ransac", HomographyMethod::ParallelRansac, -1 },
+    };
+
+    //--------------------------------------------------------------------------
+    // 함수: AdaptiveIterations
+    // 설명: k = log(1 - confidence) / log(1 - w^4)를 [1, max_iterations]로 제한합니다.
+    //--------------------------------------------------------------------------
+    int HomographyEstimator::AdaptiveIterations( double confidence, double inlier_ratio, int max_iterations ) noexcept
+    {
+        const double p_good = std::pow( std::clamp( inlier_ratio, 0.0, 1.0 ), 4 );
+        if( p_good <= 0.0 ) {
+            return max_iterations;
+        }
+        if( p_good >= 1.0 ) {
+            return 1;
+        }
+        const double k = std::log( 1.0 - confidence ) / std::log( 1.0 - p_good );
+        if( !std::isfinite( k ) || k >= max_iterations ) {
+            return max_iterations;
+        }
+        return std::max( 1, static_cast<int>( std::ceil( k ) ) );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ParseOptions
+    // 설명: "estimator" 객체로부터 추정 방식과 파라미터를 읽습니다.
+    //       항목이 없거나 값이 잘못되면 해당 필드는 기본값을 유지합니다.
+    //--------------------------------------------------------------------------
+    HomographyEstimatorOptions HomographyEstimator::ParseOptions( const nlohmann::json& js ) noexcept
+    {
+        HomographyEstimatorOptions opt {};
+        try {
+            if( js.is_object() == false ) {
+                return opt;
+            }
+
+            // 1. 추정 방식
+            if( js.contains( "method" ) && js.at( "method" ).is_string() ) {
+                const std::string method = js.at( "method" ).get<std::string>();
+                const auto entry = std::find_if( std::begin( METHOD_TABLE ), std::end( METHOD_TABLE ),
+                                                 [ &method ]( const MethodEntry& e ) { return method == e.name; } );
+                if( entry != std::end( METHOD_TABLE ) ) {
+                    opt.method = entry->method;
+                }
+                else {
+                    MLOG_WARN("HomographyEstimator: Unknown method '%s'. Using 'auto'.", method.c_str());
+                }
+            }
+
+            // 2. RANSAC 임계값 (양수)
+            if( js.contains( "threshold" ) && js.at( "threshold" ).is_number() ) {
+                const double threshold = js.at( "threshold" ).get<double>();
+                if( threshold > 0.0 && std::isfinite( threshold ) ) {
+                    opt.ransac_threshold = threshold;
+                }
+                else {
+                    MLOG_WARN("HomographyEstimator: threshold must be > 0. Using %.1f.", opt.ransac_threshold);
+                }
+            }
+
+            // 3. 신뢰도 (0, 1)
+            if( js.contains( "confidence" ) && js.at( "confidence" ).is_number() ) {
+                const double confidence = js.at( "confidence" ).get<double>();
+                if( confidence > 0.0 && confidence < 1.0 ) {
+                    opt.confidence = confidence;
+                }
+                else {
+                    MLOG_WARN("HomographyEstimator: confidence must be in (0, 1). Using %.3f.", opt.confidence);
+                }
+            }
+
+            // 4. 최대 반복 횟수 (1 ~ 100000)
+            if( js.contains( "max_iterations" ) && js.at( "max_iterations" ).is_number_integer() ) {
+                const int max_iterations = js.at( "max_iterations" ).get<int>();
+                if( max_iterations >= 1 && max_iterations <= 100000 ) {
+                    opt.max_iterations = max_iterations;
+                }
+                else {
+                    MLOG_WARN("HomographyEstimator: max_iterations (%d) must be in [1, 100000]. Using %d.", max_iterations, opt.max_iterations);
+                }
+            }
+
+            // 5. LM 반복 횟수 (0 ~ 100)
+            if( js.contains( "refine_iterations" ) && js.at( "refine_iterations" ).is_number_integer() ) {
+                const int iterations = js.at( "refine_iterations" ).get<int>();
+                if( iterations >= 0 && iterations <= 100 ) {
+                    opt.refine_iterations = iterations;
+                }
+                else {
+                    MLOG_WARN("HomographyEstimator: refine_iterations (%d) must be in [0, 100]. Using %d.", iterations, opt.refine_iterations);
+                }
+            }
+
+            // 6. 표본 시드 (0 이상 정수)
+            if( js.contains( "seed" ) && js.at( "seed" ).is_number_integer() ) {
+                if( js.at( "seed" ).is_number_unsigned() ) {
+                    opt.seed = js.at( "seed" ).get<uint64_t>();
+                }
+                else {
+                    MLOG_WARN("HomographyEstimator: seed must be >= 0. Using the default seed.");
+                }
+            }
+        }
+        catch( const std::exception& e ) {
+            MLOG_WARN("HomographyEstimator: Failed to parse options (%s). Using defaults.", e.what());
+            return HomographyEstimatorOptions {};
+        }
+        return opt;
+    }
+
+    void HomographyEstimator::AppendKey( const HomographyEstimatorOptions& options, std::string& key )
+    {
+        const int64_t method         = static_cast<int64_t>( options.method );
+        const double  threshold      = options.ransac_threshold;
+        const double  confidence     = options.confidence;
+        const int64_t max_iterations = options.max_iterations;
+        const int64_t iterations     = options.refine_iterations;
+        key.append( reinterpret_cast<const char*>( &method ), sizeof( method ) );
+        key.append( reinterpret_cast<const char*>( &threshold ), sizeof( threshold ) );
+        key.append( reinterpret_cast<const char*>( &confidence ), sizeof( confidence ) );
+        key.append( reinterpret_cast<const char*>( &max_iterations ), sizeof( max_iterations ) );
+        key.append( reinterpret_cast<const char*>( &iterations ), sizeof( iterations ) );
+        key.append( reinterpret_cast<const char*>( &options.seed ), sizeof( options.seed ) );
+    }
+
+    const char* HomographyEstimator::MethodName( HomographyMethod method ) noexcept
+    {
+        for( const MethodEntry& entry : METHOD_TABLE ) {
+            if( entry.method == method ) {
+                return entry.name;
+            }
+        }
+        return "unknown";
+    }
+
+    const char* HomographyEstimator::PathName( HomographySolverPath path ) noexcept
+    {
+        switch( path ) {
+            case HomographySolverPath::ClosedForm4Point: return "closed_form_4pt";
+            case HomographySolverPath::LeastSquares:     return "least_squares";
+            case HomographySolverPath::Robust:           return "robust";
+            default:                                     return "unknown";
+        }
+    }
+
+    static double TransferError( const cv::Matx33d& h, const cv::Point2f& p, const cv::Point2f& q ) noexcept
+    {
+        const double x = p.x, y = p.y;
+        const double w = h( 2, 0 ) * x + h( 2, 1 ) * y + h( 2, 2 );
+        const double du = ( h( 0, 0 ) * x + h( 0, 1 ) * y + h( 0, 2 ) ) / w - q.x;
+        const double dv = ( h( 1, 0 ) * x + h( 1, 1 ) * y + h( 1, 2 ) ) / w - q.y;
+        return std::sqrt( du * du + dv * dv );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: CleanSmallSet (파일 내부)
+    // 설명: Auto의 간단한 아웃라이어 검사. 포인트가 적으면 최소제곱 해가 아웃라이어를 흡수해 잔차만으로는 드러나지 않으므로,
+    //       포인트마다 나머지로 푼 DLT 해가 그 포인트를 threshold 안으로 예측하는지 확인합니다. (N <= 8이므로 DLT N번, 힙 할당 없음)
+    //--------------------------------------------------------------------------
+    static bool CleanSmallSet( const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst, double threshold ) noexcept
+    {
+        const size_t n = src.size();
+        cv::Point2f others_src[ AUTO_LEAST_SQUARES_MAX_POINTS ], others_dst[ AUTO_LEAST_SQUARES_MAX_POINTS ];
+        for( size_t skip = 0; skip < n; ++skip ) {
+            size_t k = 0;
+            for( size_t i = 0; i < n; ++i ) {
+                if( i != skip ) {
+                    others_src[ k ] = src[ i ];
+                    others_dst[ k ] = dst[ i ];
+                    ++k;
+                }
+            }
+            cv::Matx33d h;
+            if( !FitHomographyDlt( others_src, others_dst, k, h, 0 ) ||
+                !( TransferError( h, src[ skip ], dst[ skip ] ) <= threshold ) ) { // NaN도 실패
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool HomographyEstimator::Estimate( const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst,
+                                        const HomographyEstimatorOptions& options, HomographyEstimate& estimate, std::string& error )
+    {
+        if( src.size() != dst.size() || src.size() < 4 ) {
+            error = "At least 4 point pairs are required to calculate homography.";
+            return false;
+        }
+
+        // 0. 자동 선택: 4쌍 -> 닫힌 형식, 소수의 깨끗한 포인트 -> 최소제곱, 그 밖 -> RANSAC
+        if( options.method == HomographyMethod::Auto ) {
+            if( src.size() == 4 ) {
+                if( !FitHomography4Point( src.data(), dst.data(), estimate.homography ) ) {
+                    error = "Failed to calculate homography matrix (three of the four points are collinear).";
+                    return false;
+                }
+                estimate.inlier_mask.assign( src.size(), 1 );
+                estimate.iterations = 0;
+                estimate.path = HomographySolverPath::ClosedForm4Point;
+                return true;
+            }
+            if( src.size() <= AUTO_LEAST_SQUARES_MAX_POINTS && CleanSmallSet( src, dst, options.ransac_threshold ) &&
+                FitHomographyDlt( src.data(), dst.data(), src.size(), estimate.homography, options.refine_iterations,
+                                  &estimate.iterations ) ) {
+                estimate.inlier_mask.assign( src.size(), 1 );
+                estimate.path = HomographySolverPath::LeastSquares;
+                return true;
+            }
+            HomographyEstimatorOptions robust = options;
+            robust.method = HomographyMethod::Ransac;
+            return Estimate( src, dst, robust, estimate, error );
+        }
+
+        // 1. 자체 DLT (아웃라이어 제거 없음)
+        if( options.method == HomographyMethod::Dlt ) {
+            if( !FitHomographyDlt( src.data(), dst.data(), src.size(), estimate.homography, options.refine_iterations,
+                                   &estimate.iterations ) ) {
+                error = "Failed to calculate homography matrix (degenerate point configuration).";
+                return false;
+            }
+            estimate.inlier_mask.assign( src.size(), 1 );
+            estimate.path = HomographySolverPath::LeastSquares;
+            return true;
+        }
+
+        // 2. 자체 병렬 RANSAC
+        if( options.method == HomographyMethod::ParallelRansac ) {
+            if( !FindHomographyParallelRansac( src, dst, options, estimate ) ) {
+                error = "Failed to calculate homography matrix (no non-degenerate sample found).";
+                return false;
+            }
+            estimate.path = HomographySolverPath::Robust;
+            return true;
+        }
+
+        // 3. OpenCV 강건 추정기 (USAC 계열도 같은 진입점에서 플래그로 선택됨)
+        int cv_flag = cv::RANSAC;
+        for( const MethodEntry& entry : METHOD_TABLE ) {
+            if( entry.method == options.method ) {
+                cv_flag = entry.cv_flag;
+            }
+        }
+        cv::Mat homography_matrix = cv::findHomography( src, dst, cv_flag, options.ransac_threshold, estimate.inlier_mask,
+                                                        options.max_iterations, options.confidence );
+        if( homography_matrix.empty() ) {
+            error = "Failed to calculate homography matrix (cv::findHomography returned an empty matrix).";
+            return false;
+        }
+        estimate.homography = cv::Matx33d( homography_matrix );
+        if( estimate.inlier_mask.size() != src.size() ) {
+            estimate.inlier_mask.assign( src.size(), 1 ); // 마스크를 돌려주지 않는 경로 대비
+        }
+        estimate.iterations = ITERATIONS_NOT_MEASURED; // OpenCV는 반복 횟수를 돌려주지 않음
+        estimate.path = HomographySolverPath::Robust;
+        return true;
+    }
+
+} // nsp::MGEN::MVEM
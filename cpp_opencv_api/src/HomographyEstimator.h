@@ -0,0 +1,139 @@
+#ifndef _MGEN_MVEM_HOMOGRAPHY_ESTIMATOR_H_
+#define _MGEN_MVEM_HOMOGRAPHY_ESTIMATOR_H_
+
+/* ====================================
+ * Homography Estimator Selection Header
+ * ------------------------------------
+ * Desc   : 보정된 카메라 픽셀 -> 지상 좌표 호모그래피 추정 방식을 선택합니다.
+ * 요청의 "estimator" 객체로 방식과 파라미터를 지정하며, 기본값(Auto)은 포인트 수에 따라 풀이 경로를 고릅니다.
+ * OpenCV의 강건 추정기(RANSAC, LMEDS, RHO, USAC 계열)와 자체 DLT를 같은 인터페이스로 호출하고,
+ * 인라이어 마스크와 반복 횟수를 함께 돌려줍니다.
+ * ==================================== */
+
+#include "json/json_fwd.hpp" // nlohmann::json 전방 선언
+
+// OpenCV Core Types
+#include <opencv2/core/types.hpp> // cv::Matx33d, cv::Point2f
+
+// STL
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    /**
+     * @brief 호모그래피 추정 방식.
+     */
+    enum class HomographyMethod : uint8_t
+    {
+        Auto,         /**< 포인트 수/간단한 아웃라이어 검사로 아래 풀이 경로 중 하나를 자동 선택 (기본값) */
+        Ransac,       /**< cv::RANSAC. 적응형 종료, 최종 인라이어로 LM 보정 */
+        Lmeds,        /**< cv::LMEDS. 임계값 없음 (잔차 중앙값 최소화), 아웃라이어 50% 미만일 때만 유효 */
+        Rho,          /**< cv::RHO. PROSAC 기반 가속 RANSAC */
+        UsacDefault,  /**< cv::USAC_DEFAULT. 균일 표본 + MSAC 점수 + 국소 최적화 */
+        UsacParallel, /**< cv::USAC_PARALLEL. USAC_DEFAULT의 병렬 버전 */
+        UsacFast,     /**< cv::USAC_FAST. 국소 최적화를 줄인 빠른 버전 */
+        UsacAccurate, /**< cv::USAC_ACCURATE. 그래프 컷 국소 최적화 */
+        UsacProsac,   /**< cv::USAC_PROSAC. 품질 순 표본 (입력 순서 사용) */
+        UsacMagsac,   /**< cv::USAC_MAGSAC. 임계값에 덜 민감한 MAGSAC++ */
+        Dlt,          /**< 자체 구현: 정규화 DLT + LM (FitHomographyDlt). 할당 없음, 아웃라이어 제거 없음 */
+        ParallelRansac, /**< 자체 구현: 병렬 가설 평가 + SIMD 점수 RANSAC (FindHomographyParallelRansac). 고정 시드로 결정적 */
+    };
+
+    /**
+     * @brief 실제로 사용된 풀이 경로. (응답의 "solver_path", 경로별 지연 시간 통계)
+     */
+    enum class HomographySolverPath : uint8_t
+    {
+        ClosedForm4Point, /**< 정확히 4쌍: 닫힌 형식 (FitHomography4Point) */
+        LeastSquares,     /**< 정규화 DLT 최소제곱 (+ LM), 아웃라이어 제거 없음 */
+        Robust,           /**< 강건 추정 (OpenCV 또는 자체 병렬 RANSAC) */
+        COUNT
+    };
+
+    /** Auto: 이 개수 이하(5개 이상)의 포인트는 모든 포인트가 나머지 포인트의 DLT 해로 임계값 안에 예측되면 최소제곱 해를 사용 */
+    constexpr size_t AUTO_LEAST_SQUARES_MAX_POINTS = 8;
+
+    /**
+     * @brief 추정 옵션.
+     * JSON 예: { "method": "auto", "threshold": 3.0 }
+     *          { "method": "usac_magsac", "threshold": 3.0, "confidence": 0.999, "max_iterations": 5000 }
+     *          { "method": "dlt", "refine_iterations": 10 }
+     *          { "method": "parallel_ransac", "threshold": 0.5, "seed": 42 }
+     */
+    struct HomographyEstimatorOptions
+    {
+        static constexpr uint64_t DEFAULT_SEED = 0x4D47454E4D56454Dull; /**< ParallelRansac 기본 시드 */
+
+        HomographyMethod method            = HomographyMethod::Auto; /**< 추정 방식 */
+        double           ransac_threshold  = 3.0;   /**< 강건 추정기/Auto: 인라이어 재투영 임계값 (지상 좌표 단위, LMEDS는 무시) */
+        double           confidence        = 0.995; /**< 강건 추정기: 신뢰도 (0, 1) */
+        int              max_iterations    = 2000;  /**< 강건 추정기: 최대 반복 횟수 */
+        int              refine_iterations = 10;    /**< Dlt, ParallelRansac(인라이어 재적합): LM 최대 반복 횟수 (0이면 DLT 해 그대로) */
+        uint64_t         seed              = DEFAULT_SEED; /**< ParallelRansac: 표본 시드 (같은 입력/시드면 같은 결과) */
+    };
+
+    /** HomographyEstimate::iterations: OpenCV 추정기처럼 반복 횟수를 돌려주지 않는 경로 */
+    constexpr int ITERATIONS_NOT_MEASURED = -1;
+
+    /**
+     * @brief 추정 결과.
+     */
+    struct HomographyEstimate
+    {
+        cv::Matx33d                homography;     /**< 보정된 픽셀 -> 지상 좌표 */
+        std::vector<unsigned char> inlier_mask;    /**< 입력 순서의 인라이어 여부 (1 = 인라이어) */
+        int                        iterations = 0; /**< 실제로 수행한 반복 횟수. 측정할 수 없으면 ITERATIONS_NOT_MEASURED (아래 참고) */
+        HomographySolverPath       path = HomographySolverPath::Robust; /**< 실제로 사용된 풀이 경로 */
+    };
+
+    /**
+     * @brief 추정 방식 선택/실행 (상태 없음, 스레드 안전).
+     */
+    class HomographyEstimator
+    {
+    public:
+        HomographyEstimator() = delete;
+
+        /**
+         * @brief "estimator" JSON 객체로부터 옵션을 읽습니다.
+         * 객체가 아니거나 값이 잘못되면 해당 필드는 기본값을 유지합니다. (Calibrator::ParseOptions와 같은 규칙)
+         */
+        static HomographyEstimatorOptions ParseOptions( const nlohmann::json& json ) noexcept;
+
+        /**
+         * @brief 옵션을 결과 캐시 키에 덧붙입니다. (방식/파라미터가 다르면 다른 결과)
+         */
+        static void AppendKey( const HomographyEstimatorOptions& options, std::string& key );
+
+        /** 응답에 표시할 방식 이름 ("auto", "ransac", "lmeds", "rho", "usac_default", ..., "dlt", "parallel_ransac") */
+        static const char* MethodName( HomographyMethod method ) noexcept;
+
+        /** 응답/통계에 표시할 풀이 경로 이름 ("closed_form_4pt", "least_squares", "robust") */
+        static const char* PathName( HomographySolverPath path ) noexcept;
+
+        /**
+         * @brief 4점 표본이 모두 인라이어일 확률이 confidence 이상이 되는 반복 횟수를 구합니다. (OpenCV RANSACUpdateNumIters와 같은 식)
+         * @return [1, max_iterations] 범위의 반복 횟수.
+         */
+        static int AdaptiveIterations( double confidence, double inlier_ratio, int max_iterations ) noexcept;
+
+        /**
+         * @brief 호모그래피를 추정합니다.
+         * iterations는 측정한 값만 보고합니다: ParallelRansac은 실제로 평가한 가설 수, Dlt/최소제곱은 실제로 수행한
+         * LM 반복 횟수, 닫힌 형식은 0입니다. OpenCV 추정기(USAC 계열 포함)는 반복 횟수를 돌려주지 않고 종료 규칙도
+         * 방식마다 다르므로 ITERATIONS_NOT_MEASURED입니다.
+         * Auto는 정확히 4쌍이면 닫힌 형식(반복 0), 5 ~ AUTO_LEAST_SQUARES_MAX_POINTS쌍이고 각 포인트의 leave-one-out
+         * 예측 오차가 threshold 이하이면 최소제곱(+ LM) 해(모두 인라이어), 그 밖에는 cv::RANSAC을 사용합니다.
+         * @param src, dst 대응점 (길이가 같아야 함, 4개 이상).
+         * @param estimate [출력] 추정 결과.
+         * @param error    [출력] 실패 시 에러 메시지.
+         */
+        static bool Estimate( const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst,
+                              const HomographyEstimatorOptions& options, HomographyEstimate& estimate, std::string& error );
+    }; // cls::HomographyEstimator
+
+} // nsp::MGEN::MVEM
+
+#endif // _MGEN_MVEM_HOMOGRAPHY_ESTIMATOR_H_
@@ -0,0 +1,171 @@
+#include "HomographyMetrics.h"
+#include "CalibratorKernels.h" // simd::VecD, simd::ScalarD, simd::HomographyLanes
+#include "HomographyDlt.h"
+#include "WorkerPool.h"
+
+// STL::C++
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    /**
+     * @brief 레인별 | H * (x, y) - (u, v) |. HomographyLanes가 무한원점 레인에 NaN을 넣으므로 결과도 NaN입니다.
+     */
+    template<class V>
+    inline V TransferErrorLanes( const simd::HomographyCoeffs& h, const V& x, const V& y, const V& u, const V& v ) noexcept
+    {
+        V gx, gy;
+        simd::HomographyLanes( h, x, y, gx, gy );
+        const V du = gx - u;
+        const V dv = gy - v;
+        return simd::Sqrt( du * du + dv * dv );
+    }
+
+    template<class V>
+    static void TransferErrorRange( const simd::HomographyCoeffs& h, const simd::HomographyCoeffs* h_inv,
+                                    const float* x, const float* y, const float* u, const float* v,
+                                    size_t i, float* forward, float* backward ) noexcept
+    {
+        const V px = V::LoadF( x + i ), py = V::LoadF( y + i );
+        const V qx = V::LoadF( u + i ), qy = V::LoadF( v + i );
+        TransferErrorLanes( h, px, py, qx, qy ).StoreF( forward + i );
+        if( h_inv != nullptr ) {
+            TransferErrorLanes( *h_inv, qx, qy, px, py ).StoreF( backward + i );
+        }
+        else {
+            V::Set1( std::numeric_limits<double>::quiet_NaN() ).StoreF( backward + i );
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ComputeTransferErrors
+    // 설명: VecD 레인 단위로 처리하고 나머지(LANES 미만)는 스칼라 레인으로 처리합니다.
+    //--------------------------------------------------------------------------
+    void ComputeTransferErrors( const float* x, const float* y, const float* u, const float* v, size_t count,
+                                const cv::Matx33d& homography, const cv::Matx33d* inverse_homography,
+                                float* forward, float* backward ) noexcept
+    {
+        constexpr size_t LANES = simd::VecD::LANES;
+        const simd::HomographyCoeffs h = simd::MakeHomography( homography );
+        simd::HomographyCoeffs h_inv {};
+        const simd::HomographyCoeffs* h_inv_ptr = nullptr;
+        if( inverse_homography != nullptr ) {
+            h_inv     = simd::MakeHomography( *inverse_homography );
+            h_inv_ptr = &h_inv;
+        }
+
+        size_t i = 0;
+        for( ; i + LANES <= count; i += LANES ) {
+            TransferErrorRange<simd::VecD>( h, h_inv_ptr, x, y, u, v, i, forward, backward );
+        }
+        for( ; i < count; ++i ) {
+            TransferErrorRange<simd::ScalarD>( h, h_inv_ptr, x, y, u, v, i, forward, backward );
+        }
+    }
+
+    void ErrorSummary::Add( double value ) noexcept
+    {
+        if( !std::isfinite( value ) ) {
+            return;
+        }
+        ++count;
+        sum    += value;
+        sum_sq += value * value;
+        max     = ( value > max ) ? value : max;
+    }
+
+    void ErrorSummary::Finish() noexcept
+    {
+        if( count > 0 ) {
+            mean = sum / static_cast<double>( count );
+            rms  = std::sqrt( sum_sq / static_cast<double>( count ) );
+        }
+    }
+
+    // 청크 하나가 처리할 (뺀 포인트 x 오차 계산 포인트) 수의 목표치. 작은 N은 호출 스레드에서 바로 처리
+    static constexpr size_t LEAVE_ONE_OUT_CHUNK_EVALUATIONS = 8192;
+
+    static cv::Point2d Project( const cv::Matx33d& h, const cv::Point2f& p ) noexcept
+    {
+        const double w = h( 2, 0 ) * p.x + h( 2, 1 ) * p.y + h( 2, 2 );
+        return { ( h( 0, 0 ) * p.x + h( 0, 1 ) * p.y + h( 0, 2 ) ) / w,
+                 ( h( 1, 0 ) * p.x + h( 1, 1 ) * p.y + h( 1, 2 ) ) / w };
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ComputeLeaveOneOut
+    // 설명: 전체 방정식 누적 1회 -> 포인트마다 (복사 + downdate + 9x9 풀이 + O(N) 오차).
+    //       포인트별 결과를 서로 다른 칸에 쓰므로 스레드 수와 관계없이 결과가 같습니다.
+    //--------------------------------------------------------------------------
+    bool ComputeLeaveOneOut( const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst,
+                             std::vector<LeaveOneOut>& results, double& reference_rms, MGEN::WorkerPool* pool )
+    {
+        const size_t n = src.size();
+        if( n != dst.size() || n < 5 ) {
+            return false;
+        }
+
+        // 1. 전체 포인트의 정규화 방정식과 해
+        const PointNormalization src_norm = PointNormalization::FromPoints( src );
+        const PointNormalization dst_norm = PointNormalization::FromPoints( dst );
+        std::vector<cv::Point2d> src_n( n ), dst_n( n );
+        DltSystem full;
+        for( size_t i = 0; i < n; ++i ) {
+            src_n[ i ] = src_norm.Apply( src[ i ] );
+            dst_n[ i ] = dst_norm.Apply( dst[ i ] );
+            full.Accumulate( src_n[ i ], dst_n[ i ], 1.0 );
+        }
+        cv::Matx33d h_normalized;
+        if( !full.Solve( h_normalized ) ) {
+            return false;
+        }
+        const cv::Matx33d h_full = DenormalizeHomography( h_normalized, src_norm, dst_norm );
+
+        std::vector<cv::Point2d> projected( n ); // 전체 해의 투영 (영향도 기준)
+        double sum_sq = 0.0;
+        for( size_t i = 0; i < n; ++i ) {
+            projected[ i ] = Project( h_full, src[ i ] );
+            const double du = projected[ i ].x - dst[ i ].x, dv = projected[ i ].y - dst[ i ].y;
+            sum_sq += du * du + dv * dv;
+        }
+        reference_rms = std::sqrt( sum_sq / static_cast<double>( n ) );
+
+        // 2. 포인트마다 downdate 후 풀이
+        constexpr float NO_VALUE = std::numeric_limits<float>::quiet_NaN();
+        results.assign( n, LeaveOneOut { NO_VALUE, NO_VALUE, NO_VALUE } );
+        MGEN::WorkerPool& workers = ( pool != nullptr ) ? *pool : MGEN::WorkerPool::Shared();
+        const size_t grain = std::max<size_t>( 1, LEAVE_ONE_OUT_CHUNK_EVALUATIONS / n );
+        workers.ParallelFor( n, grain, [ & ]( size_t begin, size_t end ) {
+            for( size_t i = begin; i < end; ++i ) {
+                DltSystem system = full;
+                system.Accumulate( src_n[ i ], dst_n[ i ], -1.0 );
+                cv::Matx33d h_loo_normalized;
+                if( !system.Solve( h_loo_normalized ) ) {
+                    continue;
+                }
+                const cv::Matx33d h_loo = DenormalizeHomography( h_loo_normalized, src_norm, dst_norm );
+
+                double sum_without = 0.0, sum_shift = 0.0, prediction = 0.0;
+                for( size_t j = 0; j < n; ++j ) {
+                    const cv::Point2d p = Project( h_loo, src[ j ] );
+                    const double sx = p.x - projected[ j ].x, sy = p.y - projected[ j ].y;
+                    const double du = p.x - dst[ j ].x, dv = p.y - dst[ j ].y;
+                    sum_shift += sx * sx + sy * sy;
+                    if( j == i ) {
+                        prediction = std::sqrt( du * du + dv * dv );
+                    }
+                    else {
+                        sum_without += du * du + dv * dv;
+                    }
+                }
+                results[ i ] = LeaveOneOut { static_cast<float>( prediction ),
+                                             static_cast<float>( std::sqrt( sum_without / static_cast<double>( n - 1 ) ) ),
+                                             static_cast<float>( std::sqrt( sum_shift / static_cast<double>( n ) ) ) };
+            }
+        } );
+        return true;
+    }
+
+} // nsp::MGEN::MVEM
@@ -0,0 +1,87 @@
+#ifndef _MGEN_MVEM_HOMOGRAPHY_METRICS_H_
+#define _MGEN_MVEM_HOMOGRAPHY_METRICS_H_
+
+/* ====================================
+ * Homography Quality Metrics Header
+ * ------------------------------------
+ * Desc   : 추정한 호모그래피의 대응점별 재투영 오차(전방/역방향)와 요약 통계.
+ * 오차는 SoA 버퍼에 대해 SIMD로 한 번에 계산하므로 추정 비용에 비해 무시할 만합니다.
+ * leave-one-out 진단은 전체 DLT 정규 방정식에서 포인트 하나씩을 빼는(downdate) 방식으로 N번의 전체 재계산을 피합니다.
+ * ==================================== */
+
+// OpenCV Core Types
+#include <opencv2/core/types.hpp> // cv::Matx33d
+
+// STL
+#include <cstddef>
+#include <vector>
+
+namespace MGEN { class WorkerPool; }
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    /**
+     * @brief 대응점별 전방/역방향 재투영 오차를 계산합니다.
+     *   forward[i]  = | H * (x, y) - (u, v) |       (지상 좌표 단위)
+     *   backward[i] = | H^-1 * (u, v) - (x, y) |    (보정된 픽셀 단위)
+     * 두 값은 단위가 다르므로 합치지 말고 각각 비교해야 합니다.
+     * 무한원점으로 가는 포인트는 NaN입니다.
+     * @param x, y               보정된 카메라 픽셀 좌표 (SoA, 길이 count)
+     * @param u, v               지상 좌표 (SoA, 길이 count)
+     * @param inverse_homography H^-1 (nullptr이면 backward를 모두 NaN으로 채움)
+     * @param forward, backward  [출력] 길이 count.
+     */
+    void ComputeTransferErrors( const float* x, const float* y, const float* u, const float* v, size_t count,
+                                const cv::Matx33d& homography, const cv::Matx33d* inverse_homography,
+                                float* forward, float* backward ) noexcept;
+
+    /**
+     * @brief 오차 배열의 요약 통계.
+     */
+    struct ErrorSummary
+    {
+        size_t count = 0;   /**< 유한한 값의 개수 */
+        double rms   = 0.0;
+        double mean  = 0.0;
+        double max   = 0.0;
+
+        /** 값 하나를 더합니다. (NaN/무한대는 무시) */
+        void Add( double value ) noexcept;
+
+        /** Add를 모두 마친 뒤 호출: 누적합을 rms/mean으로 바꿉니다. */
+        void Finish() noexcept;
+
+    private:
+        double sum    = 0.0;
+        double sum_sq = 0.0;
+    };
+
+    /**
+     * @brief 포인트 하나를 뺀 DLT 해로 본 그 포인트의 진단 값. (계산할 수 없으면 NaN)
+     */
+    struct LeaveOneOut
+    {
+        float prediction_error; /**< 뺀 포인트의 예측 오차 |H_-i * x_i - x'_i| (지상 좌표 단위) */
+        float rms_without;      /**< H_-i의 나머지 포인트 재투영 RMS (지상 좌표 단위) */
+        float influence;        /**< 전체 해와의 차이: 모든 포인트에서 |H * x_j - H_-i * x_j|의 RMS (지상 좌표 단위) */
+    };
+
+    /**
+     * @brief 모든 포인트에 대해 leave-one-out 진단 값을 계산합니다.
+     * 전체 포인트로 정규화 DLT 정규 방정식(9x9)을 한 번 누적한 뒤, 포인트마다 그 복사본에서 해당 쌍을 빼고(랭크 2 downdate)
+     * 풀기만 하므로 N번의 전체 재계산 대신 N번의 9x9 풀이 + O(N) 오차 계산으로 끝납니다.
+     * 해는 LM 보정 없는 대수적 DLT 해이며(정규화 변환은 전체 포인트 기준을 공유), 포인트 단위로 공용 워커 풀에서 병렬 계산합니다.
+     * 기준 해는 입력 전체의 최소제곱 해이므로 아웃라이어가 섞이면 influence/reference_rms가 아웃라이어에 끌려갑니다.
+     * 강건 추정 결과를 진단할 때는 그 모델의 인라이어만 넘기십시오.
+     * @param src, dst  대응점 (보정된 카메라 픽셀 -> 지상 좌표), 5쌍 이상.
+     * @param results   [출력] 입력 순서의 진단 값.
+     * @param reference_rms [출력] 전체 포인트 DLT 해의 재투영 RMS.
+     * @param pool      nullptr이면 WorkerPool::Shared().
+     * @return 포인트가 5쌍 미만이거나 전체 해를 구하지 못하면 false.
+     */
+    bool ComputeLeaveOneOut( const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst,
+                             std::vector<LeaveOneOut>& results, double& reference_rms, MGEN::WorkerPool* pool = nullptr );
+
+} // nsp::MGEN::MVEM
+
+#endif // _MGEN_MVEM_HOMOGRAPHY_METRICS_H_
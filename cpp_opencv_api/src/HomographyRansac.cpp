@@ -0,0 +1,308 @@
+#include "HomographyRansac.h"
+#include "CalibratorKernels.h" // simd::VecD, simd::ScalarD, simd::HomographyCoeffs
+#include "HomographyDlt.h"
+#include "WorkerPool.h"
+
+// STL::C++
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    // 청크 하나가 처리할 (가설 x 점) 평가 수의 목표치. 작은 N에서는 한 라운드를 호출 스레드에서 바로 처리
+    static constexpr size_t PARALLEL_POINT_EVALUATIONS = 8192;
+
+    // 가설 하나가 퇴화하지 않은 4점 표본을 찾기 위해 시도하는 최대 횟수 (OpenCV와 같은 수준)
+    static constexpr int MAX_SAMPLE_ATTEMPTS = 100;
+
+    // 최고 가설의 인라이어로 재적합/재판정을 반복하는 최대 횟수
+    static constexpr int MAX_REFINE_PASSES = 3;
+
+    /**
+     * @brief 점수 계산용 SoA 버퍼 (x, y: 보정된 카메라 좌표 / u, v: 지상 좌표).
+     */
+    struct RansacPoints
+    {
+        std::vector<float> x, y, u, v;
+        size_t             count = 0;
+    };
+
+    /**
+     * @brief 가설 하나의 평가 결과.
+     */
+    struct RansacHypothesis
+    {
+        cv::Matx33d homography;
+        size_t      inliers = 0;
+        bool        valid   = false;
+    };
+
+    /**
+     * @brief 가설 번호별 표본 생성기 (SplitMix64).
+     * 상태가 (seed, index)만으로 정해지므로 어느 스레드에서 평가하든 같은 표본이 나옵니다.
+     */
+    class SampleGenerator
+    {
+    public:
+        SampleGenerator( uint64_t seed, uint64_t index ) noexcept
+            : state( seed + index * 0xD1B54A32D192ED03ull )
+        {
+        }
+
+        uint64_t Next() noexcept
+        {
+            uint64_t z = ( state += 0x9E3779B97F4A7C15ull );
+            z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+            z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull;
+            return z ^ ( z >> 31 );
+        }
+
+        size_t Uniform( size_t n ) noexcept { return static_cast<size_t>( Next() % n ); }
+
+    private:
+        uint64_t state;
+    }; // cls::SampleGenerator
+
+    static RansacPoints MakeRansacPoints( const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst )
+    {
+        RansacPoints points;
+        points.count = src.size();
+        points.x.resize( points.count );
+        points.y.resize( points.count );
+        points.u.resize( points.count );
+        points.v.resize( points.count );
+        for( size_t i = 0; i < points.count; ++i ) {
+            points.x[ i ] = src[ i ].x;
+            points.y[ i ] = src[ i ].y;
+            points.u[ i ] = dst[ i ].x;
+            points.v[ i ] = dst[ i ].y;
+        }
+        return points;
+    }
+
+    /**
+     * @brief 레인별로 H * (x, y, 1)의 재투영 오차 제곱을 임계값과 비교해 인라이어 비트를 돌려줍니다.
+     * W가 0인 레인은 inf/NaN이 되어 비교가 거짓이므로 아웃라이어로 처리됩니다.
+     */
+    template<class V>
+    inline unsigned InlierBitsLanes( const simd::HomographyCoeffs& h, const V& x, const V& y, const V& u, const V& v,
+                                     const V& threshold_sq ) noexcept
+    {
+        const V X = V::Set1( h.h00 ) * x + V::Set1( h.h01 ) * y + V::Set1( h.h02 );
+        const V Y = V::Set1( h.h10 ) * x + V::Set1( h.h11 ) * y + V::Set1( h.h12 );
+        const V W = V::Set1( h.h20 ) * x + V::Set1( h.h21 ) * y + V::Set1( h.h22 );
+        const V inv_w = V::Set1( 1.0 ) / W;
+        const V du = X * inv_w - u;
+        const V dv = Y * inv_w - v;
+        return simd::MaskBits( simd::Less( du * du + dv * dv, threshold_sq ) );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ScoreHypothesis (파일 내부)
+    // 설명: 인라이어 수를 셉니다. mask가 있으면 점별 인라이어 여부도 기록합니다.
+    //       mask가 없을 때는 남은 점이 모두 인라이어여도 must_exceed를 넘지 못하는 순간 0을 반환합니다.
+    //--------------------------------------------------------------------------
+    static size_t ScoreHypothesis( const RansacPoints& points, const cv::Matx33d& homography, double threshold_sq,
+                                   size_t must_exceed, unsigned char* mask ) noexcept
+    {
+        constexpr size_t LANES = simd::VecD::LANES;
+        const simd::HomographyCoeffs h = simd::MakeHomography( homography );
+        const float* x = points.x.data();
+        const float* y = points.y.data();
+        const float* u = points.u.data();
+        const float* v = points.v.data();
+        const size_t n = points.count;
+
+        size_t inliers = 0;
+        size_t i = 0;
+        const simd::VecD threshold_lanes = simd::VecD::Set1( threshold_sq );
+        for( ; i + LANES <= n; i += LANES ) {
+            const unsigned bits = InlierBitsLanes( h, simd::VecD::LoadF( x + i ), simd::VecD::LoadF( y + i ),
+                                                   simd::VecD::LoadF( u + i ), simd::VecD::LoadF( v + i ), threshold_lanes );
+            inliers += std::bitset<LANES>( bits ).count();
+            if( mask != nullptr ) {
+                for( size_t l = 0; l < LANES; ++l ) {
+                    mask[ i + l ] = static_cast<unsigned char>( ( bits >> l ) & 1u );
+                }
+            }
+            else if( inliers + ( n - i - LANES ) <= must_exceed ) {
+                return 0;
+            }
+        }
+
+        // 꼬리 (LANES 미만)
+        const simd::ScalarD threshold_scalar = simd::ScalarD::Set1( threshold_sq );
+        for( ; i < n; ++i ) {
+            const unsigned bit = InlierBitsLanes( h, simd::ScalarD::LoadF( x + i ), simd::ScalarD::LoadF( y + i ),
+                                                  simd::ScalarD::LoadF( u + i ), simd::ScalarD::LoadF( v + i ), threshold_scalar );
+            inliers += bit;
+            if( mask != nullptr ) {
+                mask[ i ] = static_cast<unsigned char>( bit );
+            }
+        }
+        return inliers;
+    }
+
+    static double Orientation( const cv::Point2f& a, const cv::Point2f& b, const cv::Point2f& c ) noexcept
+    {
+        return ( static_cast<double>( b.x ) - a.x ) * ( static_cast<double>( c.y ) - a.y ) -
+               ( static_cast<double>( b.y ) - a.y ) * ( static_cast<double>( c.x ) - a.x );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ConsistentSample (파일 내부)
+    // 설명: 호모그래피는 네 점 중 세 점으로 만든 모든 삼각형의 방향을 한꺼번에 유지하거나 뒤집습니다.
+    //       일부만 뒤집히거나 세 점이 한 직선 위에 있는 표본은 풀지 않고 버립니다. (OpenCV checkSubset과 같은 규칙)
+    //--------------------------------------------------------------------------
+    static bool ConsistentSample( const cv::Point2f* src, const cv::Point2f* dst ) noexcept
+    {
+        static constexpr int TRIPLES[ 4 ][ 3 ] = { { 0, 1, 2 }, { 0, 1, 3 }, { 0, 2, 3 }, { 1, 2, 3 } };
+        int flipped = 0;
+        for( const auto& t : TRIPLES ) {
+            const double product = Orientation( src[ t[ 0 ] ], src[ t[ 1 ] ], src[ t[ 2 ] ] ) *
+                                   Orientation( dst[ t[ 0 ] ], dst[ t[ 1 ] ], dst[ t[ 2 ] ] );
+            if( product == 0.0 ) {
+                return false;
+            }
+            flipped += ( product < 0.0 ) ? 1 : 0;
+        }
+        return flipped == 0 || flipped == 4;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: EvaluateHypothesis (파일 내부)
+    // 설명: 가설 index의 4점 표본을 뽑아 FitHomographyDlt로 풀고 점수를 매깁니다.
+    //--------------------------------------------------------------------------
+    static RansacHypothesis EvaluateHypothesis( const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst,
+                                                const RansacPoints& points, uint64_t seed, uint64_t index,
+                                                double threshold_sq, size_t must_exceed ) noexcept
+    {
+        RansacHypothesis hypothesis;
+        SampleGenerator generator( seed, index );
+        const size_t n = src.size();
+
+        for( int attempt = 0; attempt < MAX_SAMPLE_ATTEMPTS && !hypothesis.valid; ++attempt ) {
+            size_t sample[ 4 ];
+            for( int j = 0; j < 4; ++j ) {
+                bool duplicate = true;
+                while( duplicate ) {
+                    sample[ j ] = generator.Uniform( n );
+                    duplicate = std::find( sample, sample + j, sample[ j ] ) != sample + j;
+                }
+            }
+
+            cv::Point2f sample_src[ 4 ], sample_dst[ 4 ];
+            for( int j = 0; j < 4; ++j ) {
+                sample_src[ j ] = src[ sample[ j ] ];
+                sample_dst[ j ] = dst[ sample[ j ] ];
+            }
+            hypothesis.valid = ConsistentSample( sample_src, sample_dst ) &&
+                               FitHomographyDlt( sample_src, sample_dst, 4, hypothesis.homography, 0 );
+        }
+
+        if( hypothesis.valid ) {
+            hypothesis.inliers = ScoreHypothesis( points, hypothesis.homography, threshold_sq, must_exceed, nullptr );
+        }
+        return hypothesis;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: FindHomographyParallelRansac
+    // 설명: 라운드 단위 병렬 가설 평가 -> 적응형 종료 -> 인라이어 재적합.
+    //       라운드 안의 가설은 라운드 시작 시점의 최고 점수로만 조기 중단하므로 결과가 스케줄링과 무관합니다.
+    //--------------------------------------------------------------------------
+    bool FindHomographyParallelRansac( const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst,
+                                       const HomographyEstimatorOptions& options, HomographyEstimate& estimate,
+                                       MGEN::WorkerPool* pool )
+    {
+        const size_t n = src.size();
+        if( n != dst.size() || n < 4 ) {
+            return false;
+        }
+
+        MGEN::WorkerPool& workers = ( pool != nullptr ) ? *pool : MGEN::WorkerPool::Shared();
+        const RansacPoints points = MakeRansacPoints( src, dst );
+        const double threshold_sq = options.ransac_threshold * options.ransac_threshold;
+
+        // 1. 라운드 단위 가설 평가
+        std::vector<RansacHypothesis> round( RANSAC_ROUND_HYPOTHESES );
+        const size_t grain = std::clamp<size_t>( PARALLEL_POINT_EVALUATIONS / n, 1, RANSAC_ROUND_HYPOTHESES );
+
+        RansacHypothesis best;
+        size_t evaluated = 0;
+        size_t limit     = static_cast<size_t>( std::max( 1, options.max_iterations ) );
+        size_t round_size = RANSAC_FIRST_ROUND_HYPOTHESES;
+        while( evaluated < limit ) {
+            const size_t batch       = std::min( round_size, limit - evaluated );
+            const size_t first       = evaluated;
+            const size_t must_exceed = best.inliers;
+            workers.ParallelFor( batch, grain, [ & ]( size_t begin, size_t end ) {
+                for( size_t k = begin; k < end; ++k ) {
+                    round[ k ] = EvaluateHypothesis( src, dst, points, options.seed, first + k, threshold_sq, must_exceed );
+                }
+            } );
+
+            // 가설 번호 순서로 비교 (동점이면 먼저 나온 가설 유지)
+            for( size_t k = 0; k < batch; ++k ) {
+                if( round[ k ].valid && ( !best.valid || round[ k ].inliers > best.inliers ) ) {
+                    best = round[ k ];
+                }
+            }
+            evaluated += batch;
+            round_size = std::min( round_size * 2, RANSAC_ROUND_HYPOTHESES );
+
+            // 2. 적응형 종료: 최고 인라이어 비율로 필요한 가설 수를 다시 계산
+            if( best.inliers > 0 ) {
+                const double inlier_ratio = static_cast<double>( best.inliers ) / static_cast<double>( n );
+                const int needed = HomographyEstimator::AdaptiveIterations( options.confidence, inlier_ratio, options.max_iterations );
+                limit = std::min( limit, static_cast<size_t>( needed ) );
+            }
+        }
+        if( !best.valid ) {
+            return false;
+        }
+
+        // 3. 인라이어 재적합: 인라이어가 늘어나는 동안 (정규화 DLT + LM) -> 재판정 반복
+        std::vector<unsigned char> mask( n ), refined_mask( n );
+        cv::Matx33d homography = best.homography;
+        size_t inliers = ScoreHypothesis( points, homography, threshold_sq, 0, mask.data() );
+
+        std::vector<cv::Point2f> inlier_src, inlier_dst;
+        inlier_src.reserve( inliers );
+        inlier_dst.reserve( inliers );
+        for( int pass = 0; pass < MAX_REFINE_PASSES; ++pass ) {
+            inlier_src.clear();
+            inlier_dst.clear();
+            for( size_t i = 0; i < n; ++i ) {
+                if( mask[ i ] != 0 ) {
+                    inlier_src.push_back( src[ i ] );
+                    inlier_dst.push_back( dst[ i ] );
+                }
+            }
+
+            cv::Matx33d refined;
+            if( inlier_src.size() < 4 ||
+                !FitHomographyDlt( inlier_src.data(), inlier_dst.data(), inlier_src.size(), refined, options.refine_iterations ) ) {
+                break;
+            }
+            const size_t refined_inliers = ScoreHypothesis( points, refined, threshold_sq, 0, refined_mask.data() );
+            if( refined_inliers < inliers ) {
+                break;
+            }
+            const bool grew = refined_inliers > inliers;
+            homography = refined;
+            inliers    = refined_inliers;
+            mask.swap( refined_mask );
+            if( !grew ) {
+                break;
+            }
+        }
+
+        estimate.homography  = homography;
+        estimate.inlier_mask = std::move( mask );
+        estimate.iterations  = static_cast<int>( evaluated );
+        return true;
+    }
+
+} // nsp::MGEN::MVEM
@@ -0,0 +1,54 @@
+#ifndef _MGEN_MVEM_HOMOGRAPHY_RANSAC_H_
+#define _MGEN_MVEM_HOMOGRAPHY_RANSAC_H_
+
+/* ====================================
+ * Parallel Homography RANSAC Header
+ * ------------------------------------
+ * Desc   : 대량의 자동 대응점(특징점 매칭 등)을 위한 자체 RANSAC.
+ * 점을 SoA(x, y, u, v 배열) float 버퍼로 한 번 복사한 뒤, 가설 점수(인라이어 수)를 SIMD 재투영 오차로 계산하고
+ * 가설들을 공용 워커 풀에서 병렬로 평가합니다. 가설 i의 표본은 (seed, i)만으로 정해지므로
+ * 스레드 수나 스케줄링과 관계없이 결과가 같습니다.
+ * ==================================== */
+
+#include "HomographyEstimator.h"
+
+// OpenCV Core Types
+#include <opencv2/core/types.hpp> // cv::Point2f
+
+// STL
+#include <cstddef>
+#include <vector>
+
+namespace MGEN { class WorkerPool; }
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    /**
+     * @brief 병렬 RANSAC 호모그래피 추정.
+     * 1) 라운드마다 가설(4점 표본 -> FitHomographyDlt)을 병렬로 점수 매기고,
+     *    라운드가 끝나면 최고 점수(동점이면 작은 가설 번호)를 고릅니다.
+     * 2) 최고 인라이어 비율 w로 적응형 반복 횟수 k = log(1 - confidence) / log(1 - w^4)를 갱신하며,
+     *    평가한 가설 수가 min(k, max_iterations)에 이르면 종료합니다.
+     * 3) 최고 가설의 인라이어로 FitHomographyDlt(refine_iterations회 LM)를 다시 풀고,
+     *    인라이어가 늘어나는 동안 재판정/재적합을 반복합니다.
+     * estimate.iterations는 실제로 평가한 가설 수입니다.
+     * @param src, dst 대응점 (길이가 같아야 함, 4개 이상).
+     * @param options  ransac_threshold, confidence, max_iterations, refine_iterations, seed 사용.
+     * @param pool     가설 평가에 사용할 풀 (nullptr이면 WorkerPool::Shared()).
+     * @return 성공 여부 (유효한 가설을 하나도 만들지 못하면 false).
+     */
+    bool FindHomographyParallelRansac( const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst,
+                                       const HomographyEstimatorOptions& options, HomographyEstimate& estimate,
+                                       MGEN::WorkerPool* pool = nullptr );
+
+    /**
+     * 라운드당 가설 수: 첫 라운드 8개에서 두 배씩 늘려 최대 64개.
+     * 라운드 경계에서만 적응형 종료를 판단하므로 결과가 스레드 수와 무관하고,
+     * 아웃라이어가 적은 입력은 첫 라운드에서 바로 끝납니다.
+     */
+    constexpr size_t RANSAC_FIRST_ROUND_HYPOTHESES = 8;
+    constexpr size_t RANSAC_ROUND_HYPOTHESES       = 64;
+
+} // nsp::MGEN::MVEM
+
+#endif // _MGEN_MVEM_HOMOGRAPHY_RANSAC_H_
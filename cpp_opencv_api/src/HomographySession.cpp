@@ -0,0 +1,362 @@
+#include "HomographySession.h"
+
+// OpenCV
+#include <opencv2/core.hpp> // cv::DECOMP_LU
+
+// STL::C++
+#include <cmath>
+#include <cstdio>
+#include <optional>
+#include <utility>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    HomographySession::HomographySession( std::string id_, std::shared_ptr<const Calibrator> calibrator_,
+                                          const HomographyEstimatorOptions& estimator_options_ )
+        : id( std::move( id_ ) )
+        , calibrator( std::move( calibrator_ ) )
+        , estimator_options( estimator_options_ )
+        , last_used( std::chrono::steady_clock::now() )
+    {
+    }
+
+    std::chrono::steady_clock::time_point HomographySession::getLastUsed() const
+    {
+        std::lock_guard<std::mutex> guard( lock );
+        return last_used;
+    }
+
+    void HomographySession::AccumulateLocked( const SurveyPoint& point, double weight )
+    {
+        system.Accumulate( src_norm.Apply( point.undistorted ), dst_norm.Apply( point.ground ), weight );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: RebuildLocked
+    // 설명: 활성 포인트로 정규화(중심/스케일)를 다시 정하고 방정식을 처음부터 누적합니다.
+    //       빼기가 쌓이며 생긴 반올림 오차와, 포인트 분포가 바뀌어 낡은 정규화도 함께 정리됩니다.
+    //--------------------------------------------------------------------------
+    void HomographySession::RebuildLocked()
+    {
+        std::vector<cv::Point2f> src_points, dst_points;
+        src_points.reserve( points.size() );
+        dst_points.reserve( points.size() );
+        for( const auto& [ point_id, point ] : points ) {
+            if( point.active ) {
+                src_points.push_back( point.undistorted );
+                dst_points.push_back( point.ground );
+            }
+        }
+        src_norm = PointNormalization::FromPoints( src_points );
+        dst_norm = PointNormalization::FromPoints( dst_points );
+
+        system.Reset();
+        for( const auto& [ point_id, point ] : points ) {
+            if( point.active ) {
+                AccumulateLocked( point, 1.0 );
+            }
+        }
+        downdates = 0;
+    }
+
+    void HomographySession::AfterDowndateLocked()
+    {
+        if( ++downdates >= REBUILD_INTERVAL ) {
+            RebuildLocked();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: AddPoint
+    // 설명: 활성 포인트가 4개 미만일 때는 정규화가 아직 의미 없으므로 전체를 다시 누적하고,
+    //       그 이후에는 현재 정규화로 두 행만 더합니다.
+    //--------------------------------------------------------------------------
+    HomographySession::EditStatus HomographySession::AddPoint( const cv::Point2f& camera, const cv::Point2f& ground, uint64_t& point_id )
+    {
+        const std::optional<cv::Point2f> undistorted = calibrator->Calibrate( camera );
+        if( !undistorted ) {
+            return EditStatus::CALIBRATION_FAILED;
+        }
+
+        std::lock_guard<std::mutex> guard( lock );
+        SurveyPoint point;
+        point.id          = ++next_id;
+        point.camera      = camera;
+        point.undistorted = *undistorted;
+        point.ground      = ground;
+        point.active      = true;
+        points.emplace( point.id, point );
+
+        if( system.pairs() < 4 ) {
+            RebuildLocked();
+        } else {
+            AccumulateLocked( point, 1.0 );
+        }
+        ++revision;
+        last_used = std::chrono::steady_clock::now();
+        point_id  = point.id;
+        return EditStatus::OK;
+    }
+
+    HomographySession::EditStatus HomographySession::UpdatePoint( uint64_t point_id, const cv::Point2f& camera, const cv::Point2f& ground )
+    {
+        const std::optional<cv::Point2f> undistorted = calibrator->Calibrate( camera );
+        if( !undistorted ) {
+            return EditStatus::CALIBRATION_FAILED;
+        }
+
+        std::lock_guard<std::mutex> guard( lock );
+        const auto it = points.find( point_id );
+        if( it == points.end() ) {
+            return EditStatus::NOT_FOUND;
+        }
+
+        SurveyPoint& point = it->second;
+        const bool was_active = point.active;
+        if( was_active ) {
+            AccumulateLocked( point, -1.0 );
+        }
+        point.camera      = camera;
+        point.undistorted = *undistorted;
+        point.ground      = ground;
+        point.active      = true;
+
+        if( system.pairs() < 4 ) {
+            RebuildLocked();
+        } else {
+            AccumulateLocked( point, 1.0 );
+            if( was_active ) {
+                AfterDowndateLocked();
+            }
+        }
+        ++revision;
+        last_used = std::chrono::steady_clock::now();
+        return EditStatus::OK;
+    }
+
+    HomographySession::EditStatus HomographySession::RemovePoint( uint64_t point_id )
+    {
+        std::lock_guard<std::mutex> guard( lock );
+        const auto it = points.find( point_id );
+        if( it == points.end() ) {
+            return EditStatus::NOT_FOUND;
+        }
+
+        if( it->second.active ) {
+            AccumulateLocked( it->second, -1.0 );
+            points.erase( it );
+            AfterDowndateLocked();
+        } else {
+            points.erase( it );
+        }
+        ++revision;
+        last_used = std::chrono::steady_clock::now();
+        return EditStatus::OK;
+    }
+
+    void HomographySession::Rebuild()
+    {
+        std::lock_guard<std::mutex> guard( lock );
+        RebuildLocked();
+    }
+
+    HomographySession::Solution HomographySession::Solve()
+    {
+        const auto started = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> guard( lock );
+        last_used = started;
+        return SolveLocked( started );
+    }
+
+    HomographySession::Solution HomographySession::Solve( std::vector<SurveyPoint>& points_out )
+    {
+        const auto started = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> guard( lock );
+        last_used = started;
+        points_out.clear();
+        points_out.reserve( points.size() );
+        for( const auto& [ point_id, point ] : points ) {
+            points_out.push_back( point );
+        }
+        return SolveLocked( started );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: SolveLocked
+    // 설명: 9x9 방정식을 풀어 역정규화하고, 활성 포인트의 재투영 RMS 오차를 계산합니다.
+    //--------------------------------------------------------------------------
+    HomographySession::Solution HomographySession::SolveLocked( std::chrono::steady_clock::time_point started )
+    {
+        Solution solution;
+        solution.points   = points.size();
+        solution.revision = revision;
+        solution.active_points = static_cast<size_t>( system.pairs() > 0 ? system.pairs() : 0 );
+
+        cv::Matx33d h_normalized;
+        if( system.Solve( h_normalized ) )
+        {
+            solution.homography = DenormalizeHomography( h_normalized, src_norm, dst_norm );
+
+            const cv::Matx33d& h = solution.homography;
+            double sum_sq = 0.0;
+            bool   finite = true;
+            for( const auto& [ point_id, point ] : points ) {
+                if( !point.active ) {
+                    continue;
+                }
+                const double x = point.undistorted.x, y = point.undistorted.y;
+                const double w = h( 2, 0 ) * x + h( 2, 1 ) * y + h( 2, 2 );
+                const double u = ( h( 0, 0 ) * x + h( 0, 1 ) * y + h( 0, 2 ) ) / w;
+                const double v = ( h( 1, 0 ) * x + h( 1, 1 ) * y + h( 1, 2 ) ) / w;
+                const double du = u - point.ground.x, dv = v - point.ground.y;
+                sum_sq += du * du + dv * dv;
+                finite = finite && std::isfinite( du ) && std::isfinite( dv );
+            }
+            solution.valid = finite;
+            solution.rms_error = ( finite && solution.active_points > 0 ) ? std::sqrt( sum_sq / static_cast<double>( solution.active_points ) ) : 0.0;
+        }
+
+        solution.solve_us = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now() - started ).count();
+        return solution;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Refit
+    // 설명: 전체 포인트(비활성 포함)를 calculate_dynamic과 같은 정렬 순서로 세션의 추정 방식에 넣어
+    //       인라이어를 다시 판정하고, 인라이어만으로 정규화와 방정식을 새로 만듭니다.
+    //--------------------------------------------------------------------------
+    bool HomographySession::Refit( ResultCache::Result& result, std::string& error )
+    {
+        std::lock_guard<std::mutex> guard( lock );
+        last_used = std::chrono::steady_clock::now();
+
+        if( points.size() < 4 ) {
+            error = "Not enough points to calculate homography (minimum 4 required).";
+            return false;
+        }
+
+        // 1. calculate_dynamic과 같은 입력 순서 (원본 카메라 좌표 + 지상 좌표로 정렬)
+        std::vector<SurveyPoint*> by_id;
+        std::vector<SurveyPair> pairs;
+        by_id.reserve( points.size() );
+        pairs.reserve( points.size() );
+        for( auto& [ point_id, point ] : points ) {
+            by_id.push_back( &point );
+            pairs.push_back( { point.camera, point.ground } );
+        }
+        std::vector<size_t> order;
+        ResultCache::Canonicalize( pairs, order );
+
+        std::vector<cv::Point2f> src_points, dst_points;
+        src_points.reserve( order.size() );
+        dst_points.reserve( order.size() );
+        for( size_t k : order ) {
+            src_points.push_back( by_id[ k ]->undistorted );
+            dst_points.push_back( by_id[ k ]->ground );
+        }
+
+        // 2. 세션의 추정 방식으로 추정
+        HomographyEstimate estimate;
+        if( !HomographyEstimator::Estimate( src_points, dst_points, estimator_options, estimate, error ) ) {
+            return false;
+        }
+
+        result = ResultCache::Result();
+        result.homography = estimate.homography;
+        result.inverse_homography = result.homography.inv( cv::DECOMP_LU, &result.invertible );
+        result.points_used = src_points.size();
+        result.iterations = estimate.iterations;
+        result.solver_path = estimate.path;
+        result.inlier_mask = estimate.inlier_mask;
+
+        for( size_t k = 0; k < order.size(); ++k ) {
+            SurveyPoint& point = *by_id[ order[ k ] ];
+            point.active = ( k < estimate.inlier_mask.size() && estimate.inlier_mask[ k ] != 0 );
+            if( point.active ) {
+                result.inlier_image_points.push_back( point.undistorted );
+                result.inlier_ground_points.push_back( point.ground );
+            }
+        }
+
+        RebuildLocked();
+        ++revision;
+        return true;
+    }
+
+    std::vector<HomographySession::SurveyPoint> HomographySession::Points() const
+    {
+        std::lock_guard<std::mutex> guard( lock );
+        std::vector<SurveyPoint> out;
+        out.reserve( points.size() );
+        for( const auto& [ point_id, point ] : points ) {
+            out.push_back( point );
+        }
+        return out;
+    }
+
+    SessionStore::SessionStore( size_t max_sessions_, std::chrono::minutes idle_ttl_ )
+        : max_sessions( max_sessions_ > 0 ? max_sessions_ : 1 )
+        , idle_ttl( idle_ttl_ )
+        , id_generator( std::random_device {}() )
+    {
+    }
+
+    void SessionStore::PurgeLocked( std::chrono::steady_clock::time_point now )
+    {
+        for( auto it = sessions.begin(); it != sessions.end(); ) {
+            if( now - it->second->getLastUsed() >= idle_ttl ) {
+                it = sessions.erase( it );
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    std::shared_ptr<HomographySession> SessionStore::Create( std::shared_ptr<const Calibrator> calibrator,
+                                                             const HomographyEstimatorOptions& estimator_options )
+    {
+        std::lock_guard<std::mutex> guard( lock );
+        PurgeLocked( std::chrono::steady_clock::now() );
+        if( sessions.size() >= max_sessions ) {
+            return nullptr;
+        }
+
+        std::string id;
+        do {
+            char buffer[ 17 ];
+            std::snprintf( buffer, sizeof( buffer ), "%016llx", static_cast<unsigned long long>( id_generator() ) );
+            id = buffer;
+        } while( sessions.count( id ) != 0 );
+
+        auto session = std::make_shared<HomographySession>( id, std::move( calibrator ), estimator_options );
+        sessions.emplace( id, session );
+        return session;
+    }
+
+    std::shared_ptr<HomographySession> SessionStore::Find( const std::string& id )
+    {
+        std::lock_guard<std::mutex> guard( lock );
+        const auto it = sessions.find( id );
+        if( it == sessions.end() ) {
+            return nullptr;
+        }
+        if( std::chrono::steady_clock::now() - it->second->getLastUsed() >= idle_ttl ) {
+            sessions.erase( it );
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    bool SessionStore::Remove( const std::string& id )
+    {
+        std::lock_guard<std::mutex> guard( lock );
+        return sessions.erase( id ) > 0;
+    }
+
+    size_t SessionStore::size() const
+    {
+        std::lock_guard<std::mutex> guard( lock );
+        return sessions.size();
+    }
+
+} // nsp::MGEN::MVEM
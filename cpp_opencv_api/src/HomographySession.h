@@ -0,0 +1,215 @@
+#ifndef _MGEN_MVEM_HOMOGRAPHY_SESSION_H_
+#define _MGEN_MVEM_HOMOGRAPHY_SESSION_H_
+
+/* ====================================
+ * Incremental Homography Session Class Header
+ * ------------------------------------
+ * Desc   : 주석 UI의 편집 세션. 보정된 서베이 포인트와 정규화된 DLT 정규 방정식을 메모리에 유지하여,
+ * 포인트 하나의 추가/이동/삭제를 랭크 2 갱신으로 반영하고 곧바로 최소제곱 해를 돌려줍니다.
+ * 전체 강건 재계산(아웃라이어 판정)은 요청할 때만 세션의 추정 방식(HomographyEstimator)으로 수행합니다.
+ * ==================================== */
+
+#include "Calibrator.h"
+#include "HomographyDlt.h"
+#include "HomographyEstimator.h"
+#include "ResultCache.h"
+
+// OpenCV Core Types
+#include <opencv2/core/types.hpp> // cv::Matx33d, cv::Point2f
+
+// STL
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    /**
+     * @brief 증분 호모그래피 편집 세션.
+     * 모든 public 함수는 세션 내부 mutex로 직렬화되므로 여러 요청이 같은 세션을 동시에 사용해도 됩니다.
+     */
+    class HomographySession
+    {
+    public:
+        /**
+         * @brief 세션의 서베이 포인트.
+         */
+        struct SurveyPoint
+        {
+            uint64_t    id = 0;          /**< 세션 안에서 부여한 포인트 ID */
+            cv::Point2f camera;          /**< 왜곡된 카메라 픽셀 좌표 (입력 그대로) */
+            cv::Point2f undistorted;     /**< 보정된 카메라 픽셀 좌표 */
+            cv::Point2f ground;          /**< 지상 좌표 */
+            bool        active = true;   /**< 정규 방정식 포함 여부 (마지막 RANSAC에서 아웃라이어면 false) */
+        };
+
+        /**
+         * @brief 현재 정규 방정식의 최소제곱 해.
+         */
+        struct Solution
+        {
+            bool        valid = false;    /**< 활성 포인트가 4개 이상이고 해가 유한한지 */
+            cv::Matx33d homography;       /**< 보정된 픽셀 -> 지상 좌표 */
+            size_t      points = 0;       /**< 전체 포인트 수 */
+            size_t      active_points = 0;/**< 정규 방정식에 포함된 포인트 수 */
+            double      rms_error = 0.0;  /**< 활성 포인트의 재투영 RMS 오차 (지상 좌표 단위) */
+            double      solve_us = 0.0;   /**< 풀이(고유값 분해 + 오차 계산)에 걸린 시간 (마이크로초) */
+            uint64_t    revision = 0;     /**< 편집할 때마다 1씩 증가 */
+        };
+
+        /** 이 횟수만큼 빼기(downdate)가 누적되면 반올림 오차를 없애기 위해 방정식을 다시 누적 */
+        static constexpr size_t REBUILD_INTERVAL = 256;
+
+        /**
+         * @param estimator_options Refit에 사용할 추정 방식 (calculate_dynamic의 "estimator"와 같은 옵션).
+         */
+        HomographySession( std::string id, std::shared_ptr<const Calibrator> calibrator,
+                           const HomographyEstimatorOptions& estimator_options = HomographyEstimatorOptions {} );
+
+        HomographySession( const HomographySession& ) = delete;
+        HomographySession& operator=( const HomographySession& ) = delete;
+
+        /**
+         * @brief 편집 결과.
+         */
+        enum class EditStatus
+        {
+            OK,                 /**< 반영됨 */
+            NOT_FOUND,          /**< 없는 포인트 ID */
+            CALIBRATION_FAILED  /**< 카메라 좌표 왜곡 보정 실패 (세션은 바뀌지 않음) */
+        };
+
+        /**
+         * @brief 포인트를 추가합니다. 카메라 좌표는 이 시점에 한 번만 왜곡 보정합니다.
+         * @param id [출력] 부여한 포인트 ID.
+         */
+        EditStatus AddPoint( const cv::Point2f& camera, const cv::Point2f& ground, uint64_t& id );
+
+        /**
+         * @brief 포인트를 이동합니다. (기존 쌍을 빼고 새 쌍을 더함)
+         * 이동한 포인트는 다음 RANSAC 전까지 활성 포인트로 취급합니다.
+         */
+        EditStatus UpdatePoint( uint64_t id, const cv::Point2f& camera, const cv::Point2f& ground );
+
+        /**
+         * @brief 포인트를 삭제합니다.
+         */
+        EditStatus RemovePoint( uint64_t id );
+
+        /**
+         * @brief 현재 활성 포인트 분포로 정규화를 다시 정하고 방정식을 새로 누적합니다.
+         * 초기 포인트를 한꺼번에 추가한 뒤 호출하면 정규화가 처음 4개 포인트에 치우치지 않습니다.
+         */
+        void Rebuild();
+
+        /**
+         * @brief 현재 정규 방정식의 해를 구합니다. (9x9 고유값 분해, 포인트 수와 무관한 비용 + O(n) 오차 계산)
+         */
+        Solution Solve();
+
+        /**
+         * @brief Solve와 같되, 같은 잠금 안에서 모든 포인트(ID 순서)도 함께 복사합니다.
+         * 해(revision, H)와 포인트 목록(인라이어 여부)이 항상 같은 상태를 가리킵니다.
+         * @param points_out [출력] 모든 포인트.
+         */
+        Solution Solve( std::vector<SurveyPoint>& points_out );
+
+        /**
+         * @brief 전체 포인트로 세션의 추정 방식(HomographyEstimator::Estimate) 재계산을 수행하고,
+         * 인라이어만으로 정규 방정식과 정규화를 다시 만듭니다.
+         * 포인트는 calculate_dynamic과 같은 정렬 순서(ResultCache::Canonicalize)로 넣으므로,
+         * 같은 포인트/옵션의 calculate_dynamic과 같은 H와 인라이어를 얻습니다.
+         * @param result    [출력] 추정 결과 (H, H^-1, 인라이어, 반복 횟수, 풀이 경로).
+         * @param error     [출력] 실패 시 에러 메시지.
+         */
+        bool Refit( ResultCache::Result& result, std::string& error );
+
+        /** 모든 포인트 (ID 순서) */
+        std::vector<SurveyPoint> Points() const;
+
+        // Getter
+        const std::string& getId() const noexcept { return id; }
+        const std::shared_ptr<const Calibrator>& getCalibrator() const noexcept { return calibrator; }
+        const HomographyEstimatorOptions& getEstimatorOptions() const noexcept { return estimator_options; }
+        std::chrono::steady_clock::time_point getLastUsed() const;
+
+    private:
+        // 활성 포인트로 정규화를 다시 정하고 방정식을 처음부터 누적 (lock 보유 상태에서 호출)
+        void RebuildLocked();
+
+        // 포인트 한 쌍을 방정식에 더하거나 뺌 (lock 보유 상태에서 호출)
+        void AccumulateLocked( const SurveyPoint& point, double weight );
+
+        // 빼기 후 처리: 누적 횟수가 많으면 재누적 (lock 보유 상태에서 호출)
+        void AfterDowndateLocked();
+
+        Solution SolveLocked( std::chrono::steady_clock::time_point started );
+
+        const std::string id;
+        const std::shared_ptr<const Calibrator> calibrator;
+        const HomographyEstimatorOptions estimator_options;
+
+        mutable std::mutex lock;
+        std::map<uint64_t, SurveyPoint> points;
+        PointNormalization src_norm; // 보정된 카메라 좌표 정규화
+        PointNormalization dst_norm; // 지상 좌표 정규화
+        DltSystem system;
+        size_t   downdates = 0;
+        uint64_t next_id   = 0;
+        uint64_t revision  = 0;
+        std::chrono::steady_clock::time_point last_used;
+    }; // cls::HomographySession
+
+    /**
+     * @brief 세션 ID -> 세션 저장소.
+     * 일정 시간 사용하지 않은 세션은 새 세션을 만들 때 정리합니다. 여러 스레드에서 동시에 호출할 수 있습니다.
+     */
+    class SessionStore
+    {
+    public:
+        /** 기본 한도 */
+        static constexpr size_t DEFAULT_MAX_SESSIONS = 64;
+        static constexpr std::chrono::minutes DEFAULT_IDLE_TTL { 30 };
+
+        explicit SessionStore( size_t max_sessions = DEFAULT_MAX_SESSIONS, std::chrono::minutes idle_ttl = DEFAULT_IDLE_TTL );
+
+        SessionStore( const SessionStore& ) = delete;
+        SessionStore& operator=( const SessionStore& ) = delete;
+
+        /**
+         * @brief 새 세션을 만듭니다. (무작위 16자리 16진수 ID)
+         * @return 세션. 만료된 세션을 정리한 뒤에도 한도가 가득 차 있으면 nullptr.
+         */
+        std::shared_ptr<HomographySession> Create( std::shared_ptr<const Calibrator> calibrator,
+                                                   const HomographyEstimatorOptions& estimator_options = HomographyEstimatorOptions {} );
+
+        /** 세션을 찾습니다. 없거나 만료되었으면 nullptr. */
+        std::shared_ptr<HomographySession> Find( const std::string& id );
+
+        /** 세션을 삭제합니다. */
+        bool Remove( const std::string& id );
+
+        // Getter
+        size_t size() const;
+
+    private:
+        // 만료된 세션 제거 (lock 보유 상태에서 호출)
+        void PurgeLocked( std::chrono::steady_clock::time_point now );
+
+        const size_t max_sessions;
+        const std::chrono::steady_clock::duration idle_ttl;
+
+        mutable std::mutex lock;
+        std::unordered_map<std::string, std::shared_ptr<HomographySession>> sessions;
+        std::mt19937_64 id_generator;
+    }; // cls::SessionStore
+
+} // nsp::MGEN::MVEM
+
+#endif // _MGEN_MVEM_HOMOGRAPHY_SESSION_H_
@@ -0,0 +1,216 @@
+#include "ImageUndistorter.h"
+#include "CalibratorKernels.h"
+#include "MgenLogger.h"
+#include "WorkerPool.h"
+
+// OpenCV
+#include <opencv2/imgproc.hpp> // cv::remap, cv::convertMaps
+
+// STL::C++
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    //--------------------------------------------------------------------------
+    // 함수: MapKey / SameParams (파일 내부)
+    // 설명: 파라미터 해시에 이미지 크기를 결합한 캐시 키와, 적중 시 충돌 확인.
+    //--------------------------------------------------------------------------
+    static uint64_t MapKey( const CalibratorParams& params, const cv::Size& size ) noexcept
+    {
+        uint64_t hash = HashCalibratorParams( params );
+        const uint64_t parts[] = { static_cast<uint64_t>( size.width ), static_cast<uint64_t>( size.height ) };
+        for( uint64_t v : parts ) {
+            hash ^= v + 0x9E3779B97F4A7C15ULL + ( hash << 6 ) + ( hash >> 2 );
+        }
+        return hash;
+    }
+
+    static bool SameParams( const CalibratorParams& a, const CalibratorParams& b ) noexcept
+    {
+        for( const CalibratorParamKey& key : CALIBRATOR_PARAM_KEYS ) {
+            if( a.*key.member != b.*key.member ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: FillMapRow (파일 내부)
+    // 설명: 보정 이미지의 한 행 v에 대해, 각 픽셀이 읽을 왜곡 이미지 좌표를 계산합니다.
+    //       (정규화 -> 왜곡 -> 역정규화. Calibrator가 푸는 모델의 정방향이므로 역변환이 정확히 일치)
+    //--------------------------------------------------------------------------
+    static void FillMapRow( const simd::KernelCoeffs& kc, const float* xs, float v, int cols, float* map_x, float* map_y )
+    {
+        int u = 0;
+
+        constexpr int LANES = static_cast<int>( simd::VecD::LANES );
+        const simd::VecD py = simd::VecD::Set1( v );
+        for( ; u + LANES <= cols; u += LANES )
+        {
+            simd::VecD nx, ny, dx, dy, px, qy;
+            simd::NormalizeLanes( kc, simd::VecD::LoadF( xs + u ), py, nx, ny );
+            simd::DistortLanes( kc, nx, ny, dx, dy );
+            simd::DeNormalizeLanes( kc, dx, dy, px, qy );
+            px.StoreF( map_x + u );
+            qy.StoreF( map_y + u );
+        }
+
+        const simd::ScalarD sy = simd::ScalarD::Set1( v );
+        for( ; u < cols; ++u )
+        {
+            simd::ScalarD nx, ny, dx, dy, px, qy;
+            simd::NormalizeLanes( kc, simd::ScalarD::LoadF( xs + u ), sy, nx, ny );
+            simd::DistortLanes( kc, nx, ny, dx, dy );
+            simd::DeNormalizeLanes( kc, dx, dy, px, qy );
+            px.StoreF( map_x + u );
+            qy.StoreF( map_y + u );
+        }
+    }
+
+    ImageUndistorter::ImageUndistorter( size_t capacity )
+        : cache( capacity )
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: BuildMaps
+    // 설명: 행 스트라이프 단위로 float 맵을 계산하고 곧바로 CV_16SC2 + CV_16UC1 맵으로 변환합니다.
+    //       float 맵은 스트라이프 크기만큼만 임시로 유지되므로 전체 크기의 float 맵을 만들지 않습니다.
+    //--------------------------------------------------------------------------
+    std::shared_ptr<const ImageUndistorter::RemapMaps> ImageUndistorter::BuildMaps( const CalibratorParams& params, const cv::Size& size,
+                                                                                    MGEN::WorkerPool* pool )
+    {
+        if( size.width <= 0 || size.height <= 0 ) {
+            return nullptr;
+        }
+        const auto started = std::chrono::steady_clock::now();
+
+        auto maps = std::make_shared<RemapMaps>();
+        maps->params = params;
+        maps->size   = size;
+        maps->map1.create( size, CV_16SC2 );
+        maps->map2.create( size, CV_16UC1 );
+
+        const simd::KernelCoeffs kc = simd::MakeCoeffs( params );
+
+        // 열 좌표는 모든 행에서 같으므로 한 번만 만듭니다
+        std::vector<float> xs( static_cast<size_t>( size.width ) );
+        for( int u = 0; u < size.width; ++u ) {
+            xs[ static_cast<size_t>( u ) ] = static_cast<float>( u );
+        }
+
+        const int cols = size.width;
+        MGEN::WorkerPool& workers = ( pool != nullptr ) ? *pool : MGEN::WorkerPool::Shared();
+        workers.ParallelFor( static_cast<size_t>( size.height ), REMAP_STRIPE_ROWS, [ & ]( size_t begin, size_t end ) {
+            const int r0 = static_cast<int>( begin );
+            const int r1 = static_cast<int>( end );
+
+            cv::Mat stripe_x( r1 - r0, cols, CV_32FC1 );
+            cv::Mat stripe_y( r1 - r0, cols, CV_32FC1 );
+            for( int v = r0; v < r1; ++v ) {
+                FillMapRow( kc, xs.data(), static_cast<float>( v ), cols, stripe_x.ptr<float>( v - r0 ), stripe_y.ptr<float>( v - r0 ) );
+            }
+
+            // 미리 할당된 전체 맵의 행 범위에 직접 기록
+            cv::Mat map1_rows = maps->map1.rowRange( r0, r1 );
+            cv::Mat map2_rows = maps->map2.rowRange( r0, r1 );
+            cv::convertMaps( stripe_x, stripe_y, map1_rows, map2_rows, CV_16SC2 );
+        } );
+
+        maps->build_ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - started ).count();
+        return maps;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: AcquireMaps
+    // 설명: 캐시를 조회하고, 미스면 생성 잠금 아래에서 다시 확인한 뒤 한 번만 생성합니다.
+    //--------------------------------------------------------------------------
+    std::shared_ptr<const ImageUndistorter::RemapMaps> ImageUndistorter::AcquireMaps( const CalibratorParams& params, const cv::Size& size, bool* cache_hit )
+    {
+        if( cache_hit != nullptr ) {
+            *cache_hit = false;
+        }
+        const uint64_t key = MapKey( params, size );
+
+        // 1. 빠른 경로: 캐시 적중
+        if( auto hit = cache.get( key ) ) {
+            const auto& maps = *hit;
+            if( maps->size == size && SameParams( maps->params, params ) ) {
+                if( cache_hit != nullptr ) {
+                    *cache_hit = true;
+                }
+                return maps;
+            }
+            MLOG_WARN("ImageUndistorter: hash collision on key %016llx. Building uncached maps.", static_cast<unsigned long long>( key ));
+            return BuildMaps( params, size );
+        }
+
+        // 2. 미스: 동시에 같은 맵을 요청한 스레드가 먼저 만들었을 수 있으므로 잠금 후 재확인
+        std::lock_guard<std::mutex> guard( build_lock );
+        if( auto hit = cache.get( key ) ) {
+            const auto& maps = *hit;
+            if( maps->size == size && SameParams( maps->params, params ) ) {
+                if( cache_hit != nullptr ) {
+                    *cache_hit = true;
+                }
+                return maps;
+            }
+        }
+
+        auto built = BuildMaps( params, size );
+        if( built == nullptr ) {
+            return nullptr;
+        }
+        cache.put( key, built );
+        MLOG_INFO("ImageUndistorter: remap maps cached (%dx%d, key %016llx, %.1f ms).",
+                  size.width, size.height, static_cast<unsigned long long>( key ), built->build_ms);
+        return built;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Undistort
+    // 설명: 캐시된 고정소수점 맵으로 출력 이미지를 행 스트라이프 단위로 나누어 병렬 remap 합니다.
+    //       각 스트라이프는 출력의 서로 다른 행에만 기록하므로 결과는 스레드 수와 무관합니다.
+    //--------------------------------------------------------------------------
+    bool ImageUndistorter::Undistort( const Calibrator& calibrator, const cv::Mat& src, cv::Mat& dst,
+                                      MGEN::WorkerPool* pool, bool* cache_hit )
+    {
+        if( cache_hit != nullptr ) {
+            *cache_hit = false;
+        }
+        if( calibrator.isValid() == false || src.empty() ) {
+            return false;
+        }
+
+        // 왜곡이 없는 카메라: 맵 없이 복사
+        if( calibrator.isIdentity() ) {
+            src.copyTo( dst );
+            return true;
+        }
+
+        const auto maps = AcquireMaps( calibrator.getParams(), src.size(), cache_hit );
+        if( maps == nullptr ) {
+            return false;
+        }
+
+        // src와 dst가 같은 버퍼면 remap이 읽는 도중 덮어쓰게 되므로 새로 할당
+        if( dst.data == src.data ) {
+            dst.release();
+        }
+        dst.create( src.size(), src.type() );
+
+        MGEN::WorkerPool& workers = ( pool != nullptr ) ? *pool : MGEN::WorkerPool::Shared();
+        workers.ParallelFor( static_cast<size_t>( src.rows ), REMAP_STRIPE_ROWS, [ & ]( size_t begin, size_t end ) {
+            const int r0 = static_cast<int>( begin );
+            const int r1 = static_cast<int>( end );
+            cv::Mat dst_rows = dst.rowRange( r0, r1 );
+            cv::remap( src, dst_rows, maps->map1.rowRange( r0, r1 ), maps->map2.rowRange( r0, r1 ),
+                       cv::INTER_LINEAR, cv::BORDER_CONSTANT );
+        } );
+        return true;
+    }
+
+} // nsp::MGEN::MVEM
@@ -0,0 +1,101 @@
+#ifndef _MGEN_MVEM_IMAGE_UNDISTORTER_H_
+#define _MGEN_MVEM_IMAGE_UNDISTORTER_H_
+
+/* ====================================
+ * Image Undistorter Class Header
+ * ------------------------------------
+ * Desc   : 카메라 파라미터로 만든 remap 맵(고정소수점 CV_16SC2)을 카메라별로 캐시하고,
+ * 이미지 전체를 워커 풀에서 행 단위로 나누어 병렬 remap 합니다.
+ * 같은 카메라의 프레임이 반복되면 맵 생성 비용 없이 remap 비용만 듭니다.
+ * ==================================== */
+
+#include "Calibrator.h"
+#include "LruCache.h"
+
+// OpenCV
+#include <opencv2/core.hpp> // cv::Mat
+
+// STL
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace MGEN { class WorkerPool; }
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    /**
+     * @brief 카메라별 remap 맵 캐시와 병렬 이미지 왜곡 보정기.
+     * 모든 public 함수는 여러 스레드에서 동시에 호출할 수 있습니다.
+     */
+    class ImageUndistorter
+    {
+    public:
+        /**
+         * @brief 한 카메라/이미지 크기에 대한 remap 맵 (생성 후 불변).
+         * 출력(보정) 이미지의 픽셀 (u, v)가 입력(왜곡) 이미지의 어느 위치를 읽을지 나타냅니다.
+         */
+        struct RemapMaps
+        {
+            CalibratorParams params;   /**< 맵을 만든 파라미터 (캐시 충돌 확인용) */
+            cv::Size         size;     /**< 이미지 크기 */
+            cv::Mat          map1;     /**< CV_16SC2: 정수 좌표 (x, y) */
+            cv::Mat          map2;     /**< CV_16UC1: 보간 테이블 인덱스 */
+            double           build_ms = 0.0; /**< 맵 생성에 걸린 시간 (밀리초) */
+        };
+
+        using Stats = LruCache<uint64_t, std::shared_ptr<const RemapMaps>>::Stats;
+
+        /** 행 단위 병렬 remap의 한 작업 단위 (행 수) */
+        static constexpr size_t REMAP_STRIPE_ROWS = 32;
+
+        /**
+         * @brief 생성자.
+         * @param capacity 캐시할 맵의 최대 개수 (카메라 x 이미지 크기). 1920x1080 기준 맵 하나는 약 12MB.
+         */
+        explicit ImageUndistorter( size_t capacity = 16 );
+
+        ImageUndistorter( const ImageUndistorter& ) = delete;
+        ImageUndistorter& operator=( const ImageUndistorter& ) = delete;
+
+        /**
+         * @brief 파라미터와 이미지 크기에 해당하는 remap 맵을 캐시에서 찾거나 새로 만듭니다.
+         * 같은 키를 동시에 요청해도 맵은 한 번만 만들어집니다.
+         * @param params 유효한 카메라 파라미터.
+         * @param size   이미지 크기.
+         * @param cache_hit (선택) 캐시 적중 여부를 받을 포인터.
+         * @return remap 맵. 크기가 잘못되면 nullptr.
+         */
+        std::shared_ptr<const RemapMaps> AcquireMaps( const CalibratorParams& params, const cv::Size& size, bool* cache_hit = nullptr );
+
+        /**
+         * @brief 이미지 전체를 왜곡 보정합니다. (선형 보간, 범위 밖은 검정)
+         * 맵은 캐시에서 가져오며, remap은 워커 풀에서 REMAP_STRIPE_ROWS 행 단위로 병렬 실행합니다.
+         * @param calibrator 유효한 Calibrator.
+         * @param src 왜곡된 입력 이미지.
+         * @param dst 보정된 출력 이미지 (src와 같은 크기/타입으로 생성됨).
+         * @param pool 사용할 워커 풀. nullptr이면 공용 풀.
+         * @param cache_hit (선택) 맵 캐시 적중 여부를 받을 포인터.
+         * @return 성공 여부.
+         */
+        bool Undistort( const Calibrator& calibrator, const cv::Mat& src, cv::Mat& dst,
+                        MGEN::WorkerPool* pool = nullptr, bool* cache_hit = nullptr );
+
+        /**
+         * @brief remap 맵을 새로 만듭니다. (캐시 미사용)
+         * Calibrator와 같은 왜곡 모델(skew 포함)을 SIMD 커널로 계산한 뒤 CV_16SC2 고정소수점 맵으로 변환합니다.
+         */
+        static std::shared_ptr<const RemapMaps> BuildMaps( const CalibratorParams& params, const cv::Size& size,
+                                                           MGEN::WorkerPool* pool = nullptr );
+
+        // Getter
+        Stats getStats() const { return cache.stats(); }
+
+    private:
+        LruCache<uint64_t, std::shared_ptr<const RemapMaps>> cache;
+        std::mutex build_lock; // 맵 생성 직렬화 (같은 맵을 동시에 두 번 만들지 않도록)
+    }; // cls::ImageUndistorter
+
+} // nsp::MGEN::MVEM
+
+#endif // _MGEN_MVEM_IMAGE_UNDISTORTER_H_
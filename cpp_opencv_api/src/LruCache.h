@@ -0,0 +1,128 @@
+#ifndef __MGEN_LRU_CACHE_H__
+#define __MGEN_LRU_CACHE_H__
+
+/** -------------------------------------------------------
+ *  MgenSolution's Thread-safe LRU Cache
+ * --------------------------------------------------------
+ *  Desc : 용량 제한이 있는 LRU(Least Recently Used) 캐시.
+ *         모든 연산은 내부 mutex로 보호되며, 임계 구역은
+ *         리스트/해시맵 갱신만 포함하도록 짧게 유지합니다.
+ *         값은 보통 std::shared_ptr<const T> 처럼 복사 비용이
+ *         작은 핸들을 저장합니다.
+ * -------------------------------------------------------- */
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace MGEN { // Mgensolution's default namespace
+
+    template <typename Key, typename Value, typename Hash = std::hash<Key>>
+    class LruCache
+    {
+    public:
+        // Cache statistics snapshot
+        struct Stats
+        {
+            uint64_t hits      = 0;
+            uint64_t misses    = 0;
+            uint64_t evictions = 0;
+            size_t   size      = 0;
+            size_t   capacity  = 0;
+
+            double hitRatio( void ) const { return ( hits + misses ) > 0 ? static_cast<double>( hits ) / static_cast<double>( hits + misses ) : 0.0; }
+        };
+
+        // Constructor (capacity 0 is treated as 1)
+        explicit LruCache( size_t capacity ) : max_size( capacity > 0 ? capacity : 1 ) {}
+
+        LruCache( const LruCache& ) = delete;
+        LruCache& operator=( const LruCache& ) = delete;
+
+        // Lookup; a hit moves the entry to the front (most recently used)
+        std::optional<Value> get( const Key& key )
+        {
+            std::lock_guard<std::mutex> guard( lock );
+            auto it = index.find( key );
+            if( it == index.end() ) {
+                misses.fetch_add( 1, std::memory_order_relaxed );
+                return std::nullopt;
+            }
+            order.splice( order.begin(), order, it->second );
+            hits.fetch_add( 1, std::memory_order_relaxed );
+            return it->second->second;
+        }
+
+        // Insert or replace; evicts the least recently used entry when full
+        void put( const Key& key, Value value )
+        {
+            std::lock_guard<std::mutex> guard( lock );
+            auto it = index.find( key );
+            if( it != index.end() ) {
+                it->second->second = std::move( value );
+                order.splice( order.begin(), order, it->second );
+                return;
+            }
+            order.emplace_front( key, std::move( value ) );
+            index.emplace( key, order.begin() );
+            while( order.size() > max_size ) {
+                index.erase( order.back().first );
+                order.pop_back();
+                evictions.fetch_add( 1, std::memory_order_relaxed );
+            }
+        }
+
+        // Remove a single entry
+        bool erase( const Key& key )
+        {
+            std::lock_guard<std::mutex> guard( lock );
+            auto it = index.find( key );
+            if( it == index.end() ) {
+                return false;
+            }
+            order.erase( it->second );
+            index.erase( it );
+            return true;
+        }
+
+        // Remove every entry (counters are kept)
+        void clear( void )
+        {
+            std::lock_guard<std::mutex> guard( lock );
+            order.clear();
+            index.clear();
+        }
+
+        // Getter
+        Stats stats( void ) const
+        {
+            std::lock_guard<std::mutex> guard( lock );
+            Stats s;
+            s.hits      = hits.load( std::memory_order_relaxed );
+            s.misses    = misses.load( std::memory_order_relaxed );
+            s.evictions = evictions.load( std::memory_order_relaxed );
+            s.size      = order.size();
+            s.capacity  = max_size;
+            return s;
+        }
+
+    private:
+        using Entry = std::pair<Key, Value>;
+
+        const size_t max_size;
+        std::list<Entry> order; // front = most recently used
+        std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> index;
+        mutable std::mutex lock;
+
+        std::atomic<uint64_t> hits      { 0 };
+        std::atomic<uint64_t> misses    { 0 };
+        std::atomic<uint64_t> evictions { 0 };
+    }; // cls:LruCache
+
+}; // namespace MGEN
+#endif
@@ -0,0 +1,572 @@
+#include "ModelRegistry.h"
+#include "UndistortGrid.h"
+#include "MgenLogger.h"
+
+// POSIX (mmap)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// STL::C++
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <utility>
+
+#include <experimental/filesystem>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    // use filesystem library
+    namespace fs = std::experimental::filesystem;
+
+    // 스냅샷 파일 헤더 (리틀 엔디안, 고정 크기). 헤더 뒤에 모델 레코드가 model_count개 이어집니다.
+    struct RegistryFileHeader
+    {
+        char     magic[8];      // "MVEMREG\0"
+        uint32_t version;       // ModelRegistry::SNAPSHOT_VERSION
+        uint32_t header_size;   // sizeof(RegistryFileHeader)
+        uint64_t model_count;
+        uint64_t next_version;  // 복원 후 이어서 부여할 버전의 기준
+        uint64_t payload_bytes; // 레코드 전체 크기 (바이트)
+        uint64_t checksum;      // 레코드 전체의 FNV-1a 해시
+    };
+
+    // 모델 레코드 헤더. 뒤에 id 문자열과 float (x, y) 인라이어 배열 2개가 이어집니다.
+    // 격자 캐시 디렉토리는 서버 설정(Calibrator::GridCacheDir)이므로 저장하지 않습니다.
+    struct ModelRecordHeader
+    {
+        uint64_t version;
+        double   params[ std::size( CALIBRATOR_PARAM_KEYS ) ]; // CALIBRATOR_PARAM_KEYS 순서
+        double   homography[9];
+        double   inverse_homography[9];
+        double   inverse_tolerance_px;
+        int32_t  solver;
+        int32_t  max_iterations;
+        int32_t  image_width;
+        int32_t  image_height;
+        int32_t  inverse_enable;
+        int32_t  grid_enable;
+        int32_t  grid_cell;
+        uint32_t id_length;
+        uint64_t survey_points;
+        uint64_t inlier_count;
+    };
+
+    constexpr char REGISTRY_FILE_MAGIC[8] = { 'M', 'V', 'E', 'M', 'R', 'E', 'G', '\0' };
+
+    //--------------------------------------------------------------------------
+    // 함수: Fnv1a (파일 내부)
+    // 설명: 스냅샷 레코드의 손상 확인용 64bit 해시.
+    //--------------------------------------------------------------------------
+    static uint64_t Fnv1a( const char* data, size_t size ) noexcept
+    {
+        uint64_t hash = 14695981039346656037ULL; // FNV offset basis
+        for( size_t i = 0; i < size; ++i ) {
+            hash ^= static_cast<uint8_t>( data[ i ] );
+            hash *= 1099511628211ULL; // FNV prime
+        }
+        return hash;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: AppendPoints / ReadBytes (파일 내부)
+    // 설명: 레코드 직렬화 보조. ReadBytes는 남은 길이를 넘으면 false를 반환합니다.
+    //--------------------------------------------------------------------------
+    static void AppendPoints( std::string& out, const std::vector<cv::Point2f>& points )
+    {
+        for( const cv::Point2f& pt : points ) {
+            const float xy[2] = { pt.x, pt.y };
+            out.append( reinterpret_cast<const char*>( xy ), sizeof( xy ) );
+        }
+    }
+
+    static bool ReadBytes( const char*& cursor, const char* end, void* dst, size_t bytes ) noexcept
+    {
+        if( static_cast<size_t>( end - cursor ) < bytes ) {
+            return false;
+        }
+        std::memcpy( dst, cursor, bytes );
+        cursor += bytes;
+        return true;
+    }
+
+    static bool ReadPoints( const char*& cursor, const char* end, size_t count, std::vector<cv::Point2f>& points )
+    {
+        if( static_cast<size_t>( end - cursor ) / ( 2 * sizeof( float ) ) < count ) {
+            return false;
+        }
+        points.resize( count );
+        for( cv::Point2f& pt : points ) {
+            float xy[2];
+            ReadBytes( cursor, end, xy, sizeof( xy ) );
+            pt = cv::Point2f( xy[0], xy[1] );
+        }
+        return true;
+    }
+    //--------------------------------------------------------------------------
+    // 함수: ValidRecordOptions (파일 내부)
+    // 설명: 레코드의 옵션 값이 Calibrator::ParseOptions가 허용하는 범위인지 확인합니다.
+    //       체크섬은 손상만 잡으므로, 다른 빌드가 쓴 파일의 잘못된 열거값/범위는 여기서 거릅니다.
+    //--------------------------------------------------------------------------
+    static bool ValidRecordOptions( const ModelRecordHeader& rec ) noexcept
+    {
+        const bool known_solver = rec.solver == static_cast<int32_t>( UndistortSolver::FixedPoint )
+                               || rec.solver == static_cast<int32_t>( UndistortSolver::Newton );
+        return known_solver
+            && rec.max_iterations >= 1
+            && rec.image_width >= 0 && rec.image_height >= 0
+            && ( rec.inverse_enable == 0 || rec.inverse_enable == 1 )
+            && std::isfinite( rec.inverse_tolerance_px ) && rec.inverse_tolerance_px > 0.0
+            && ( rec.grid_enable == 0 || rec.grid_enable == 1 )
+            && rec.grid_cell >= 1 && rec.grid_cell <= UndistortGrid::MAX_CELL;
+    }
+
+    ModelRegistry::ModelRegistry()
+        : current( new Table() )
+    {
+    }
+
+    ModelRegistry::~ModelRegistry()
+    {
+        // 남은 스냅샷 저장을 마친 뒤 저장 스레드 종료
+        {
+            std::lock_guard<std::mutex> guard( flush_lock );
+            flush_stop = true;
+        }
+        flush_cv.notify_one();
+        if( flush_thread.joinable() ) {
+            flush_thread.join();
+        }
+        // 소멸 시점에는 읽기 구간이 남아 있지 않아야 합니다 (소유자가 서버보다 오래 삶)
+        delete current.load();
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: IsValidId
+    // 설명: URL 경로와 파일 이름에 그대로 쓸 수 있는 문자만 허용합니다.
+    //--------------------------------------------------------------------------
+    bool ModelRegistry::IsValidId( const std::string& id ) noexcept
+    {
+        if( id.empty() || id.size() > MAX_ID_LENGTH ) {
+            return false;
+        }
+        for( const char c : id ) {
+            const bool alnum = ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' ) || ( c >= '0' && c <= '9' );
+            if( alnum == false && c != '_' && c != '-' && c != '.' ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ReadSection
+    // 설명: 위상 카운터를 올린 뒤에 테이블 포인터를 읽습니다. 순서가 바뀌면 쓰는 쪽이
+    //       이 읽기를 보지 못하고 테이블을 해제할 수 있으므로 모두 seq_cst로 둡니다.
+    //--------------------------------------------------------------------------
+    ModelRegistry::ReadSection::ReadSection( const ModelRegistry& registry ) noexcept
+        : owner( registry )
+        , phase( registry.reader_phase.load() )
+    {
+        owner.readers[ phase ].active.fetch_add( 1 );
+    }
+
+    ModelRegistry::ReadSection::~ReadSection()
+    {
+        owner.readers[ phase ].active.fetch_sub( 1 );
+    }
+
+    const ModelRegistry::Table& ModelRegistry::ReadSection::Load() const noexcept
+    {
+        return *owner.current.load();
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: WaitForReaders
+    // 설명: 위상을 두 번 뒤집으며 각각 이전 위상의 읽기 구간이 0이 될 때까지 기다립니다.
+    //       위상을 읽은 직후 멈췄다가 뒤늦게 카운터를 올린 읽기 구간도 두 번째 대기에서 잡힙니다.
+    //       새 읽기 구간은 항상 새 위상으로 들어가므로 트래픽이 계속되어도 대기는 끝납니다.
+    //--------------------------------------------------------------------------
+    void ModelRegistry::WaitForReaders()
+    {
+        for( int pass = 0; pass < 2; ++pass )
+        {
+            const unsigned drained = reader_phase.load();
+            reader_phase.store( drained ^ 1u );
+            while( readers[ drained ].active.load() != 0 ) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Replace
+    // 설명: 새 테이블을 게시하고 유예 기간이 끝난 뒤 이전 테이블을 해제합니다.
+    //       이전 테이블이 가리키던 모델은 shared_ptr이므로, 이미 모델을 얻은 요청은 영향이 없습니다.
+    //--------------------------------------------------------------------------
+    void ModelRegistry::Replace( const Table* next )
+    {
+        const auto started = std::chrono::steady_clock::now();
+        const Table* previous = current.exchange( next );
+        WaitForReaders();
+        delete previous;
+
+        reclaimed_tables.fetch_add( 1, std::memory_order_relaxed );
+        last_grace_us.store( std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now() - started ).count(),
+                             std::memory_order_relaxed );
+    }
+
+    std::shared_ptr<const HomographyModel> ModelRegistry::Find( const std::string& id ) const
+    {
+        ReadSection section( *this );
+        const Table& table = section.Load();
+        const auto it = table.find( id );
+        return ( it != table.end() ) ? it->second : nullptr;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Publish / Remove
+    // 설명: 현재 테이블을 복사해 수정한 뒤 원자적으로 교체합니다. (쓰기끼리만 mutex로 직렬화)
+    //       스냅샷 파일 저장은 저장 스레드에 맡기므로 요청 경로에서 디스크 I/O를 하지 않습니다.
+    //--------------------------------------------------------------------------
+    uint64_t ModelRegistry::Publish( std::shared_ptr<HomographyModel> model )
+    {
+        if( model == nullptr ) {
+            return 0;
+        }
+        std::lock_guard<std::mutex> guard( write_lock );
+        model->version = ++next_version;
+
+        // 쓰기는 write_lock으로 직렬화되어 있으므로 현재 테이블을 읽기 구간 없이 읽어도 해제되지 않습니다
+        auto* next = new Table( *current.load() );
+        const std::string id = model->id;
+        const uint64_t version = model->version;
+        const bool replaced = ( next->erase( id ) > 0 );
+        next->emplace( id, std::move( model ) );
+        Replace( next );
+        published_version.store( version, std::memory_order_relaxed );
+        ScheduleSnapshot();
+
+        MLOG_INFO("ModelRegistry: model '%s' %s (version %llu).", id.c_str(), replaced ? "replaced" : "registered",
+                  static_cast<unsigned long long>( version ));
+        return version;
+    }
+
+    bool ModelRegistry::Remove( const std::string& id )
+    {
+        std::lock_guard<std::mutex> guard( write_lock );
+        const Table* table = current.load();
+        if( table->count( id ) == 0 ) {
+            return false;
+        }
+        auto* next = new Table( *table );
+        next->erase( id );
+        Replace( next );
+        ScheduleSnapshot();
+        MLOG_INFO("ModelRegistry: model '%s' removed.", id.c_str());
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: EnableSnapshot
+    // 설명: 스냅샷을 복원해 한 번에 게시하고, 이후 변경을 같은 파일에 저장하도록 저장 스레드를 시작합니다.
+    //       복원된 모델의 버전은 유지되며, 새 버전은 그보다 큰 값부터 부여합니다.
+    //--------------------------------------------------------------------------
+    size_t ModelRegistry::EnableSnapshot( const std::string& path )
+    {
+        std::lock_guard<std::mutex> guard( write_lock );
+        {
+            std::lock_guard<std::mutex> flush_guard( flush_lock );
+            snapshot_path = path;
+        }
+        if( flush_thread.joinable() == false ) {
+            flush_thread = std::thread( &ModelRegistry::FlushLoop, this );
+        }
+
+        const auto started = std::chrono::steady_clock::now();
+        uint64_t max_version = 0;
+        std::unique_ptr<Table> restored = ReadSnapshot( path, max_version );
+        if( restored == nullptr ) {
+            return 0;
+        }
+
+        // 이미 등록된 모델(있다면)이 우선
+        for( const auto& entry : *current.load() ) {
+            ( *restored )[ entry.first ] = entry.second;
+            max_version = std::max( max_version, entry.second->version );
+        }
+        const size_t count = restored->size();
+        next_version = std::max( next_version, max_version );
+        published_version.store( next_version, std::memory_order_relaxed );
+        Replace( restored.release() );
+
+        const double elapsed_ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - started ).count();
+        restored_models.store( count, std::memory_order_relaxed );
+        restore_ms.store( elapsed_ms, std::memory_order_relaxed );
+        MLOG_INFO("ModelRegistry: restored %zu model(s) from '%s' in %.2f ms.", count, path.c_str(), elapsed_ms);
+        return count;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ScheduleSnapshot / FlushLoop
+    // 설명: 변경이 있으면 저장 요청만 표시하고 저장 스레드를 깨웁니다.
+    //       저장 중에 들어온 변경은 하나로 합쳐져 다음 저장에 반영되며, 종료 시 남은 요청을 저장한 뒤 끝납니다.
+    //--------------------------------------------------------------------------
+    void ModelRegistry::ScheduleSnapshot()
+    {
+        {
+            std::lock_guard<std::mutex> guard( flush_lock );
+            if( snapshot_path.empty() ) {
+                return;
+            }
+            flush_pending = true;
+        }
+        flush_cv.notify_one();
+    }
+
+    void ModelRegistry::FlushLoop()
+    {
+        std::unique_lock<std::mutex> guard( flush_lock );
+        for( ;; )
+        {
+            flush_cv.wait( guard, [ this ] { return flush_pending || flush_stop; } );
+            if( flush_pending == false ) {
+                break; // 종료 요청이고 남은 저장 없음
+            }
+            flush_pending = false;
+            const std::string path = snapshot_path;
+            guard.unlock();
+            WriteSnapshot( path );
+            guard.lock();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: WriteSnapshot
+    // 설명: 게시된 테이블의 모델 포인터를 읽기 구간 안에서 복사한 뒤(잠금 없음), 구간 밖에서 직렬화하여
+    //       임시 파일에 쓰고 rename으로 교체합니다. 모델은 불변이므로 파일에는 항상 게시된 테이블 하나가 온전히 담깁니다.
+    //       저장 스레드에서만 호출되므로 저장끼리는 겹치지 않습니다.
+    //--------------------------------------------------------------------------
+    void ModelRegistry::WriteSnapshot( const std::string& path )
+    {
+        std::vector<std::shared_ptr<const HomographyModel>> models = List();
+        const uint64_t last_version = published_version.load( std::memory_order_relaxed );
+
+        std::string payload;
+        for( const auto& entry : models )
+        {
+            const HomographyModel& model = *entry;
+            const CalibratorParams&  params  = model.calibrator->getParams();
+            const CalibratorOptions& options = model.calibrator->getOptions();
+
+            ModelRecordHeader rec {};
+            rec.version = model.version;
+            for( size_t k = 0; k < std::size( CALIBRATOR_PARAM_KEYS ); ++k ) {
+                rec.params[ k ] = params.*CALIBRATOR_PARAM_KEYS[ k ].member;
+            }
+            for( int i = 0; i < 9; ++i ) {
+                rec.homography[ i ]         = model.homography.val[ i ];
+                rec.inverse_homography[ i ] = model.inverse_homography.val[ i ];
+            }
+            rec.inverse_tolerance_px = options.inverse_model.tolerance_px;
+            rec.solver               = static_cast<int32_t>( options.solver );
+            rec.max_iterations       = options.max_iterations;
+            rec.image_width          = options.image_width;
+            rec.image_height         = options.image_height;
+            rec.inverse_enable       = options.inverse_model.enable ? 1 : 0;
+            rec.grid_enable          = options.grid.enable ? 1 : 0;
+            rec.grid_cell            = options.grid.cell;
+            rec.id_length            = static_cast<uint32_t>( model.id.size() );
+            rec.survey_points        = model.survey_points;
+            rec.inlier_count         = model.inlier_image_points.size();
+
+            payload.append( reinterpret_cast<const char*>( &rec ), sizeof( rec ) );
+            payload.append( model.id );
+            AppendPoints( payload, model.inlier_image_points );
+            AppendPoints( payload, model.inlier_ground_points );
+        }
+
+        RegistryFileHeader hdr {};
+        std::memcpy( hdr.magic, REGISTRY_FILE_MAGIC, sizeof( REGISTRY_FILE_MAGIC ) );
+        hdr.version       = SNAPSHOT_VERSION;
+        hdr.header_size   = sizeof( RegistryFileHeader );
+        hdr.model_count   = models.size();
+        hdr.next_version  = last_version;
+        hdr.payload_bytes = payload.size();
+        hdr.checksum      = Fnv1a( payload.data(), payload.size() );
+
+        bool ok = true;
+        try {
+            const fs::path parent = fs::path( path ).parent_path();
+            if( !parent.empty() && !fs::exists( parent ) ) {
+                fs::create_directories( parent );
+            }
+        } catch( const std::exception& e ) {
+            MLOG_WARN("ModelRegistry: cannot create directory for '%s': %s", path.c_str(), e.what());
+            ok = false;
+        }
+
+        const std::string tmp_path = path + ".tmp." + std::to_string( ::getpid() );
+        if( ok ) {
+            std::ofstream ofs( tmp_path, std::ios::binary | std::ios::trunc );
+            ofs.write( reinterpret_cast<const char*>( &hdr ), sizeof( hdr ) );
+            ofs.write( payload.data(), static_cast<std::streamsize>( payload.size() ) );
+            ok = static_cast<bool>( ofs );
+        }
+        if( ok && ::rename( tmp_path.c_str(), path.c_str() ) != 0 ) {
+            ok = false;
+        }
+        if( ok == false ) {
+            ::unlink( tmp_path.c_str() );
+            snapshot_errors.fetch_add( 1, std::memory_order_relaxed );
+            MLOG_WARN("ModelRegistry: failed to write snapshot '%s'.", path.c_str());
+            return;
+        }
+        snapshot_writes.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: ReadSnapshot
+    // 설명: 파일을 읽기 전용으로 mmap하고 헤더/체크섬을 검증한 뒤 레코드마다 모델을 만듭니다.
+    //       Calibrator는 저장된 파라미터/옵션으로 생성하며, 격자가 켜져 있으면 격자 파일을 mmap으로 읽습니다.
+    //       하나라도 잘못된 레코드가 있으면 파일 전체를 무시합니다.
+    //--------------------------------------------------------------------------
+    std::unique_ptr<ModelRegistry::Table> ModelRegistry::ReadSnapshot( const std::string& path, uint64_t& max_version )
+    {
+        const int fd = ::open( path.c_str(), O_RDONLY );
+        if( fd < 0 ) {
+            MLOG_INFO("ModelRegistry: no snapshot at '%s'. Starting empty.", path.c_str());
+            return nullptr;
+        }
+        struct stat st {};
+        if( ::fstat( fd, &st ) != 0 || static_cast<size_t>( st.st_size ) < sizeof( RegistryFileHeader ) ) {
+            MLOG_WARN("ModelRegistry: snapshot '%s' is too small or unreadable. Ignoring.", path.c_str());
+            ::close( fd );
+            return nullptr;
+        }
+        const size_t size = static_cast<size_t>( st.st_size );
+        void* base = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        ::close( fd ); // 매핑은 fd를 닫아도 유지됨
+        if( base == MAP_FAILED ) {
+            MLOG_WARN("ModelRegistry: mmap failed for '%s'.", path.c_str());
+            return nullptr;
+        }
+        // 모델은 매핑된 영역을 복사해 만들므로 함수가 끝나면 매핑을 해제합니다
+        std::unique_ptr<void, std::function<void( void* )>> mapping( base, [ size ]( void* p ) { ::munmap( p, size ); } );
+
+        const char* const data = static_cast<const char*>( base );
+        RegistryFileHeader hdr {};
+        std::memcpy( &hdr, data, sizeof( hdr ) );
+        const char* cursor = data + sizeof( RegistryFileHeader );
+        const char* const end = data + size;
+        if( std::memcmp( hdr.magic, REGISTRY_FILE_MAGIC, sizeof( REGISTRY_FILE_MAGIC ) ) != 0
+            || hdr.version != SNAPSHOT_VERSION || hdr.header_size != sizeof( RegistryFileHeader )
+            || hdr.payload_bytes != size - sizeof( RegistryFileHeader )
+            || hdr.checksum != Fnv1a( cursor, static_cast<size_t>( hdr.payload_bytes ) ) ) {
+            MLOG_WARN("ModelRegistry: snapshot '%s' is corrupt or from another version. Ignoring.", path.c_str());
+            return nullptr;
+        }
+
+        auto table = std::make_unique<Table>();
+        max_version = hdr.next_version;
+        for( uint64_t m = 0; m < hdr.model_count; ++m )
+        {
+            ModelRecordHeader rec {};
+            auto model = std::make_shared<HomographyModel>();
+            bool ok = ReadBytes( cursor, end, &rec, sizeof( rec ) )
+                   && rec.id_length <= MAX_ID_LENGTH
+                   && static_cast<size_t>( end - cursor ) >= static_cast<size_t>( rec.id_length );
+            if( ok ) {
+                model->id.assign( cursor, rec.id_length );
+                cursor += rec.id_length;
+                ok = IsValidId( model->id )
+                  && ReadPoints( cursor, end, static_cast<size_t>( rec.inlier_count ), model->inlier_image_points )
+                  && ReadPoints( cursor, end, static_cast<size_t>( rec.inlier_count ), model->inlier_ground_points );
+            }
+            if( ok == false ) {
+                MLOG_WARN("ModelRegistry: snapshot '%s' has a truncated record %llu. Ignoring.", path.c_str(), static_cast<unsigned long long>( m ));
+                return nullptr;
+            }
+
+            if( ValidRecordOptions( rec ) == false ) {
+                MLOG_WARN("ModelRegistry: snapshot '%s' has out-of-range options for model '%s'. Ignoring.", path.c_str(), model->id.c_str());
+                return nullptr;
+            }
+
+            CalibratorParams params;
+            for( size_t k = 0; k < std::size( CALIBRATOR_PARAM_KEYS ); ++k ) {
+                params.*CALIBRATOR_PARAM_KEYS[ k ].member = rec.params[ k ];
+            }
+            CalibratorOptions options;
+            options.solver                     = static_cast<UndistortSolver>( rec.solver );
+            options.max_iterations             = rec.max_iterations;
+            options.image_width                = rec.image_width;
+            options.image_height               = rec.image_height;
+            options.inverse_model.enable       = ( rec.inverse_enable != 0 );
+            options.inverse_model.tolerance_px = rec.inverse_tolerance_px;
+            options.grid.enable                = ( rec.grid_enable != 0 );
+            options.grid.cell                  = rec.grid_cell;
+            options.grid.cache_dir             = Calibrator::GridCacheDir(); // 격자 파일 위치는 현재 서버 설정을 따름
+
+            auto calibrator = std::make_shared<const Calibrator>( params, options );
+            if( calibrator->isValid() == false ) {
+                MLOG_WARN("ModelRegistry: snapshot '%s' has invalid parameters for model '%s'. Ignoring.", path.c_str(), model->id.c_str());
+                return nullptr;
+            }
+            model->calibrator         = std::move( calibrator );
+            model->homography         = cv::Matx33d( rec.homography );
+            model->inverse_homography = cv::Matx33d( rec.inverse_homography );
+            model->survey_points      = static_cast<size_t>( rec.survey_points );
+            model->version            = rec.version;
+            max_version = std::max( max_version, rec.version );
+
+            const std::string id = model->id;
+            ( *table )[ id ] = std::move( model );
+        }
+        if( cursor != end ) {
+            MLOG_WARN("ModelRegistry: snapshot '%s' has trailing bytes. Ignoring.", path.c_str());
+            return nullptr;
+        }
+        return table;
+    }
+
+    std::vector<std::shared_ptr<const HomographyModel>> ModelRegistry::List() const
+    {
+        ReadSection section( *this );
+        const Table& table = section.Load();
+        std::vector<std::shared_ptr<const HomographyModel>> models;
+        models.reserve( table.size() );
+        for( const auto& entry : table ) {
+            models.push_back( entry.second );
+        }
+        return models;
+    }
+
+    size_t ModelRegistry::size() const
+    {
+        ReadSection section( *this );
+        return section.Load().size();
+    }
+
+    ModelRegistry::Stats ModelRegistry::getStats() const
+    {
+        Stats stats;
+        stats.models           = size();
+        stats.version          = published_version.load( std::memory_order_relaxed );
+        stats.reclaimed_tables = reclaimed_tables.load( std::memory_order_relaxed );
+        stats.last_grace_us    = last_grace_us.load( std::memory_order_relaxed );
+        stats.snapshot_writes  = snapshot_writes.load( std::memory_order_relaxed );
+        stats.snapshot_errors  = snapshot_errors.load( std::memory_order_relaxed );
+        stats.restored_models  = restored_models.load( std::memory_order_relaxed );
+        stats.restore_ms       = restore_ms.load( std::memory_order_relaxed );
+        return stats;
+    }
+
+} // nsp::MGEN::MVEM
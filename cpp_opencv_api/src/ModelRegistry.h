@@ -0,0 +1,200 @@
+#ifndef _MGEN_MVEM_MODEL_REGISTRY_H_
+#define _MGEN_MVEM_MODEL_REGISTRY_H_
+
+/* ====================================
+ * Homography Model Registry Class Header
+ * ------------------------------------
+ * Desc   : 계산이 끝난 호모그래피 모델(Calibrator, H, H^-1, 인라이어)을 모델 ID로 보관합니다.
+ * 투영 요청은 ID만으로 모델을 찾으므로 캘리브레이션/서베이 데이터를 다시 보내거나 다시 계산할 필요가 없습니다.
+ * 조회는 쓰기 잠금을 잡지 않으므로, 드물게 일어나는 모델 등록/삭제가 투영 트래픽을 막지 않습니다.
+ * 테이블 교체는 RCU(read-copy-update) 방식이며, 이전 테이블은 읽던 요청이 모두 빠져나간 뒤 해제됩니다.
+ * 스냅샷 파일을 지정하면 변경을 백그라운드 스레드가 바이너리 파일로 저장하고, 재시작 시 mmap으로 읽어 바로 복원합니다.
+ * ==================================== */
+
+#include "Calibrator.h"
+
+// OpenCV Core Types
+#include <opencv2/core/types.hpp> // cv::Matx33d, cv::Point2f
+
+// STL
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    /**
+     * @brief 한 카메라의 호모그래피 모델. 등록 후 불변이며 여러 요청이 공유합니다.
+     */
+    struct HomographyModel
+    {
+        std::string id;                                /**< 모델 ID */
+        std::shared_ptr<const Calibrator> calibrator;  /**< 왜곡 보정기 */
+        cv::Matx33d homography;                        /**< 보정된 픽셀 -> 지상 좌표 */
+        cv::Matx33d inverse_homography;                /**< 지상 좌표 -> 보정된 픽셀 */
+        std::vector<cv::Point2f> inlier_image_points;  /**< 추정에 쓰인 인라이어 (보정된 픽셀 좌표) */
+        std::vector<cv::Point2f> inlier_ground_points; /**< 추정에 쓰인 인라이어 (지상 좌표) */
+        size_t survey_points = 0;                      /**< 추정에 입력된 포인트 쌍 개수 (아웃라이어 포함) */
+        uint64_t version = 0;                          /**< 등록 시 레지스트리가 부여하는 버전 (단조 증가, 재등록 시 증가) */
+    };
+
+    /**
+     * @brief 모델 ID -> HomographyModel 레지스트리.
+     * 내부 테이블은 쓰기 시 복사(copy-on-write)되는 불변 객체이며, 원자적 포인터 교체로 게시합니다.
+     * 조회(Find/List)는 읽기 구간 카운터를 하나 올리고 포인터를 읽을 뿐, 잠금이나 대기가 없습니다.
+     * 등록/삭제는 내부 mutex로 직렬화하며, 새 테이블을 게시한 뒤 유예 기간(grace period)이 끝나면
+     * 이전 테이블을 해제합니다. 모델 자체는 shared_ptr이므로 그 모델로 처리 중인 요청이 끝날 때 해제됩니다.
+     */
+    class ModelRegistry
+    {
+    public:
+        /**
+         * @brief 레지스트리 상태 스냅샷.
+         */
+        struct Stats
+        {
+            size_t   models           = 0; /**< 등록된 모델 수 */
+            uint64_t version          = 0; /**< 마지막으로 부여한 모델 버전 */
+            uint64_t reclaimed_tables = 0; /**< 유예 기간 후 해제된 이전 테이블 수 */
+            double   last_grace_us    = 0.0; /**< 마지막 유예 기간 대기 시간 (마이크로초) */
+            uint64_t snapshot_writes  = 0; /**< 스냅샷 파일 저장 성공 횟수 */
+            uint64_t snapshot_errors  = 0; /**< 스냅샷 파일 저장 실패 횟수 */
+            size_t   restored_models  = 0; /**< 시작 시 스냅샷에서 복원한 모델 수 */
+            double   restore_ms       = 0.0; /**< 스냅샷 복원에 걸린 시간 (밀리초) */
+        };
+
+        /** 스냅샷 파일 포맷 버전 (레코드 구조가 바뀌면 증가) */
+        static constexpr uint32_t SNAPSHOT_VERSION = 2;
+
+        ModelRegistry();
+        ~ModelRegistry();
+
+        ModelRegistry( const ModelRegistry& ) = delete;
+        ModelRegistry& operator=( const ModelRegistry& ) = delete;
+
+        /** 모델 ID 최대 길이 */
+        static constexpr size_t MAX_ID_LENGTH = 64;
+
+        /**
+         * @brief 모델 ID 형식 검사: 1 ~ MAX_ID_LENGTH 글자의 영문자, 숫자, '_', '-', '.'
+         */
+        static bool IsValidId( const std::string& id ) noexcept;
+
+        /**
+         * @brief 모델을 찾습니다. (잠금/대기 없음)
+         * @return 모델. 없으면 nullptr.
+         */
+        std::shared_ptr<const HomographyModel> Find( const std::string& id ) const;
+
+        /**
+         * @brief 모델에 새 버전을 부여하고 등록합니다. 같은 ID가 있으면 교체합니다.
+         * 교체 전에 얻은 모델을 사용 중인 요청은 그 모델(이전 버전)로 끝까지 처리됩니다.
+         * @return 부여한 버전. model이 nullptr이면 0.
+         */
+        uint64_t Publish( std::shared_ptr<HomographyModel> model );
+
+        /**
+         * @brief 모델을 삭제합니다.
+         * @return 삭제했으면 true, 없는 ID면 false.
+         */
+        bool Remove( const std::string& id );
+
+        /**
+         * @brief 등록된 모든 모델 (순서 없음).
+         */
+        std::vector<std::shared_ptr<const HomographyModel>> List() const;
+
+        /**
+         * @brief 스냅샷 파일을 사용합니다. 파일이 있으면 mmap으로 읽어 검증한 뒤 모든 모델을 복원하고,
+         * 이후 등록/삭제가 있으면 저장 스레드가 같은 파일에 현재 테이블을 저장합니다. (임시 파일 + rename)
+         * 저장은 요청 경로 밖에서 일어나며, 연달아 일어난 변경은 한 번의 저장으로 합쳐집니다. 소멸 시 남은 변경을 저장합니다.
+         * 파라미터, 옵션, H, H^-1, 인라이어, 버전을 저장하며, 격자(UndistortGrid)는 현재 서버 설정의
+         * 격자 캐시 디렉토리(Calibrator::GridCacheDir)에 있는 격자 파일을 Calibrator가 mmap으로 다시 읽습니다.
+         * 서버 시작 전에 한 번 호출합니다.
+         * @param path 스냅샷 파일 경로.
+         * @return 복원한 모델 수. 파일이 없거나 손상되었으면 0 (손상된 파일은 다음 저장 때 덮어씀).
+         */
+        size_t EnableSnapshot( const std::string& path );
+
+        // Getter
+        size_t size() const;
+        Stats getStats() const;
+
+    private:
+        using Table = std::unordered_map<std::string, std::shared_ptr<const HomographyModel>>;
+
+        /**
+         * @brief 읽기 구간 (RAII). 생성 시 현재 위상의 카운터를 올리고 소멸 시 내립니다.
+         * 이 객체가 살아 있는 동안 Load()로 얻은 테이블은 해제되지 않습니다.
+         */
+        class ReadSection
+        {
+        public:
+            explicit ReadSection( const ModelRegistry& registry ) noexcept;
+            ~ReadSection();
+
+            ReadSection( const ReadSection& ) = delete;
+            ReadSection& operator=( const ReadSection& ) = delete;
+
+            const Table& Load() const noexcept;
+
+        private:
+            const ModelRegistry& owner;
+            unsigned phase;
+        }; // cls::ModelRegistry::ReadSection
+
+        // 새 테이블을 게시하고, 유예 기간 후 이전 테이블을 해제합니다. (write_lock 보유 상태에서 호출)
+        void Replace( const Table* next );
+
+        // 게시 이전에 시작된 모든 읽기 구간이 끝날 때까지 기다립니다. (write_lock 보유 상태에서 호출)
+        void WaitForReaders();
+
+        // 스냅샷 저장을 요청합니다. (저장 스레드가 처리, 스냅샷을 사용하지 않으면 무시)
+        void ScheduleSnapshot();
+
+        // 저장 스레드 본체: 요청이 있을 때마다 WriteSnapshot을 호출합니다.
+        void FlushLoop();
+
+        // 현재 게시된 테이블을 스냅샷 파일로 저장합니다. (저장 스레드에서만 호출)
+        void WriteSnapshot( const std::string& path );
+
+        // 스냅샷 파일을 읽어 새 테이블을 만듭니다. 검증에 실패하면 nullptr.
+        static std::unique_ptr<Table> ReadSnapshot( const std::string& path, uint64_t& max_version );
+
+        struct alignas( 64 ) ReaderCounter
+        {
+            std::atomic<uint64_t> active{ 0 };
+        };
+
+        std::atomic<const Table*> current;       // 현재 게시된 테이블
+        mutable ReaderCounter readers[ 2 ];      // 위상별 읽기 구간 수
+        std::atomic<unsigned> reader_phase{ 0 }; // 새 읽기 구간이 사용할 위상 (0 / 1)
+
+        std::mutex write_lock;                   // 등록/삭제 직렬화
+        uint64_t next_version = 0;               // write_lock 아래에서만 증가
+        std::string snapshot_path;               // 비어 있으면 스냅샷 사용 안 함 (flush_lock 아래에서 접근)
+
+        // 스냅샷 저장 스레드 (EnableSnapshot에서 시작)
+        std::mutex flush_lock;
+        std::condition_variable flush_cv;
+        bool flush_pending = false;              // flush_lock 아래에서 접근
+        bool flush_stop = false;                 // flush_lock 아래에서 접근
+        std::thread flush_thread;
+        std::atomic<uint64_t> published_version{ 0 };
+        std::atomic<uint64_t> reclaimed_tables{ 0 };
+        std::atomic<double> last_grace_us{ 0.0 };
+        std::atomic<uint64_t> snapshot_writes{ 0 };
+        std::atomic<uint64_t> snapshot_errors{ 0 };
+        std::atomic<size_t> restored_models{ 0 };
+        std::atomic<double> restore_ms{ 0.0 };
+    }; // cls::ModelRegistry
+
+} // nsp::MGEN::MVEM
+
+#endif // _MGEN_MVEM_MODEL_REGISTRY_H_
@@ -3,6 +3,9 @@
 #include "RestApiServer.h"
 #include "MgenLogger.h"      // 사용자 제공 로거
 #include "json/json.hpp"     // nlohmann/json
+#include <algorithm>           // std::transform
+#include <cctype>              // std::tolower
+#include <vector>
 
 using json = nlohmann::json; // JSON 별칭
 
@@ -11,6 +14,59 @@ using json = nlohmann::json; // JSON 별칭
 constexpr auto CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY = "calibration_config";
 constexpr auto SURVEY_DATA_KEY_IN_REQUEST_BODY = "survey_data";
 
+// 포인트 투영/역투영 요청(/api/homography/project_points, unproject_points) 본문의 키 이름들
+constexpr auto HOMOGRAPHY_MATRIX_KEY_IN_REQUEST_BODY = "homography_matrix"; // 3x3 배열 (calculate_dynamic 응답과 동일한 형식)
+constexpr auto POINTS_KEY_IN_REQUEST_BODY = "points";                       // {"x": [...], "y": [...]}
+constexpr auto MODEL_ID_KEY_IN_REQUEST_BODY = "model_id";                   // 등록된 모델 ID (calculate_dynamic: 등록, 투영: 조회)
+constexpr auto ESTIMATOR_KEY_IN_REQUEST_BODY = "estimator";                 // (선택) 호모그래피 추정 방식 {"method": "auto" | "ransac" | "dlt" | ..., ...}
+constexpr auto DIAGNOSTICS_KEY_IN_REQUEST_BODY = "diagnostics";             // (선택) 추가 진단 {"leave_one_out": true}
+
+// 다중 카메라 일괄 계산 요청(/api/homography/calculate_batch) 본문의 키 이름과 한도
+constexpr auto JOBS_KEY_IN_REQUEST_BODY = "jobs"; // [{"calibration_config": {...}, "survey_data": {...}, "model_id": "...", "estimator": {...}, "diagnostics": {...}}, ...]
+constexpr size_t MAX_JOBS_PER_BATCH = 256;
+
+// 증분 편집 세션 요청(/api/homography/sessions/...) 본문의 키 이름
+constexpr auto POINT_KEY_IN_REQUEST_BODY = "point"; // {"camera_coords": [x, y], "ground_coords": [gx, gy]}
+
+// 이미지 왜곡 보정 요청(multipart/form-data)의 필드 이름들
+constexpr auto IMAGE_FIELD_IN_MULTIPART = "image";   // 인코딩된 이미지 파일
+constexpr auto FORMAT_FIELD_IN_MULTIPART = "format"; // (선택) 출력 형식: "png" | "jpg" (기본: 입력 파일 형식)
+
+// 라우트 본체가 돌려주는 요청 오류 결과 (makeJsonHandler가 status_code로 응답)
+static json requestError(const std::string& message, int status_code = 400) {
+    return {{"success", false}, {"error", message}, {"status_code", status_code}};
+}
+
+// 필수 키가 JSON 객체가 아니면 에러 메시지, 맞으면 빈 문자열
+static std::string requireObject(const json& body, const char* key, const char* container = "Request body") {
+    if (!body.contains(key) || !body.at(key).is_object()) {
+        return std::string(container) + " must contain '" + key + "' as a JSON object.";
+    }
+    return std::string();
+}
+
+// 선택 키가 있는데 기대한 형식이 아니면 에러 메시지, 맞으면 빈 문자열
+static std::string optionalObject(const json& body, const char* key) {
+    return (body.contains(key) && !body.at(key).is_object()) ? std::string("'") + key + "' must be a JSON object." : std::string();
+}
+static std::string optionalString(const json& body, const char* key) {
+    return (body.contains(key) && !body.at(key).is_string()) ? std::string("'") + key + "' must be a string." : std::string();
+}
+
+// calculate_dynamic 요청 / calculate_batch 작업 한 개의 형식 검사 (container: 에러 메시지의 주어)
+static std::string validateCalculationJob(const json& job, const char* container) {
+    for (const std::string& error : {requireObject(job, CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY, container),
+                                     requireObject(job, SURVEY_DATA_KEY_IN_REQUEST_BODY, container),
+                                     optionalString(job, MODEL_ID_KEY_IN_REQUEST_BODY),
+                                     optionalObject(job, ESTIMATOR_KEY_IN_REQUEST_BODY),
+                                     optionalObject(job, DIAGNOSTICS_KEY_IN_REQUEST_BODY)}) {
+        if (!error.empty()) {
+            return error;
+        }
+    }
+    return std::string();
+}
+
 RestApiServer::RestApiServer(std::shared_ptr<HomographyCalculator> calculator, const std::string& address, int port)
     : homography_calculator_(calculator), address_(address), port_(port), is_running_(false) {
     if (!homography_calculator_) {
@@ -128,7 +184,7 @@ void RestApiServer::setup_routes() {
         {"Server", "HomographyApiService/1.0"},
         {"Content-Type", "application/json"}, // 기본 응답 타입을 JSON으로 설정
         {"Access-Control-Allow-Origin", "*"}, // CORS: 모든 출처 허용 (프로덕션에서는 특정 도메인으로 제한 권장)
-        {"Access-Control-Allow-Methods", "POST, GET, OPTIONS"}, // 허용할 HTTP 메소드
+        {"Access-Control-Allow-Methods", "POST, GET, PUT, DELETE, OPTIONS"}, // 허용할 HTTP 메소드
         {"Access-Control-Allow-Headers", "Content-Type, Authorization"} // 허용할 요청 헤더
     });
 
@@ -182,6 +238,24 @@ void RestApiServer::setup_routes() {
         // res.set_header("Access-Control-Allow-Methods", "POST, OPTIONS");
         res.status = 204; // No Content - 성공적인 preflight 응답
     });
+    svr_.Options("/api/homography/calculate_batch", [](const httplib::Request&, httplib::Response& res) {
+        res.status = 204;
+    });
+    svr_.Options("/api/homography/project_points", [](const httplib::Request&, httplib::Response& res) {
+        res.status = 204;
+    });
+    svr_.Options("/api/homography/unproject_points", [](const httplib::Request&, httplib::Response& res) {
+        res.status = 204;
+    });
+    svr_.Options(R"(/api/homography/models(/[A-Za-z0-9_.\-]+)?)", [](const httplib::Request&, httplib::Response& res) {
+        res.status = 204;
+    });
+    svr_.Options("/api/homography/undistort_image", [](const httplib::Request&, httplib::Response& res) {
+        res.status = 204;
+    });
+    svr_.Options(R"(/api/homography/sessions(/[A-Za-z0-9]+(/points(/[0-9]+)?|/ransac)?)?)", [](const httplib::Request&, httplib::Response& res) {
+        res.status = 204;
+    });
     svr_.Options("/health", [](const httplib::Request&, httplib::Response& res) {
         res.status = 204;
     });
@@ -206,88 +280,325 @@ void RestApiServer::setup_routes() {
         }
     });
 
+    // 1-1. 런타임 통계 엔드포인트 (GET /api/homography/stats)
+    svr_.Get("/api/homography/stats", makeJsonHandler("GET /api/homography/stats", BodyMode::None,
+        "Statistics collection failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request&, const json&) {
+            json response_body = calculator.getStatistics();
+            response_body["success"] = true;
+            return response_body;
+        }));
+
     // 2. 호모그래피 계산 엔드포인트 (POST /api/homography/calculate_dynamic)
-    svr_.Post("/api/homography/calculate_dynamic", [weak_self](const httplib::Request& req, httplib::Response& res) {
-        auto self = weak_self.lock(); // 서버 인스턴스 유효성 검사
-        if (!self) {
-            res.status = 503; // Service Unavailable
-            MLOG_ERROR("POST /api/homography/calculate_dynamic: Server instance no longer available.");
-            return;
-        }
-        if (!self->homography_calculator_) { // 계산기 객체 유효성 검사
-            res.status = 500; // Internal Server Error
-            json err_body = {{"success", false}, {"error", "HomographyCalculator is not initialized in the server."}};
-            res.set_content(err_body.dump(), "application/json");
-            MLOG_ERROR("HomographyCalculator instance is null in POST /api/homography/calculate_dynamic handler.");
-            return;
-        }
+    svr_.Post("/api/homography/calculate_dynamic", makeJsonHandler("POST /api/homography/calculate_dynamic", BodyMode::Required,
+        "Homography calculation processing failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request&, const json& request_body_json) {
+            // calibration_config, survey_data(필수)와 model_id, estimator, diagnostics(선택) 형식 검사
+            const std::string request_error = validateCalculationJob(request_body_json, "Request body");
+            if (!request_error.empty()) {
+                MLOG_WARN("Invalid calculate_dynamic request: %s", request_error.c_str());
+                return requestError(request_error);
+            }
+            // (선택) model_id가 있으면 계산된 모델을 그 ID로 등록
+            const std::string model_id = request_body_json.value(MODEL_ID_KEY_IN_REQUEST_BODY, std::string());
+            // (선택) 추정 방식 (없으면 "auto")
+            const json estimator_json = request_body_json.value(ESTIMATOR_KEY_IN_REQUEST_BODY, json());
+            // (선택) leave-one-out 등 추가 진단
+            const json diagnostics_json = request_body_json.value(DIAGNOSTICS_KEY_IN_REQUEST_BODY, json());
+            // 계산 실패 시 계산기가 결과에 에러 메시지와 status_code(없으면 422)를 담아 돌려줌
+            return calculator.calculateWithProvidedData(request_body_json.at(CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY),
+                                                        request_body_json.at(SURVEY_DATA_KEY_IN_REQUEST_BODY), model_id,
+                                                        estimator_json, diagnostics_json);
+        }));
+
+    // 2-1. 다중 카메라 일괄 계산 엔드포인트 (POST /api/homography/calculate_batch)
+    // 본문: {"jobs": [{"calibration_config": {...}, "survey_data": {...}, "model_id": "cam-01"(선택), "estimator": {...}(선택)}, ...]}
+    // 응답: {"success": true, "results": [작업 순서대로 calculate_dynamic과 같은 형식], "succeeded": N, "failed": M}
+    // 작업은 공용 워커 풀에서 병렬로 계산하며, 잘못된 작업은 그 작업의 결과에만 에러로 표시합니다.
+    svr_.Post("/api/homography/calculate_batch", makeJsonHandler("POST /api/homography/calculate_batch", BodyMode::Required,
+        "Batch homography calculation processing failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request&, const json& request_body_json) {
+            if (!request_body_json.contains(JOBS_KEY_IN_REQUEST_BODY) || !request_body_json.at(JOBS_KEY_IN_REQUEST_BODY).is_array()) {
+                return requestError(std::string("Request body must contain '") + JOBS_KEY_IN_REQUEST_BODY + std::string("' as a JSON array."));
+            }
+            const auto& jobs_json = request_body_json.at(JOBS_KEY_IN_REQUEST_BODY);
+            if (jobs_json.size() > MAX_JOBS_PER_BATCH) {
+                return requestError("Too many jobs in one batch (maximum " + std::to_string(MAX_JOBS_PER_BATCH) + ").", 413); // Payload Too Large
+            }
 
-        MLOG_INFO("Processing POST /api/homography/calculate_dynamic. Body length: %d", req.body.length());
+            // 작업별 형식 검사: 통과한 작업만 계산기에 넘기고, 실패한 작업은 그 자리에 에러 결과를 둠
+            std::vector<json> results(jobs_json.size());
+            std::vector<HomographyCalculator::CalculationJob> jobs;
+            std::vector<size_t> job_slots; // jobs[i]의 결과가 들어갈 results 인덱스
+            jobs.reserve(jobs_json.size());
+            job_slots.reserve(jobs_json.size());
+            for (size_t i = 0; i < jobs_json.size(); ++i) {
+                const auto& job_json = jobs_json.at(i);
+                const std::string job_error = job_json.is_object() ? validateCalculationJob(job_json, "Job") : std::string("Job must be a JSON object.");
+                if (!job_error.empty()) {
+                    results[i] = requestError(job_error);
+                    continue;
+                }
+                jobs.push_back({&job_json.at(CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY),
+                                &job_json.at(SURVEY_DATA_KEY_IN_REQUEST_BODY),
+                                job_json.value(MODEL_ID_KEY_IN_REQUEST_BODY, std::string()),
+                                job_json.contains(ESTIMATOR_KEY_IN_REQUEST_BODY) ? &job_json.at(ESTIMATOR_KEY_IN_REQUEST_BODY) : nullptr,
+                                job_json.contains(DIAGNOSTICS_KEY_IN_REQUEST_BODY) ? &job_json.at(DIAGNOSTICS_KEY_IN_REQUEST_BODY) : nullptr});
+                job_slots.push_back(i);
+            }
 
-        json request_body_json;
-        try {
-            if (req.body.empty()) { // 요청 본문이 비어있는 경우
-                throw std::runtime_error("Request body is empty. Expected JSON data.");
+            std::vector<json> computed = calculator.calculateBatch(jobs);
+            for (size_t j = 0; j < computed.size(); ++j) {
+                results[job_slots[j]] = std::move(computed[j]);
             }
-            request_body_json = json::parse(req.body); // 요청 본문을 JSON으로 파싱
-        } catch (const json::parse_error& e) {
-            res.status = 400; // Bad Request - JSON 파싱 실패
-            json err_body = {{"success", false}, {"error", "Invalid JSON format in request body."}, {"details", e.what()}};
-            res.set_content(err_body.dump(), "application/json");
-            MLOG_WARN("Failed to parse JSON request body for /api/homography/calculate_dynamic: %s", e.what());
-            return;
-        } catch (const std::exception& e) { // 기타 예외 (예: runtime_error)
-             res.status = 400;
-             json err_body = {{"success", false}, {"error", "Error processing request body."}, {"details", e.what()}};
-             res.set_content(err_body.dump(), "application/json");
-             MLOG_WARN("Error processing request body for /api/homography/calculate_dynamic: %s", e.what());
-             return;
-        }
 
+            size_t succeeded = 0;
+            for (auto& result : results) {
+                succeeded += result.value("success", false) ? 1 : 0;
+            }
+            // 작업별 성공/실패는 results에 표시하고 응답 자체는 200
+            return json{
+                {"success", true},
+                {"results", std::move(results)},
+                {"succeeded", succeeded},
+                {"failed", jobs_json.size() - succeeded}
+            };
+        }));
+
+    // 3. 포인트 일괄 투영 엔드포인트 (POST /api/homography/project_points)
+    // 본문: {"calibration_config": {...}, "homography_matrix": [[...],[...],[...]], "points": {"x": [...], "y": [...]}}
+    //   또는 {"model_id": "cam-01", "points": {...}} (calculate_dynamic에서 등록한 모델 사용)
+    // 4. 지상 좌표 일괄 역투영 엔드포인트 (POST /api/homography/unproject_points)
+    // 본문: 3과 같은 형식 (points는 지상 좌표, homography_matrix는 project_points와 같은 행렬)
+    for (const bool inverse : {false, true}) {
+        const char* route = inverse ? "POST /api/homography/unproject_points" : "POST /api/homography/project_points";
+        svr_.Post(inverse ? "/api/homography/unproject_points" : "/api/homography/project_points", makeJsonHandler(route, BodyMode::Required,
+            inverse ? "Inverse point projection processing failed on server." : "Point projection processing failed on server.",
+            [inverse](HomographyCalculator& calculator, const httplib::Request&, const json& request_body_json) {
+                const std::string model_id_error = optionalString(request_body_json, MODEL_ID_KEY_IN_REQUEST_BODY);
+                if (!model_id_error.empty()) {
+                    return requestError(model_id_error);
+                }
+                // model_id가 있으면 등록된 모델 사용, 없으면 calibration_config + homography_matrix 필요
+                const bool use_model = request_body_json.contains(MODEL_ID_KEY_IN_REQUEST_BODY);
+                std::vector<const char*> required_keys = {POINTS_KEY_IN_REQUEST_BODY};
+                if (!use_model) {
+                    required_keys.push_back(CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY);
+                    required_keys.push_back(HOMOGRAPHY_MATRIX_KEY_IN_REQUEST_BODY);
+                }
+                for (const char* key : required_keys) {
+                    if (!request_body_json.contains(key)) {
+                        return requestError(std::string("Request body must contain '") + key + std::string("'."));
+                    }
+                }
+                const json& points_json = request_body_json.at(POINTS_KEY_IN_REQUEST_BODY);
+                if (use_model) {
+                    const std::string model_id = request_body_json.value(MODEL_ID_KEY_IN_REQUEST_BODY, std::string());
+                    return inverse ? calculator.unprojectPointsWithModel(model_id, points_json)
+                                   : calculator.projectPointsWithModel(model_id, points_json);
+                }
+                const json& calibration_json_data = request_body_json.at(CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY);
+                const json& homography_json = request_body_json.at(HOMOGRAPHY_MATRIX_KEY_IN_REQUEST_BODY);
+                return inverse ? calculator.unprojectPoints(calibration_json_data, homography_json, points_json)
+                               : calculator.projectPoints(calibration_json_data, homography_json, points_json);
+            }));
+    }
 
-        // 요청된 JSON 본문에서 calibration_config와 survey_data 객체 추출
-        if (!request_body_json.contains(CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY) ||
-            !request_body_json.at(CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY).is_object()) {
-            res.status = 400; // Bad Request
-            json err_body = {{"success", false}, {"error", std::string("Request body must contain '") + CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY + std::string("' as a JSON object.")}};
-            res.set_content(err_body.dump(), "application/json");
-            MLOG_WARN("Missing or invalid '%s' in JSON request body.", CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY);
+    // 5. 등록된 모델 목록 (GET /api/homography/models) / 삭제 (DELETE /api/homography/models/{model_id})
+    svr_.Get("/api/homography/models", makeJsonHandler("GET /api/homography/models", BodyMode::None,
+        "Model listing failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request&, const json&) {
+            return calculator.listModels();
+        }));
+    svr_.Delete(R"(/api/homography/models/([A-Za-z0-9_.\-]+))", makeJsonHandler("DELETE /api/homography/models", BodyMode::None,
+        "Model removal failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request& req, const json&) {
+            const std::string model_id = req.matches[1];
+            if (!calculator.removeModel(model_id)) {
+                return requestError("Unknown model_id '" + model_id + "'.", 404); // Not Found
+            }
+            return json{{"success", true}, {"model_id", model_id}};
+        }));
+
+    // 6. 이미지 왜곡 보정 엔드포인트 (POST /api/homography/undistort_image)
+    // multipart/form-data: "image"(파일), "calibration_config"(JSON 문자열), "format"(선택)
+    // 성공 시 보정된 이미지 바이트를 그대로 응답하고, remap 맵 캐시 적중 여부는 X-Remap-Cache 헤더로 알립니다.
+    // 응답이 JSON이 아니므로 본문 처리는 직접 하고, 서버/계산기/예외 처리만 공용 처리기를 사용합니다.
+    svr_.Post("/api/homography/undistort_image", makeCalculatorHandler("POST /api/homography/undistort_image",
+        "Image undistortion processing failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request& req, httplib::Response& res) {
+            auto send_error = [&res](const json& error) {
+                res.status = error.value("status_code", 422);
+                res.set_content(error.dump(), "application/json");
+            };
+            if (!req.is_multipart_form_data() || !req.has_file(IMAGE_FIELD_IN_MULTIPART) || !req.has_file(CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY)) {
+                MLOG_WARN("Missing multipart fields in POST /api/homography/undistort_image.");
+                send_error(requestError(std::string("Request must be multipart/form-data with '") + IMAGE_FIELD_IN_MULTIPART +
+                                        std::string("' and '") + CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY + std::string("' fields.")));
+                return;
+            }
+
+            const auto image_part = req.get_file_value(IMAGE_FIELD_IN_MULTIPART);
+            MLOG_INFO("Processing POST /api/homography/undistort_image. Image size: %zu bytes", image_part.content.size());
+
+            json calibration_json_data;
+            try {
+                calibration_json_data = json::parse(req.get_file_value(CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY).content);
+            } catch (const json::parse_error& e) {
+                MLOG_WARN("Failed to parse '%s' field for /api/homography/undistort_image: %s", CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY, e.what());
+                json error = requestError(std::string("Invalid JSON format in '") + CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY + std::string("' field."));
+                error["details"] = e.what();
+                send_error(error);
+                return;
+            }
+            if (!calibration_json_data.is_object()) {
+                send_error(requestError(std::string("'") + CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY + std::string("' field must be a JSON object.")));
+                return;
+            }
+
+            // 출력 형식: 명시값 > 입력 파일의 Content-Type > png
+            std::string format = req.has_file(FORMAT_FIELD_IN_MULTIPART) ? req.get_file_value(FORMAT_FIELD_IN_MULTIPART).content
+                                                                         : (image_part.content_type == "image/jpeg" ? "jpg" : "png");
+            std::transform(format.begin(), format.end(), format.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            if (format == "jpeg") {
+                format = "jpg";
+            }
+            if (format != "png" && format != "jpg") {
+                send_error(requestError("Unsupported output format '" + format + "'. Use 'png' or 'jpg'."));
+                return;
+            }
+
+            std::vector<unsigned char> output_bytes;
+            json result = calculator.undistortImage(calibration_json_data, image_part.content, "." + format, output_bytes);
+            if (!result.value("success", false)) {
+                send_error(result);
+                return;
+            }
+            res.set_header("X-Remap-Cache", result.value("remap_cache_hit", false) ? "hit" : "miss");
+            res.set_content(reinterpret_cast<const char*>(output_bytes.data()), output_bytes.size(), result.value("content_type", "image/png"));
+            res.status = 200; // OK
+        }));
+
+    // 7. 증분 편집 세션 (주석 UI): 포인트 하나를 고칠 때마다 전체 재계산 없이 갱신된 호모그래피를 반환
+    // POST   /api/homography/sessions                         본문: {"calibration_config": {...}, "survey_data": {...}(선택), "estimator": {...}(선택, ransac 재계산 방식)}
+    // GET    /api/homography/sessions/{session_id}            현재 상태 (포인트 목록 포함)
+    // DELETE /api/homography/sessions/{session_id}
+    // POST   /api/homography/sessions/{session_id}/points     본문: {"point": {"camera_coords": [x, y], "ground_coords": [gx, gy]}}
+    // PUT    /api/homography/sessions/{session_id}/points/{point_id}  본문: POST와 동일
+    // DELETE /api/homography/sessions/{session_id}/points/{point_id}
+    // POST   /api/homography/sessions/{session_id}/ransac     본문: {"model_id": "..."}(선택) - 세션의 estimator로 전체 재계산 (요청 시에만)
+    svr_.Post("/api/homography/sessions", makeJsonHandler("POST /api/homography/sessions", BodyMode::Optional,
+        "Session creation failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request&, const json& request_body_json) {
+            for (const std::string& error : {requireObject(request_body_json, CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY),
+                                             optionalObject(request_body_json, ESTIMATOR_KEY_IN_REQUEST_BODY)}) {
+                if (!error.empty()) {
+                    return requestError(error);
+                }
+            }
+            const json survey_json_data = request_body_json.value(SURVEY_DATA_KEY_IN_REQUEST_BODY, json());
+            const json estimator_json = request_body_json.value(ESTIMATOR_KEY_IN_REQUEST_BODY, json());
+            return calculator.createSession(request_body_json.at(CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY), survey_json_data, estimator_json);
+        }));
+    svr_.Get(R"(/api/homography/sessions/([A-Za-z0-9]+))", makeJsonHandler("GET /api/homography/sessions", BodyMode::None,
+        "Session query failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request& req, const json&) {
+            return calculator.getSession(req.matches[1]);
+        }));
+    svr_.Delete(R"(/api/homography/sessions/([A-Za-z0-9]+))", makeJsonHandler("DELETE /api/homography/sessions", BodyMode::None,
+        "Session removal failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request& req, const json&) {
+            const std::string session_id = req.matches[1];
+            if (!calculator.deleteSession(session_id)) {
+                return requestError("Unknown session_id '" + session_id + "'.", 404); // Not Found
+            }
+            return json{{"success", true}, {"session_id", session_id}};
+        }));
+    svr_.Post(R"(/api/homography/sessions/([A-Za-z0-9]+)/points)", makeJsonHandler("POST /api/homography/sessions/points", BodyMode::Optional,
+        "Session point edit failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request& req, const json& request_body_json) {
+            return calculator.addSessionPoint(req.matches[1], request_body_json.value(POINT_KEY_IN_REQUEST_BODY, json()));
+        }));
+    svr_.Put(R"(/api/homography/sessions/([A-Za-z0-9]+)/points/([0-9]{1,18}))", makeJsonHandler("PUT /api/homography/sessions/points", BodyMode::Optional,
+        "Session point edit failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request& req, const json& request_body_json) {
+            const uint64_t point_id = std::stoull(req.matches[2]);
+            return calculator.updateSessionPoint(req.matches[1], point_id, request_body_json.value(POINT_KEY_IN_REQUEST_BODY, json()));
+        }));
+    svr_.Delete(R"(/api/homography/sessions/([A-Za-z0-9]+)/points/([0-9]{1,18}))", makeJsonHandler("DELETE /api/homography/sessions/points", BodyMode::None,
+        "Session point edit failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request& req, const json&) {
+            const uint64_t point_id = std::stoull(req.matches[2]);
+            return calculator.removeSessionPoint(req.matches[1], point_id);
+        }));
+    svr_.Post(R"(/api/homography/sessions/([A-Za-z0-9]+)/ransac)", makeJsonHandler("POST /api/homography/sessions/ransac", BodyMode::Optional,
+        "Session refit failed on server.",
+        [](HomographyCalculator& calculator, const httplib::Request& req, const json& request_body_json) {
+            const std::string model_id_error = optionalString(request_body_json, MODEL_ID_KEY_IN_REQUEST_BODY);
+            if (!model_id_error.empty()) {
+                return requestError(model_id_error);
+            }
+            return calculator.refitSession(req.matches[1], request_body_json.value(MODEL_ID_KEY_IN_REQUEST_BODY, std::string()));
+        }));
+
+    MLOG_INFO("All API routes have been configured for RestApiServer.");
+}
+
+httplib::Server::Handler RestApiServer::makeCalculatorHandler(const char* route, const char* failure_message, CalculatorRoute body) {
+    std::weak_ptr<RestApiServer> weak_self = shared_from_this();
+    return [weak_self, route, failure_message, body = std::move(body)](const httplib::Request& req, httplib::Response& res) {
+        auto self = weak_self.lock(); // 서버 인스턴스 유효성 검사
+        if (!self) {
+            res.status = 503; // Service Unavailable
+            res.set_content(json({{"success", false}, {"error", "Server instance is no longer available."}}).dump(), "application/json");
+            MLOG_ERROR("%s: Server instance no longer available.", route);
             return;
         }
-        if (!request_body_json.contains(SURVEY_DATA_KEY_IN_REQUEST_BODY) ||
-            !request_body_json.at(SURVEY_DATA_KEY_IN_REQUEST_BODY).is_object()) {
-            res.status = 400; // Bad Request
-            json err_body = {{"success", false}, {"error", std::string("Request body must contain '") + SURVEY_DATA_KEY_IN_REQUEST_BODY + std::string("' as a JSON object.")}};
-            res.set_content(err_body.dump(), "application/json");
-            MLOG_WARN("Missing or invalid '%s' in JSON request body.", SURVEY_DATA_KEY_IN_REQUEST_BODY);
+        if (!self->homography_calculator_) { // 계산기 객체 유효성 검사
+            res.status = 500; // Internal Server Error
+            res.set_content(json({{"success", false}, {"error", "HomographyCalculator is not initialized in the server."}}).dump(), "application/json");
+            MLOG_ERROR("HomographyCalculator instance is null in %s handler.", route);
             return;
         }
-
-        const auto& calibration_json_data = request_body_json.at(CALIBRATION_CONFIG_KEY_IN_REQUEST_BODY);
-        const auto& survey_json_data      = request_body_json.at(SURVEY_DATA_KEY_IN_REQUEST_BODY);
-
-        // HomographyCalculator를 사용하여 계산 수행
         try {
-            json calculation_result = self->homography_calculator_->calculateWithProvidedData(calibration_json_data, survey_json_data);
-
-            // 계산 결과에 따라 HTTP 상태 코드 설정
-            if (calculation_result.value("success", false)) {
-                res.status = 200; // OK
-            } else {
-                // 계산 실패 시, HomographyCalculator가 반환한 JSON에 에러 메시지가 있을 것임
-                // 클라이언트에게 어떤 문제가 있었는지 알려주기 위해 4xx 또는 5xx 상태 코드 사용 가능
-                // 예: 입력 데이터 문제로 계산 불가 시 422 (Unprocessable Entity)
-                res.status = calculation_result.value("status_code", 422); // 계산기가 상태 코드를 제공하지 않으면 422 기본값
-            }
-            res.set_content(calculation_result.dump(), "application/json"); // 최종 결과 전송
+            body(*self->homography_calculator_, req, res);
         } catch (const std::exception& e) {
-            // HomographyCalculator 내부에서 발생한 예외 처리 (로깅은 Calculator 내부에서도 할 수 있음)
-            MLOG_ERROR("Exception during homography calculation triggered by API: %s", e.what());
+            // 계산기 내부에서 발생한 예외 처리 (로깅은 Calculator 내부에서도 할 수 있음)
+            MLOG_ERROR("Exception in %s: %s", route, e.what());
             res.status = 500; // Internal Server Error
-            json err_body = {{"success", false}, {"error", "Homography calculation processing failed on server."}, {"details", e.what()}};
-            res.set_content(err_body.dump(), "application/json");
+            res.set_content(json({{"success", false}, {"error", failure_message}, {"details", e.what()}}).dump(), "application/json");
         }
-    });
+    };
+}
 
-    MLOG_INFO("All API routes have been configured for RestApiServer.");
+httplib::Server::Handler RestApiServer::makeJsonHandler(const char* route, BodyMode body_mode, const char* failure_message, JsonRoute body) {
+    return makeCalculatorHandler(route, failure_message,
+        [route, body_mode, body = std::move(body)](HomographyCalculator& calculator, const httplib::Request& req, httplib::Response& res) {
+            if (body_mode != BodyMode::None) {
+                MLOG_INFO("Processing %s. Body length: %zu", route, req.body.length());
+            }
+            json request_body_json = json::object();
+            if (body_mode != BodyMode::None && !req.body.empty()) {
+                try {
+                    request_body_json = json::parse(req.body); // 요청 본문을 JSON으로 파싱
+                } catch (const json::parse_error& e) {
+                    json error = requestError("Invalid JSON format in request body.");
+                    error["details"] = e.what();
+                    res.status = 400; // Bad Request - JSON 파싱 실패
+                    res.set_content(error.dump(), "application/json");
+                    MLOG_WARN("Failed to parse JSON request body for %s: %s", route, e.what());
+                    return;
+                }
+            }
+            json error;
+            if (body_mode == BodyMode::Required && req.body.empty()) {
+                error = requestError("Request body is empty. Expected JSON data.");
+            } else if (!request_body_json.is_object()) {
+                error = requestError("Request body must be a JSON object.");
+            }
+            // 본체 결과: 성공이면 200, 실패면 결과의 status_code (없으면 422)
+            const json result = error.is_null() ? body(calculator, req, request_body_json) : error;
+            res.status = result.value("success", false) ? 200 : result.value("status_code", 422);
+            res.set_content(result.dump(), "application/json");
+        });
 }
@@ -8,6 +8,7 @@
 #include <memory>                 // std::shared_ptr, std::enable_shared_from_this
 #include <thread>                 // std::thread
 #include <atomic>                 // std::atomic
+#include <functional>             // std::function
 
 // C++ API 서비스가 내부적으로 리슨할 기본 포트 번호
 // 이 포트는 docker-compose.yml의 cpp_api_service.ports의 컨테이너 측 포트 및
@@ -71,6 +72,35 @@ private:
      */
     void setup_routes();
 
+    /** JSON 라우트의 요청 본문 처리 방식 */
+    enum class BodyMode {
+        None,     // 본문을 읽지 않음 (GET/DELETE)
+        Required, // 비어 있으면 400
+        Optional  // 비어 있으면 빈 객체
+    };
+
+    /** 계산기를 직접 사용해 응답을 채우는 라우트 본체 (이미지 등 JSON이 아닌 응답용) */
+    using CalculatorRoute = std::function<void(HomographyCalculator&, const httplib::Request&, httplib::Response&)>;
+
+    /** 파싱된 본문(JSON 객체)을 받아 결과 JSON을 돌려주는 라우트 본체 */
+    using JsonRoute = std::function<nlohmann::json(HomographyCalculator&, const httplib::Request&, const nlohmann::json&)>;
+
+    /**
+     * @brief 모든 계산기 라우트가 공유하는 처리기를 만듭니다.
+     * 서버가 이미 소멸했으면 503, 계산기가 없으면 500, 본체에서 예외가 나면 500
+     * ({"success": false, "error": failure_message, "details": ...})으로 응답합니다.
+     * @param route           로그에 쓸 라우트 이름 (예: "POST /api/homography/project_points").
+     * @param failure_message 예외 발생 시 응답의 "error".
+     */
+    httplib::Server::Handler makeCalculatorHandler(const char* route, const char* failure_message, CalculatorRoute body);
+
+    /**
+     * @brief makeCalculatorHandler에 JSON 본문 파싱과 결과 전송을 더한 처리기를 만듭니다.
+     * 본문이 JSON 객체가 아니면 400으로 응답하고, 본체의 결과는 "success"가 true면 200,
+     * 아니면 결과의 "status_code"(없으면 422)로 보냅니다. 모든 JSON 라우트의 에러 형식과 상태 코드가 여기서 정해집니다.
+     */
+    httplib::Server::Handler makeJsonHandler(const char* route, BodyMode body_mode, const char* failure_message, JsonRoute body);
+
     httplib::Server svr_; // httplib 서버 인스턴스
     std::string address_; // 리슨할 주소
     int port_;            // 리슨할 포트
@@ -0,0 +1,208 @@
+#include "ResultCache.h"
+
+// STL::C++
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    //--------------------------------------------------------------------------
+    // 함수: AppendDouble / AppendFloat / AppendInt (파일 내부)
+    // 설명: 키 바이트열에 값의 비트 패턴을 추가합니다. (-0.0은 0.0으로 정규화)
+    //--------------------------------------------------------------------------
+    static void AppendDouble( std::string& out, double v )
+    {
+        if( v == 0.0 ) {
+            v = 0.0;
+        }
+        out.append( reinterpret_cast<const char*>( &v ), sizeof( v ) );
+    }
+
+    static void AppendFloat( std::string& out, float v )
+    {
+        if( v == 0.0f ) {
+            v = 0.0f;
+        }
+        out.append( reinterpret_cast<const char*>( &v ), sizeof( v ) );
+    }
+
+    static void AppendInt( std::string& out, int64_t v )
+    {
+        out.append( reinterpret_cast<const char*>( &v ), sizeof( v ) );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Fnv1a (파일 내부)
+    // 설명: 키 바이트열의 64bit 해시 (색인용, 적중 시 전체 비교)
+    //--------------------------------------------------------------------------
+    static uint64_t Fnv1a( const std::string& data ) noexcept
+    {
+        uint64_t hash = 14695981039346656037ULL; // FNV offset basis
+        for( const char c : data ) {
+            hash ^= static_cast<uint8_t>( c );
+            hash *= 1099511628211ULL; // FNV prime
+        }
+        return hash;
+    }
+
+    ResultCache::ResultCache( size_t capacity, size_t max_bytes_, std::chrono::seconds ttl_ )
+        : max_entries( capacity > 0 ? capacity : 1 )
+        , max_bytes( max_bytes_ )
+        , ttl( ttl_ )
+    {
+    }
+
+    static bool CanonicalLess( const SurveyPair& a, const SurveyPair& b )
+    {
+        return std::tie( a.camera.x, a.camera.y, a.ground.x, a.ground.y ) < std::tie( b.camera.x, b.camera.y, b.ground.x, b.ground.y );
+    }
+
+    void ResultCache::Canonicalize( std::vector<SurveyPair>& pairs )
+    {
+        std::sort( pairs.begin(), pairs.end(), CanonicalLess );
+    }
+
+    void ResultCache::Canonicalize( std::vector<SurveyPair>& pairs, std::vector<size_t>& order )
+    {
+        order.resize( pairs.size() );
+        for( size_t i = 0; i < order.size(); ++i ) {
+            order[ i ] = i;
+        }
+        std::stable_sort( order.begin(), order.end(), [ &pairs ]( size_t a, size_t b ) { return CanonicalLess( pairs[ a ], pairs[ b ] ); } );
+
+        std::vector<SurveyPair> sorted;
+        sorted.reserve( pairs.size() );
+        for( const size_t index : order ) {
+            sorted.push_back( pairs[ index ] );
+        }
+        pairs.swap( sorted );
+    }
+
+    std::string ResultCache::MakeKey( const CalibratorParams& params, const CalibratorOptions& options,
+                                      const std::vector<SurveyPair>& sorted_pairs )
+    {
+        std::string key;
+        key.reserve( 16 * sizeof( double ) + options.grid.cache_dir.size() + sorted_pairs.size() * 4 * sizeof( float ) );
+
+        for( const CalibratorParamKey& k : CALIBRATOR_PARAM_KEYS ) {
+            AppendDouble( key, params.*k.member );
+        }
+        AppendInt( key, static_cast<int64_t>( options.solver ) );
+        AppendInt( key, options.max_iterations );
+        AppendInt( key, options.image_width );
+        AppendInt( key, options.image_height );
+        AppendInt( key, options.inverse_model.enable ? 1 : 0 );
+        AppendDouble( key, options.inverse_model.tolerance_px );
+        AppendInt( key, options.grid.enable ? 1 : 0 );
+        AppendInt( key, options.grid.cell );
+        AppendInt( key, static_cast<int64_t>( options.grid.cache_dir.size() ) );
+        key.append( options.grid.cache_dir );
+
+        AppendInt( key, static_cast<int64_t>( sorted_pairs.size() ) );
+        for( const SurveyPair& pair : sorted_pairs ) {
+            AppendFloat( key, pair.camera.x );
+            AppendFloat( key, pair.camera.y );
+            AppendFloat( key, pair.ground.x );
+            AppendFloat( key, pair.ground.y );
+        }
+        return key;
+    }
+
+    size_t ResultCache::EstimateBytes( const std::string& key, const Result& result ) noexcept
+    {
+        constexpr size_t NODE_OVERHEAD = 64; // 리스트/해시 노드와 shared_ptr 제어 블록 (추정)
+        return sizeof( Entry ) + sizeof( Result ) + NODE_OVERHEAD + key.capacity()
+             + ( result.inlier_image_points.capacity() + result.inlier_ground_points.capacity() ) * sizeof( cv::Point2f )
+             + result.inlier_mask.capacity()
+             + ( result.forward_errors.capacity() + result.backward_errors.capacity() ) * sizeof( float )
+             + result.leave_one_out.capacity() * sizeof( LeaveOneOut );
+    }
+
+    void ResultCache::EraseLocked( std::list<Entry>::iterator it )
+    {
+        total_bytes -= it->bytes;
+        index.erase( it->hash );
+        order.erase( it );
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Find
+    // 설명: 해시로 찾은 뒤 키 전체를 비교합니다. 만료된 항목은 이 시점에 제거합니다.
+    //--------------------------------------------------------------------------
+    std::shared_ptr<const ResultCache::Result> ResultCache::Find( const std::string& key )
+    {
+        const uint64_t hash = Fnv1a( key );
+        std::lock_guard<std::mutex> guard( lock );
+        const auto it = index.find( hash );
+        if( it == index.end() || it->second->key != key ) {
+            misses.fetch_add( 1, std::memory_order_relaxed );
+            return nullptr;
+        }
+        if( std::chrono::steady_clock::now() >= it->second->expires_at ) {
+            EraseLocked( it->second );
+            expirations.fetch_add( 1, std::memory_order_relaxed );
+            misses.fetch_add( 1, std::memory_order_relaxed );
+            return nullptr;
+        }
+        order.splice( order.begin(), order, it->second );
+        hits.fetch_add( 1, std::memory_order_relaxed );
+        return it->second->result;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Insert
+    // 설명: 같은 해시의 항목(같은 키 또는 충돌)은 교체하고, 한도를 넘으면 LRU 항목부터 제거합니다.
+    //--------------------------------------------------------------------------
+    void ResultCache::Insert( const std::string& key, std::shared_ptr<const Result> result )
+    {
+        if( result == nullptr ) {
+            return;
+        }
+        const uint64_t hash  = Fnv1a( key );
+        const size_t   bytes = EstimateBytes( key, *result );
+        if( bytes > max_bytes ) {
+            return; // 한 항목이 전체 한도보다 크면 저장하지 않음
+        }
+
+        std::lock_guard<std::mutex> guard( lock );
+        const auto it = index.find( hash );
+        if( it != index.end() ) {
+            EraseLocked( it->second );
+        }
+        order.push_front( Entry { hash, key, std::move( result ), bytes, std::chrono::steady_clock::now() + ttl } );
+        index.emplace( hash, order.begin() );
+        total_bytes += bytes;
+
+        while( order.size() > max_entries || total_bytes > max_bytes ) {
+            EraseLocked( std::prev( order.end() ) );
+            evictions.fetch_add( 1, std::memory_order_relaxed );
+        }
+    }
+
+    void ResultCache::clear( void )
+    {
+        std::lock_guard<std::mutex> guard( lock );
+        order.clear();
+        index.clear();
+        total_bytes = 0;
+    }
+
+    ResultCache::Stats ResultCache::getStats( void ) const
+    {
+        std::lock_guard<std::mutex> guard( lock );
+        Stats s;
+        s.hits        = hits.load( std::memory_order_relaxed );
+        s.misses      = misses.load( std::memory_order_relaxed );
+        s.expirations = expirations.load( std::memory_order_relaxed );
+        s.evictions   = evictions.load( std::memory_order_relaxed );
+        s.size        = order.size();
+        s.capacity    = max_entries;
+        s.bytes       = total_bytes;
+        s.max_bytes   = max_bytes;
+        return s;
+    }
+
+} // nsp::MGEN::MVEM
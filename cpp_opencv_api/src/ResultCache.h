@@ -0,0 +1,174 @@
+#ifndef _MGEN_MVEM_RESULT_CACHE_H_
+#define _MGEN_MVEM_RESULT_CACHE_H_
+
+/* ====================================
+ * Homography Result Cache Class Header
+ * ------------------------------------
+ * Desc   : 정규화된 calculate_dynamic 요청(카메라 파라미터 + 정렬된 서베이 포인트)의 내용을 키로
+ * 계산 결과(H, H^-1, 인라이어)를 보관하는 LRU/TTL 캐시.
+ * 같은 포인트 집합을 다시 보내면(예: 포인트를 껐다 다시 켬) 왜곡 보정과 RANSAC 없이 결과를 돌려줍니다.
+ * ==================================== */
+
+#include "Calibrator.h"
+#include "HomographyEstimator.h" // HomographySolverPath
+#include "HomographyMetrics.h"   // LeaveOneOut
+
+// OpenCV Core Types
+#include <opencv2/core/types.hpp> // cv::Matx33d, cv::Point2f
+
+// STL
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    /**
+     * @brief 서베이 포인트 한 쌍 (왜곡된 카메라 픽셀 좌표, 지상 좌표).
+     */
+    struct SurveyPair
+    {
+        cv::Point2f camera; /**< 왜곡된 카메라 픽셀 좌표 (보정 전) */
+        cv::Point2f ground; /**< 지상 좌표 */
+    };
+
+    /**
+     * @brief calculate_dynamic 결과 캐시.
+     * 키는 요청 내용 자체(정규화된 바이트열)이며, 해시 충돌에 대비해 적중 시 전체 바이트열을 비교합니다.
+     * 항목 수와 메모리 사용량 두 한도를 넘으면 가장 오래 쓰이지 않은 항목부터 제거하고,
+     * TTL이 지난 항목은 조회 시 제거합니다. 여러 스레드에서 동시에 호출할 수 있습니다.
+     */
+    class ResultCache
+    {
+    public:
+        /**
+         * @brief 캐시된 계산 결과 (저장 후 불변).
+         */
+        struct Result
+        {
+            cv::Matx33d homography;                        /**< 보정된 픽셀 -> 지상 좌표 */
+            cv::Matx33d inverse_homography;                /**< 지상 좌표 -> 보정된 픽셀 (invertible일 때만 유효) */
+            bool        invertible = false;                /**< H의 역행렬 존재 여부 */
+            std::vector<cv::Point2f> inlier_image_points;  /**< RANSAC 인라이어 (보정된 픽셀 좌표) */
+            std::vector<cv::Point2f> inlier_ground_points; /**< RANSAC 인라이어 (지상 좌표) */
+            size_t      points_used = 0;                   /**< 호모그래피 추정에 입력된 포인트 쌍 개수 */
+            std::vector<unsigned char> inlier_mask;        /**< 정렬된 서베이 포인트 순서의 인라이어 여부 (보정 실패 포인트는 0) */
+            int         iterations = 0;                    /**< 추정기가 수행한 반복 횟수 (측정할 수 없으면 ITERATIONS_NOT_MEASURED) */
+            HomographySolverPath solver_path = HomographySolverPath::Robust; /**< 실제로 사용된 풀이 경로 */
+            std::vector<float> forward_errors;             /**< 정렬 순서의 |H*x - x'| (지상 좌표 단위, 보정 실패 포인트는 NaN) */
+            std::vector<float> backward_errors;            /**< 정렬 순서의 |H^-1*x' - x| (보정된 픽셀 단위, 보정 실패 포인트는 NaN) */
+            std::vector<LeaveOneOut> leave_one_out;        /**< 정렬 순서의 leave-one-out 진단 (요청하지 않았거나 계산하지 못하면 비어 있음) */
+            double      leave_one_out_reference_rms = 0.0; /**< leave-one-out 기준인 인라이어 전체 DLT 해의 RMS */
+            size_t      leave_one_out_points = 0;          /**< leave-one-out에 사용한 포인트 수 (반환한 모델의 인라이어 수) */
+        };
+
+        /**
+         * @brief 캐시 통계 스냅샷.
+         */
+        struct Stats
+        {
+            uint64_t hits        = 0;
+            uint64_t misses      = 0;
+            uint64_t expirations = 0; /**< TTL이 지나 제거된 항목 수 */
+            uint64_t evictions   = 0; /**< 항목 수/메모리 한도로 제거된 항목 수 */
+            size_t   size        = 0;
+            size_t   capacity    = 0;
+            size_t   bytes       = 0; /**< 현재 항목들의 추정 메모리 사용량 */
+            size_t   max_bytes   = 0;
+
+            double hitRatio( void ) const { return ( hits + misses ) > 0 ? static_cast<double>( hits ) / static_cast<double>( hits + misses ) : 0.0; }
+        };
+
+        /** 기본 한도 */
+        static constexpr size_t DEFAULT_CAPACITY  = 256;
+        static constexpr size_t DEFAULT_MAX_BYTES = 16u << 20; // 16MB
+        static constexpr std::chrono::seconds DEFAULT_TTL { 600 };
+
+        /**
+         * @param capacity  최대 항목 수 (0은 1로 취급).
+         * @param max_bytes 최대 메모리 사용량 (바이트, 추정치).
+         * @param ttl       항목 유효 시간.
+         */
+        explicit ResultCache( size_t capacity = DEFAULT_CAPACITY, size_t max_bytes = DEFAULT_MAX_BYTES,
+                              std::chrono::seconds ttl = DEFAULT_TTL );
+
+        ResultCache( const ResultCache& ) = delete;
+        ResultCache& operator=( const ResultCache& ) = delete;
+
+        /**
+         * @brief 서베이 포인트를 정규 순서로 정렬합니다. (카메라 x, y, 지상 x, y 순의 사전식)
+         * 같은 포인트 집합은 입력 순서와 관계없이 같은 순서가 되므로, 정렬된 순서로 계산하면
+         * 캐시 적중 결과와 새로 계산한 결과가 항상 같습니다.
+         */
+        static void Canonicalize( std::vector<SurveyPair>& pairs );
+
+        /**
+         * @brief Canonicalize와 같이 정렬하고, 정렬 후 k번째 포인트의 원래 인덱스를 order[k]에 돌려줍니다.
+         * (정렬된 순서의 결과를 요청 순서로 되돌릴 때 사용)
+         */
+        static void Canonicalize( std::vector<SurveyPair>& pairs, std::vector<size_t>& order );
+
+        /**
+         * @brief 정규화된 요청의 키 바이트열을 만듭니다.
+         * 파라미터(-0.0은 0.0으로), 옵션, 정렬된 포인트 좌표를 그대로 이어 붙입니다.
+         * 좌표는 계산에 쓰이는 float 정밀도로 양자화되므로 표기만 다른 요청(1e2 / 100.0)도 같은 키가 됩니다.
+         */
+        static std::string MakeKey( const CalibratorParams& params, const CalibratorOptions& options,
+                                    const std::vector<SurveyPair>& sorted_pairs );
+
+        /**
+         * @brief 결과를 찾습니다. 적중하면 가장 최근 사용으로 옮깁니다.
+         * @return 결과. 없거나 TTL이 지났으면 nullptr.
+         */
+        std::shared_ptr<const Result> Find( const std::string& key );
+
+        /**
+         * @brief 결과를 저장합니다. 같은 키가 있으면 교체하고 TTL을 다시 시작합니다.
+         */
+        void Insert( const std::string& key, std::shared_ptr<const Result> result );
+
+        /** 모든 항목 제거 (통계는 유지) */
+        void clear( void );
+
+        // Getter
+        Stats getStats( void ) const;
+
+    private:
+        struct Entry
+        {
+            uint64_t hash;
+            std::string key;
+            std::shared_ptr<const Result> result;
+            size_t bytes;
+            std::chrono::steady_clock::time_point expires_at;
+        };
+
+        // 항목 제거 (lock 보유 상태에서 호출)
+        void EraseLocked( std::list<Entry>::iterator it );
+
+        static size_t EstimateBytes( const std::string& key, const Result& result ) noexcept;
+
+        const size_t max_entries;
+        const size_t max_bytes;
+        const std::chrono::steady_clock::duration ttl;
+
+        std::list<Entry> order; // front = most recently used
+        std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+        size_t total_bytes = 0;
+        mutable std::mutex lock;
+
+        std::atomic<uint64_t> hits        { 0 };
+        std::atomic<uint64_t> misses      { 0 };
+        std::atomic<uint64_t> expirations { 0 };
+        std::atomic<uint64_t> evictions   { 0 };
+    }; // cls::ResultCache
+
+} // nsp::MGEN::MVEM
+
+#endif // _MGEN_MVEM_RESULT_CACHE_H_
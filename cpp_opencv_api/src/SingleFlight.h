@@ -0,0 +1,104 @@
+#ifndef __MGEN_SINGLE_FLIGHT_H__
+#define __MGEN_SINGLE_FLIGHT_H__
+
+/** -------------------------------------------------------
+ *  MgenSolution's In-flight Call Coalescer (singleflight)
+ * --------------------------------------------------------
+ *  Desc : 같은 키로 동시에 들어온 호출 중 첫 번째(리더)만
+ *         실제로 계산하고, 나머지는 리더의 결과를 같은
+ *         shared_future로 기다렸다가 그대로 받습니다.
+ *         계산이 끝나면 키는 곧바로 제거되므로 결과를
+ *         보관하지는 않습니다 (보관은 캐시의 몫).
+ *         리더가 던진 예외는 기다리던 호출에도 전달됩니다.
+ * -------------------------------------------------------- */
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace MGEN { // Mgensolution's default namespace
+
+    template <typename Key, typename Value, typename Hash = std::hash<Key>>
+    class SingleFlight
+    {
+    public:
+        // Statistics snapshot
+        struct Stats
+        {
+            uint64_t leaders   = 0; // calls that actually ran the function
+            uint64_t coalesced = 0; // calls that waited on a leader instead
+            size_t   in_flight = 0; // keys currently being computed
+        };
+
+        SingleFlight() = default;
+
+        SingleFlight( const SingleFlight& ) = delete;
+        SingleFlight& operator=( const SingleFlight& ) = delete;
+
+        // Runs fn() once per key among concurrent callers; everyone gets the leader's value.
+        // *coalesced is set to true when this call waited on another caller's result.
+        template <typename Fn>
+        Value Do( const Key& key, Fn&& fn, bool* coalesced = nullptr )
+        {
+            std::shared_future<Value> future;
+            std::unique_ptr<std::promise<Value>> promise;
+            {
+                std::lock_guard<std::mutex> guard( lock );
+                auto it = calls.find( key );
+                if( it != calls.end() ) {
+                    future = it->second;
+                } else {
+                    promise.reset( new std::promise<Value>() );
+                    future = promise->get_future().share();
+                    calls.emplace( key, future );
+                }
+            }
+
+            if( coalesced != nullptr ) {
+                *coalesced = ( promise == nullptr );
+            }
+            if( promise == nullptr ) {
+                waiters.fetch_add( 1, std::memory_order_relaxed );
+                return future.get();
+            }
+
+            leaders.fetch_add( 1, std::memory_order_relaxed );
+            try {
+                promise->set_value( fn() );
+            } catch( ... ) {
+                promise->set_exception( std::current_exception() );
+            }
+            {
+                std::lock_guard<std::mutex> guard( lock );
+                calls.erase( key );
+            }
+            return future.get();
+        }
+
+        // Getter
+        Stats stats( void ) const
+        {
+            std::lock_guard<std::mutex> guard( lock );
+            Stats s;
+            s.leaders   = leaders.load( std::memory_order_relaxed );
+            s.coalesced = waiters.load( std::memory_order_relaxed );
+            s.in_flight = calls.size();
+            return s;
+        }
+
+    private:
+        std::unordered_map<Key, std::shared_future<Value>, Hash> calls;
+        mutable std::mutex lock;
+
+        std::atomic<uint64_t> leaders { 0 };
+        std::atomic<uint64_t> waiters { 0 };
+    }; // cls:SingleFlight
+
+}; // namespace MGEN
+#endif
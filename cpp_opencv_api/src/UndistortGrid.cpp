@@ -0,0 +1,316 @@
+#include "UndistortGrid.h"
+#include "MgenLogger.h"
+
+// POSIX (mmap)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// STL::C++
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+#include <experimental/filesystem>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    // use filesystem library
+    namespace fs = std::experimental::filesystem;
+
+    // 격자 파일 헤더 (리틀 엔디안, 고정 크기). 헤더 바로 뒤에 float (dx, dy) 격자점 배열이 이어집니다.
+    struct GridFileHeader
+    {
+        char     magic[8];      // "MVEMUDG\0"
+        uint32_t version;       // UndistortGrid::FILE_VERSION
+        uint32_t header_size;   // sizeof(GridFileHeader)
+        uint64_t params_hash;   // 파라미터 + 옵션 키 (Calibrator::PrepareGrid)
+        int32_t  width;
+        int32_t  height;
+        int32_t  cell;
+        int32_t  cols;
+        int32_t  rows;
+        int32_t  reserved;
+        double   max_error_px;
+        uint64_t payload_bytes; // 격자점 배열 크기 (바이트)
+    };
+    constexpr char GRID_FILE_MAGIC[8] = { 'M', 'V', 'E', 'M', 'U', 'D', 'G', '\0' };
+
+    UndistortGrid::~UndistortGrid()
+    {
+        if( mapped_base != nullptr ) {
+            ::munmap( mapped_base, mapped_size );
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: WithinLimits
+    // 설명: 크기/간격이 양수이고 한도 안이며, 격자점 수가 MAX_NODES 이하인지 확인합니다.
+    //--------------------------------------------------------------------------
+    bool UndistortGrid::WithinLimits( int width, int height, int cell ) noexcept
+    {
+        if( width <= 0 || height <= 0 || cell <= 0
+            || width > MAX_DIMENSION || height > MAX_DIMENSION || cell > MAX_CELL ) {
+            return false;
+        }
+        const size_t cols = static_cast<size_t>( ( width  + cell - 1 ) / cell );
+        const size_t rows = static_cast<size_t>( ( height + cell - 1 ) / cell );
+        return ( cols + 1 ) * ( rows + 1 ) <= MAX_NODES;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Build
+    // 설명: 격자점 좌표를 SoA 버퍼로 만들어 배치 반복 풀이로 한 번에 보정한 뒤,
+    //       셀 중심에서의 보간 오차를 정확한 풀이와 비교하여 최대값을 기록합니다.
+    //--------------------------------------------------------------------------
+    std::shared_ptr<const UndistortGrid> UndistortGrid::Build( const Calibrator& exact, uint64_t params_hash,
+                                                               int width, int height, int cell,
+                                                               const cv::Point2f& err_threshold )
+    {
+        if( exact.isValid() == false || WithinLimits( width, height, cell ) == false ) {
+            MLOG_WARN("UndistortGrid::Build: invalid input (valid: %d, size: %dx%d, cell: %d).", exact.isValid(), width, height, cell);
+            return nullptr;
+        }
+
+        std::shared_ptr<UndistortGrid> grid( new UndistortGrid() );
+        grid->params_hash = params_hash;
+        grid->width       = width;
+        grid->height      = height;
+        grid->cell        = cell;
+        grid->cols        = ( width  + cell - 1 ) / cell;
+        grid->rows        = ( height + cell - 1 ) / cell;
+        grid->inv_cell    = 1.0f / static_cast<float>( cell );
+        grid->node_count  = static_cast<size_t>( grid->cols + 1 ) * static_cast<size_t>( grid->rows + 1 );
+
+        // 1. 격자점 좌표 생성 (SoA)
+        const size_t n = grid->node_count;
+        std::vector<float> src_x( n ), src_y( n ), dst_x( n ), dst_y( n );
+        std::vector<uint64_t> mask( Calibrator::MaskWords( n ) );
+        for( int j = 0; j <= grid->rows; ++j ) {
+            for( int i = 0; i <= grid->cols; ++i ) {
+                const size_t idx = static_cast<size_t>( j ) * ( grid->cols + 1 ) + i;
+                src_x[ idx ] = static_cast<float>( i * cell );
+                src_y[ idx ] = static_cast<float>( j * cell );
+            }
+        }
+
+        // 2. 배치 반복 풀이로 격자점 보정 후 변위 저장 (실패한 격자점은 NaN)
+        exact.CalibrateBatch( src_x.data(), src_y.data(), n, dst_x.data(), dst_y.data(), mask.data(), err_threshold );
+
+        grid->owned_nodes.reset( new float[ n * 2 ] );
+        constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+        size_t failed = 0;
+        for( size_t idx = 0; idx < n; ++idx ) {
+            const bool ok = ( mask[ idx >> 6 ] >> ( idx & 63 ) ) & 1u;
+            grid->owned_nodes[ idx * 2 + 0 ] = ok ? dst_x[ idx ] - src_x[ idx ] : NaN;
+            grid->owned_nodes[ idx * 2 + 1 ] = ok ? dst_y[ idx ] - src_y[ idx ] : NaN;
+            failed += ok ? 0 : 1;
+        }
+        grid->nodes = grid->owned_nodes.get();
+
+        // 3. 셀 중심에서 보간 오차 측정
+        const size_t cells = static_cast<size_t>( grid->cols ) * static_cast<size_t>( grid->rows );
+        std::vector<float> cx( cells ), cy( cells ), ex( cells ), ey( cells );
+        std::vector<uint64_t> cmask( Calibrator::MaskWords( cells ) );
+        for( int j = 0; j < grid->rows; ++j ) {
+            for( int i = 0; i < grid->cols; ++i ) {
+                const size_t idx = static_cast<size_t>( j ) * grid->cols + i;
+                cx[ idx ] = ( static_cast<float>( i ) + 0.5f ) * cell;
+                cy[ idx ] = ( static_cast<float>( j ) + 0.5f ) * cell;
+            }
+        }
+        exact.CalibrateBatch( cx.data(), cy.data(), cells, ex.data(), ey.data(), cmask.data(), err_threshold );
+
+        double max_err = 0.0;
+        for( size_t idx = 0; idx < cells; ++idx ) {
+            cv::Point2f approx;
+            const bool ok = ( cmask[ idx >> 6 ] >> ( idx & 63 ) ) & 1u;
+            if( ok && grid->Lookup( cx[ idx ], cy[ idx ], approx ) ) {
+                max_err = std::max( max_err, static_cast<double>( std::hypot( approx.x - ex[ idx ], approx.y - ey[ idx ] ) ) );
+            }
+        }
+        grid->max_error_px = max_err;
+
+        MLOG_INFO("UndistortGrid built: %dx%d, cell %d, %zu nodes (%zu failed), max interpolation error %.6f px.",
+                  width, height, cell, n, failed, max_err);
+        return grid;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Load
+    // 설명: 격자 파일을 읽기 전용으로 mmap한 뒤 헤더를 검증합니다.
+    //       격자점 배열은 복사하지 않고 매핑된 영역을 그대로 사용합니다.
+    //--------------------------------------------------------------------------
+    std::shared_ptr<const UndistortGrid> UndistortGrid::Load( const std::string& path, uint64_t params_hash,
+                                                              int width, int height, int cell )
+    {
+        const int fd = ::open( path.c_str(), O_RDONLY );
+        if( fd < 0 ) {
+            return nullptr; // 파일 없음: 호출 측에서 새로 생성
+        }
+
+        struct stat st {};
+        if( ::fstat( fd, &st ) != 0 || static_cast<size_t>( st.st_size ) < sizeof( GridFileHeader ) ) {
+            MLOG_WARN("UndistortGrid::Load: '%s' is too small or unreadable.", path.c_str());
+            ::close( fd );
+            return nullptr;
+        }
+
+        const size_t size = static_cast<size_t>( st.st_size );
+        void* base = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        ::close( fd ); // 매핑은 fd를 닫아도 유지됨
+        if( base == MAP_FAILED ) {
+            MLOG_WARN("UndistortGrid::Load: mmap failed for '%s'.", path.c_str());
+            return nullptr;
+        }
+
+        std::shared_ptr<UndistortGrid> grid( new UndistortGrid() );
+        grid->mapped_base = base; // 이후 실패 시 소멸자가 munmap
+        grid->mapped_size = size;
+
+        GridFileHeader hdr {};
+        std::memcpy( &hdr, base, sizeof( hdr ) );
+
+        const int    cols     = ( width  + std::max( cell, 1 ) - 1 ) / std::max( cell, 1 );
+        const int    rows     = ( height + std::max( cell, 1 ) - 1 ) / std::max( cell, 1 );
+        const size_t expected = static_cast<size_t>( cols + 1 ) * static_cast<size_t>( rows + 1 ) * 2 * sizeof( float );
+        if( std::memcmp( hdr.magic, GRID_FILE_MAGIC, sizeof( GRID_FILE_MAGIC ) ) != 0
+            || hdr.version != FILE_VERSION || hdr.header_size != sizeof( GridFileHeader )
+            || hdr.params_hash != params_hash || hdr.width != width || hdr.height != height || hdr.cell != cell
+            || hdr.cols != cols || hdr.rows != rows || hdr.payload_bytes != expected
+            || size != sizeof( GridFileHeader ) + expected ) {
+            MLOG_WARN("UndistortGrid::Load: '%s' does not match the current parameters or version. Ignoring.", path.c_str());
+            return nullptr;
+        }
+
+        grid->params_hash  = params_hash;
+        grid->width        = width;
+        grid->height       = height;
+        grid->cell         = cell;
+        grid->cols         = cols;
+        grid->rows         = rows;
+        grid->inv_cell     = 1.0f / static_cast<float>( cell );
+        grid->max_error_px = hdr.max_error_px;
+        grid->node_count   = static_cast<size_t>( cols + 1 ) * static_cast<size_t>( rows + 1 );
+        grid->nodes        = reinterpret_cast<const float*>( static_cast<const char*>( base ) + sizeof( GridFileHeader ) );
+
+        MLOG_INFO("UndistortGrid loaded from '%s' (mmap, %zu bytes, max interpolation error %.6f px).", path.c_str(), size, grid->max_error_px);
+        return grid;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Save
+    // 설명: 헤더와 격자점 배열을 임시 파일에 쓴 뒤 rename으로 교체합니다.
+    //--------------------------------------------------------------------------
+    bool UndistortGrid::Save( const std::string& path ) const
+    {
+        try {
+            const fs::path parent = fs::path( path ).parent_path();
+            if( !parent.empty() && !fs::exists( parent ) ) {
+                fs::create_directories( parent );
+            }
+        } catch( const std::exception& e ) {
+            MLOG_WARN("UndistortGrid::Save: cannot create directory for '%s': %s", path.c_str(), e.what());
+            return false;
+        }
+
+        GridFileHeader hdr {};
+        std::memcpy( hdr.magic, GRID_FILE_MAGIC, sizeof( GRID_FILE_MAGIC ) );
+        hdr.version       = FILE_VERSION;
+        hdr.header_size   = sizeof( GridFileHeader );
+        hdr.params_hash   = params_hash;
+        hdr.width         = width;
+        hdr.height        = height;
+        hdr.cell          = cell;
+        hdr.cols          = cols;
+        hdr.rows          = rows;
+        hdr.max_error_px  = max_error_px;
+        hdr.payload_bytes = getMemoryBytes();
+
+        const std::string tmp_path = path + ".tmp." + std::to_string( ::getpid() );
+        {
+            std::ofstream ofs( tmp_path, std::ios::binary | std::ios::trunc );
+            if( !ofs ) {
+                MLOG_WARN("UndistortGrid::Save: cannot open '%s' for writing.", tmp_path.c_str());
+                return false;
+            }
+            ofs.write( reinterpret_cast<const char*>( &hdr ), sizeof( hdr ) );
+            ofs.write( reinterpret_cast<const char*>( nodes ), static_cast<std::streamsize>( hdr.payload_bytes ) );
+            if( !ofs ) {
+                MLOG_WARN("UndistortGrid::Save: write failed for '%s'.", tmp_path.c_str());
+                ::unlink( tmp_path.c_str() );
+                return false;
+            }
+        }
+        if( ::rename( tmp_path.c_str(), path.c_str() ) != 0 ) {
+            MLOG_WARN("UndistortGrid::Save: rename to '%s' failed.", path.c_str());
+            ::unlink( tmp_path.c_str() );
+            return false;
+        }
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: FilePath
+    // 설명: <cache_dir>/undistort_grid_<hash>_<w>x<h>_c<cell>.bin
+    //--------------------------------------------------------------------------
+    std::string UndistortGrid::FilePath( const std::string& cache_dir, uint64_t params_hash, int width, int height, int cell )
+    {
+        char name[ 96 ];
+        std::snprintf( name, sizeof( name ), "undistort_grid_%016" PRIx64 "_%dx%d_c%d.bin", params_hash, width, height, cell );
+        return ( fs::path( cache_dir.empty() ? "." : cache_dir ) / name ).string();
+    }
+
+    //--------------------------------------------------------------------------
+    // 함수: Lookup
+    // 설명: 포인트가 속한 셀의 네 격자점 변위를 쌍선형 보간하여 더합니다.
+    //--------------------------------------------------------------------------
+    bool UndistortGrid::Lookup( float x, float y, cv::Point2f& out ) const noexcept
+    {
+        const float gx = x * inv_cell;
+        const float gy = y * inv_cell;
+        if( !( gx >= 0.0f ) || !( gy >= 0.0f ) ) { // NaN 입력도 함께 거름
+            return false;
+        }
+
+        int ix = static_cast<int>( gx );
+        int iy = static_cast<int>( gy );
+        if( ix > cols || iy > rows ) {
+            return false;
+        }
+        // 오른쪽/아래쪽 경계 위의 점은 마지막 셀로 처리
+        ix = std::min( ix, cols - 1 );
+        iy = std::min( iy, rows - 1 );
+        const float tx = gx - static_cast<float>( ix );
+        const float ty = gy - static_cast<float>( iy );
+        if( tx > 1.0f || ty > 1.0f ) {
+            return false;
+        }
+
+        const size_t stride = static_cast<size_t>( cols + 1 );
+        const float* n00 = nodes + ( static_cast<size_t>( iy ) * stride + ix ) * 2;
+        const float* n10 = n00 + 2;
+        const float* n01 = n00 + stride * 2;
+        const float* n11 = n01 + 2;
+
+        const float w00 = ( 1.0f - tx ) * ( 1.0f - ty );
+        const float w10 = tx * ( 1.0f - ty );
+        const float w01 = ( 1.0f - tx ) * ty;
+        const float w11 = tx * ty;
+
+        const float dx = w00 * n00[0] + w10 * n10[0] + w01 * n01[0] + w11 * n11[0];
+        const float dy = w00 * n00[1] + w10 * n10[1] + w01 * n01[1] + w11 * n11[1];
+        if( std::isnan( dx ) || std::isnan( dy ) ) { // 보정 실패 격자점이 섞인 셀
+            return false;
+        }
+
+        out.x = x + dx;
+        out.y = y + dy;
+        return true;
+    }
+
+} // nsp::MGEN::MVEM
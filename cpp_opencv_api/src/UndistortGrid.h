@@ -0,0 +1,133 @@
+#ifndef _MGEN_MVEM_UNDISTORT_GRID_H_
+#define _MGEN_MVEM_UNDISTORT_GRID_H_
+
+/* ====================================
+ * Undistortion Lookup Grid Class Header
+ * ------------------------------------
+ * Desc   : 왜곡된 픽셀 격자점마다 보정 결과(변위)를 미리 계산해 두고,
+ * 임의의 포인트는 주변 4개 격자점의 쌍선형 보간(bilinear)으로 O(1)에 보정합니다.
+ * 격자는 버전이 있는 바이너리 파일로 저장되며, 이후 실행 시 mmap으로 바로 읽어 사용합니다.
+ * ==================================== */
+
+#include "Calibrator.h"
+
+// OpenCV Core Types
+#include <opencv2/core/types.hpp> // cv::Point2f
+
+// STL
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace MGEN::MVEM // Multi-View Event Mapper
+{
+    /**
+     * @brief 왜곡 보정 격자(lookup grid).
+     * 격자점 (i * cell, j * cell) 에서의 보정 변위 (undistorted - distorted)를 float로 저장합니다.
+     * 보정에 실패한(수렴하지 않은) 격자점은 NaN으로 표시되며, 해당 셀의 조회는 실패합니다.
+     * 생성 후 불변이므로 여러 스레드에서 동시에 조회할 수 있습니다.
+     */
+    class UndistortGrid
+    {
+    public:
+        /** 바이너리 파일 포맷 버전 (헤더 구조가 바뀌면 증가) */
+        static constexpr uint32_t FILE_VERSION = 2;
+
+        /** 격자점/셀 중심을 정확히 풀 때 사용하는 반복 종료 임계값 (픽셀, x/y 각각). 바꾸면 FILE_VERSION을 올려야 함 */
+        static constexpr float BUILD_ERR_THRESHOLD = 1e-7f;
+
+        /** 격자 크기 한도: 한 변의 최대 픽셀 수, 최대 격자 간격, 최대 격자점 수 (약 32MB) */
+        static constexpr int    MAX_DIMENSION = 32768;
+        static constexpr int    MAX_CELL      = 256;
+        static constexpr size_t MAX_NODES     = size_t( 1 ) << 22;
+
+        /**
+         * @brief 격자 크기가 한도 안인지 확인합니다. (Build/PrepareGrid에서 할당 전에 검사)
+         */
+        static bool WithinLimits( int width, int height, int cell ) noexcept;
+
+        UndistortGrid( const UndistortGrid& ) = delete;
+        UndistortGrid& operator=( const UndistortGrid& ) = delete;
+        ~UndistortGrid();
+
+        /**
+         * @brief 정확한 반복 풀이(exact)로 격자점을 계산하여 격자를 생성합니다.
+         * 생성 후 각 셀 중심에서 보간값과 정확한 풀이를 비교하여 최대 보간 오차를 측정합니다.
+         * @param exact       격자 없이 반복 풀이를 수행하는 Calibrator (유효해야 함).
+         * @param params_hash 파일 키 (파라미터 + 결과에 영향을 주는 옵션, Calibrator::PrepareGrid 참고).
+         * @param err_threshold 격자점/셀 중심 반복 풀이의 종료 임계값 (보통 BUILD_ERR_THRESHOLD).
+         * @param width       격자가 덮을 이미지 너비 (픽셀).
+         * @param height      격자가 덮을 이미지 높이 (픽셀).
+         * @param cell        격자 간격 (픽셀, 1 이상).
+         * @return 생성된 격자. 입력이 잘못되거나 WithinLimits를 넘으면 nullptr.
+         */
+        static std::shared_ptr<const UndistortGrid> Build( const Calibrator& exact, uint64_t params_hash,
+                                                           int width, int height, int cell,
+                                                           const cv::Point2f& err_threshold );
+
+        /**
+         * @brief 저장된 격자 파일을 mmap으로 읽어옵니다.
+         * 헤더의 매직/버전/파라미터 해시/크기가 모두 일치해야 하며, 그렇지 않으면 nullptr을 반환합니다.
+         */
+        static std::shared_ptr<const UndistortGrid> Load( const std::string& path, uint64_t params_hash,
+                                                          int width, int height, int cell );
+
+        /**
+         * @brief 격자를 파일로 저장합니다. 임시 파일에 쓴 뒤 rename하므로 동시 실행에도 안전합니다.
+         * @return 저장 성공 여부.
+         */
+        bool Save( const std::string& path ) const;
+
+        /**
+         * @brief 캐시 디렉토리와 키로부터 격자 파일 경로를 만듭니다.
+         */
+        static std::string FilePath( const std::string& cache_dir, uint64_t params_hash, int width, int height, int cell );
+
+        /**
+         * @brief 왜곡된 픽셀 좌표를 쌍선형 보간으로 보정합니다.
+         * 결과 오차는 최대 getMaxErrorPx()이므로, 호출자의 허용 오차가 그보다 작으면 사용하지 않아야 합니다. (Accepts)
+         * @param x, y 왜곡된 픽셀 좌표.
+         * @param out  보정된 픽셀 좌표 (성공 시에만 기록).
+         * @return 격자 범위 안이고 주변 격자점이 모두 유효하면 true.
+         */
+        bool Lookup( float x, float y, cv::Point2f& out ) const noexcept;
+
+        int      getWidth()       const noexcept { return width; }
+        int      getHeight()      const noexcept { return height; }
+        int      getCell()        const noexcept { return cell; }
+        double   getMaxErrorPx()  const noexcept { return max_error_px; } /**< 셀 중심 기준 최대 보간 오차 (픽셀) */
+        /** 최대 보간 오차가 허용 오차(x, y 각각) 이하인지 여부. 아니면 호출 측은 반복 풀이를 사용 */
+        bool     Accepts( const cv::Point2f& err_threshold ) const noexcept
+        {
+            return max_error_px <= static_cast<double>( std::min( err_threshold.x, err_threshold.y ) );
+        }
+        bool     isMapped()       const noexcept { return mapped_base != nullptr; } /**< 파일에서 mmap으로 읽었는지 여부 */
+        size_t   getMemoryBytes() const noexcept { return node_count * 2 * sizeof( float ); }
+
+    private:
+        UndistortGrid() = default;
+
+        // 격자 정보
+        uint64_t params_hash  = 0;
+        int      width        = 0;
+        int      height       = 0;
+        int      cell         = 1;
+        int      cols         = 0; // 가로 셀 개수 (격자점은 cols + 1 개)
+        int      rows         = 0; // 세로 셀 개수 (격자점은 rows + 1 개)
+        double   max_error_px = 0.0;
+        float    inv_cell     = 1.0f;
+
+        // 격자점 변위 (dx, dy) 배열. owned_nodes 또는 mmap 영역을 가리킴
+        const float* nodes      = nullptr;
+        size_t       node_count = 0;
+        std::unique_ptr<float[]> owned_nodes;
+
+        // mmap 영역 (파일에서 읽은 경우)
+        void*  mapped_base = nullptr;
+        size_t mapped_size = 0;
+    }; // cls::UndistortGrid
+
+} // nsp::MGEN::MVEM
+
+#endif // _MGEN_MVEM_UNDISTORT_GRID_H_
@@ -0,0 +1,159 @@
+#include "WorkerPool.h"
+#include "MgenLogger.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace MGEN { // Mgensolution's default namespace
+
+    // One ParallelFor call
+    struct WorkerPool::Job
+    {
+        const RangeFn* fn     = nullptr;
+        size_t         count  = 0;
+        size_t         grain  = 1;
+        size_t         chunks = 0;
+
+        std::atomic<size_t> next { 0 }; // next chunk index to claim
+        std::atomic<size_t> done { 0 }; // finished chunk count
+
+        std::mutex              done_lock;
+        std::condition_variable done_cv;
+    };
+
+    namespace {
+        std::mutex  shared_lock;
+        size_t      shared_threads = 0; // 0 = DefaultThreads()
+        WorkerPool* shared_pool    = nullptr;
+    }
+
+    WorkerPool::WorkerPool( size_t threads )
+    {
+        workers.reserve( threads );
+        for( size_t i = 0; i < threads; ++i ) {
+            workers.emplace_back( &WorkerPool::WorkerLoop, this );
+        }
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> guard( lock );
+            stopping = true;
+        }
+        wake.notify_all();
+        for( auto& t : workers ) {
+            t.join();
+        }
+    }
+
+    size_t WorkerPool::DefaultThreads( void )
+    {
+        const size_t hw = std::thread::hardware_concurrency();
+        return std::max<size_t>( 1, hw / 2 );
+    }
+
+    bool WorkerPool::ConfigureShared( size_t threads )
+    {
+        std::lock_guard<std::mutex> guard( shared_lock );
+        if( shared_pool != nullptr ) {
+            return false;
+        }
+        shared_threads = threads;
+        return true;
+    }
+
+    WorkerPool& WorkerPool::Shared( void )
+    {
+        std::lock_guard<std::mutex> guard( shared_lock );
+        if( shared_pool == nullptr ) {
+            const size_t threads = shared_threads > 0 ? shared_threads : DefaultThreads();
+            // Intentionally leaked: worker threads must outlive every static user at exit
+            shared_pool = new WorkerPool( threads );
+            MLOG_INFO("WorkerPool: shared pool started with %zu thread(s).", threads);
+        }
+        return *shared_pool;
+    }
+
+    void WorkerPool::RunChunks( Job& job )
+    {
+        for( ;; ) {
+            const size_t c = job.next.fetch_add( 1, std::memory_order_relaxed );
+            if( c >= job.chunks ) {
+                return;
+            }
+            const size_t begin = c * job.grain;
+            const size_t end   = std::min( job.count, begin + job.grain );
+            ( *job.fn )( begin, end );
+
+            if( job.done.fetch_add( 1, std::memory_order_acq_rel ) + 1 == job.chunks ) {
+                std::lock_guard<std::mutex> guard( job.done_lock );
+                job.done_cv.notify_all();
+            }
+        }
+    }
+
+    void WorkerPool::WorkerLoop( void )
+    {
+        for( ;; ) {
+            std::shared_ptr<Job> job;
+            {
+                std::unique_lock<std::mutex> guard( lock );
+                wake.wait( guard, [ this ] { return stopping || queue.empty() == false; } );
+                if( stopping && queue.empty() ) {
+                    return;
+                }
+                job = queue.front();
+                // Every chunk of the front job is claimed: move on to the next job
+                if( job->next.load( std::memory_order_relaxed ) >= job->chunks ) {
+                    queue.pop_front();
+                    continue;
+                }
+            }
+            RunChunks( *job );
+        }
+    }
+
+    void WorkerPool::ParallelFor( size_t count, size_t grain, const RangeFn& fn )
+    {
+        if( count == 0 ) {
+            return;
+        }
+        grain = std::max<size_t>( 1, grain );
+        const size_t chunks = ( count + grain - 1 ) / grain;
+
+        // Single chunk or no worker: run inline
+        if( chunks == 1 || workers.empty() ) {
+            for( size_t begin = 0; begin < count; begin += grain ) {
+                fn( begin, std::min( count, begin + grain ) );
+            }
+            return;
+        }
+
+        auto job    = std::make_shared<Job>();
+        job->fn     = &fn;
+        job->count  = count;
+        job->grain  = grain;
+        job->chunks = chunks;
+        {
+            std::lock_guard<std::mutex> guard( lock );
+            queue.push_back( job );
+        }
+        wake.notify_all();
+
+        // The caller helps with its own job, then waits for chunks still running on workers
+        RunChunks( *job );
+        {
+            std::unique_lock<std::mutex> guard( job->done_lock );
+            job->done_cv.wait( guard, [ &job ] { return job->done.load( std::memory_order_acquire ) == job->chunks; } );
+        }
+        {
+            std::lock_guard<std::mutex> guard( lock );
+            auto it = std::find( queue.begin(), queue.end(), job );
+            if( it != queue.end() ) {
+                queue.erase( it );
+            }
+        }
+    }
+
+}; // namespace MGEN
@@ -0,0 +1,73 @@
+#ifndef __MGEN_WORKER_POOL_H__
+#define __MGEN_WORKER_POOL_H__
+
+/** -------------------------------------------------------
+ *  MgenSolution's Reusable Worker Pool
+ * --------------------------------------------------------
+ *  Desc : 고정 개수의 작업 스레드를 재사용하는 병렬 실행기.
+ *         ParallelFor는 [0, count) 범위를 grain 단위 청크로
+ *         나누어 작업 스레드와 호출 스레드가 함께 처리하며,
+ *         모든 청크가 끝날 때까지 반환하지 않습니다.
+ *         여러 스레드가 동시에 ParallelFor를 호출해도 되며,
+ *         각 작업은 제출 순서대로 처리됩니다.
+ *         프로세스 공용 풀(Shared)의 스레드 수는 첫 사용 전에
+ *         ConfigureShared로 제한할 수 있습니다.
+ * -------------------------------------------------------- */
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MGEN { // Mgensolution's default namespace
+
+    class WorkerPool
+    {
+    public:
+        // Chunk body: processes [begin, end). Must not throw.
+        using RangeFn = std::function<void( size_t begin, size_t end )>;
+
+        // Constructor (threads 0 = no worker thread, the caller runs every chunk)
+        explicit WorkerPool( size_t threads );
+        ~WorkerPool();
+
+        WorkerPool( const WorkerPool& ) = delete;
+        WorkerPool& operator=( const WorkerPool& ) = delete;
+
+        // Run fn over [0, count) in chunks of `grain` items and wait for completion.
+        // Chunk boundaries are multiples of grain, so results can be written to disjoint slots
+        // and the output is identical regardless of thread count or scheduling.
+        void ParallelFor( size_t count, size_t grain, const RangeFn& fn );
+
+        // Getter
+        size_t size( void ) const { return workers.size(); }
+
+        // Process-wide pool, created on first use
+        static WorkerPool& Shared( void );
+
+        // Set the thread count of the shared pool (0 = default). Has no effect after the first Shared() call.
+        // Returns false if the shared pool already exists.
+        static bool ConfigureShared( size_t threads );
+
+        // Default thread count: half of the hardware threads (min 1), leaving the rest to the HTTP workers
+        static size_t DefaultThreads( void );
+
+    private:
+        struct Job;
+
+        void WorkerLoop( void );
+        static void RunChunks( Job& job );
+
+        std::vector<std::thread> workers;
+        std::deque<std::shared_ptr<Job>> queue; // front = job currently being helped
+        std::mutex lock;
+        std::condition_variable wake;
+        bool stopping = false;
+    }; // cls:WorkerPool
+
+}; // namespace MGEN
+#endif
@@ -3,6 +3,7 @@
 #include "RestApiServer.h"        // 우리가 정의한 API 서버 클래스
 #include "HomographyCalculator.h" // 호모그래피 계산 클래스
 #include "MgenLogger.h"           // 사용자 제공 로거
+#include "WorkerPool.h"           // 공용 워커 스레드 풀 (병렬 배치 연산)
 
 #include <iostream>               // 표준 입출력 (콘솔 로그 등)
 #include <csignal>                // POSIX 시그널 처리 (SIGINT, SIGTERM)
@@ -66,12 +67,44 @@ int main(int argc, char* argv[]) {
     signal(SIGINT, signalHandler);  // Ctrl+C 입력 시
     signal(SIGTERM, signalHandler); // 시스템 종료 요청 시 (e.g., kill command)
 
+    // 2-1. 병렬 배치 연산용 공용 워커 풀의 스레드 수 제한 (HTTP 워커 스레드가 밀리지 않도록)
+    // 환경 변수 MVEM_WORKER_THREADS로 지정하며, 없으면 하드웨어 스레드의 절반을 사용합니다.
+    if (const char* env_threads = std::getenv("MVEM_WORKER_THREADS")) {
+        try {
+            const int threads = std::stoi(env_threads);
+            if (threads > 0) {
+                MGEN::WorkerPool::ConfigureShared(static_cast<size_t>(threads));
+                MLOG_INFO("Worker pool limited to %d thread(s) by MVEM_WORKER_THREADS.", threads);
+            } else {
+                MLOG_WARN("Invalid MVEM_WORKER_THREADS '%s'. Using default (%zu).", env_threads, MGEN::WorkerPool::DefaultThreads());
+            }
+        } catch (const std::exception&) {
+            MLOG_WARN("Invalid MVEM_WORKER_THREADS '%s'. Using default (%zu).", env_threads, MGEN::WorkerPool::DefaultThreads());
+        }
+    }
+
+    // 2-2. (선택) 왜곡 보정 격자 파일 캐시 디렉토리 (서버 설정, 요청 JSON으로는 지정할 수 없음)
+    if (const char* grid_cache_dir = std::getenv("MVEM_GRID_CACHE_DIR")) {
+        MGEN::MVEM::Calibrator::ConfigureGridCacheDir(grid_cache_dir);
+        MLOG_INFO("Lookup grid cache directory: '%s'.", grid_cache_dir);
+    }
+
     try {
         // 3. HomographyCalculator 인스턴스 생성
         // 이 계산기는 HTTP 요청 처리 시 사용됩니다.
         auto homography_calc_ptr = std::make_shared<HomographyCalculator>();
         MLOG_INFO("HomographyCalculator instance created.");
 
+        // 3-1. (선택) 모델 레지스트리 스냅샷 복원
+        // 환경 변수 MVEM_MODEL_SNAPSHOT에 파일 경로를 지정하면, 재시작 전에 등록된 모델을 복원하고
+        // 이후 모델이 바뀔 때마다 같은 파일에 저장합니다. 서버가 요청을 받기 전에 복원이 끝납니다.
+        if (const char* snapshot_path = std::getenv("MVEM_MODEL_SNAPSHOT")) {
+            if (*snapshot_path != '\0') {
+                const size_t restored = homography_calc_ptr->restoreModels(snapshot_path);
+                MLOG_INFO("Model snapshot enabled at '%s' (%zu model(s) restored).", snapshot_path, restored);
+            }
+        }
+
         // 4. API 서버 리슨 포트 결정
         // 기본 포트는 RestApiServer.h에 정의된 CPP_API_INTERNAL_DEFAULT_PORT (3004)
         int server_listen_port = CPP_API_INTERNAL_DEFAULT_PORT;
@@ -0,0 +1,106 @@
+/* ====================================
+ * Calibrator Lookup Grid Threshold Test
+ * ------------------------------------
+ * Desc   : 왜곡 보정 격자를 켜도 호출자의 err_threshold가 지켜지는지 확인합니다.
+ * 격자의 최대 보간 오차보다 엄격한 임계값이면 격자 없는 반복 풀이와 같은 결과여야 하고,
+ * 느슨한 임계값이면 격자 보간 결과를 그대로 사용해야 합니다. 실패하면 0이 아닌 값을 반환합니다.
+ * ==================================== */
+
+#include "Calibrator.h"
+#include "UndistortGrid.h"
+#include "MgenLogger.h"
+
+// STL::C++
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace MGEN::MVEM;
+
+namespace
+{
+    const CalibratorParams PARAMS = { 800.0, 800.0, 960.0, 540.0, 0.0, -0.35, 0.12, -0.02, 0.001, -0.0005 };
+}
+
+int main()
+{
+    MGEN::initLogger();
+    int failures = 0;
+
+    CalibratorOptions iterative;
+    CalibratorOptions gridded;
+    gridded.grid.enable = true;
+    gridded.grid.cell   = 32; // 보간 오차가 확실히 보이도록 성기게
+    const Calibrator reference( PARAMS, iterative );
+    const Calibrator with_grid( PARAMS, gridded );
+    if( !with_grid.getGrid() ) {
+        std::printf( "FAIL: lookup grid was not built\n" );
+        return 1;
+    }
+    const double grid_error = with_grid.getGrid()->getMaxErrorPx();
+
+    std::vector<cv::Point2f> points;
+    for( float y = 20.0f; y < 1080.0f; y += 53.0f ) {
+        for( float x = 20.0f; x < 1920.0f; x += 61.0f ) {
+            points.push_back( { x, y } );
+        }
+    }
+
+    // 1. 엄격한 임계값: 격자를 쓰지 않고 반복 풀이와 같아야 함 (float 출력 반올림만 허용)
+    constexpr double SLACK_PX = 2e-4;
+    const cv::Point2f tight = { 1e-9f, 1e-9f };
+    double max_difference = 0.0;
+    for( const cv::Point2f& p : points ) {
+        const auto a = reference.Calibrate( p, tight );
+        const auto b = with_grid.Calibrate( p, tight );
+        if( a.has_value() != b.has_value() ) {
+            std::printf( "FAIL: convergence differs at (%.1f, %.1f)\n", p.x, p.y );
+            ++failures;
+            continue;
+        }
+        if( a ) {
+            max_difference = std::max( max_difference, static_cast<double>( std::hypot( a->x - b->x, a->y - b->y ) ) );
+        }
+    }
+
+    // 배치 경로도 같은 임계값을 따라야 함
+    std::vector<float> src_x, src_y;
+    for( const cv::Point2f& p : points ) {
+        src_x.push_back( p.x );
+        src_y.push_back( p.y );
+    }
+    std::vector<float> ref_x( points.size() ), ref_y( points.size() ), dst_x( points.size() ), dst_y( points.size() );
+    std::vector<uint64_t> ref_mask( Calibrator::MaskWords( points.size() ) ), mask( Calibrator::MaskWords( points.size() ) );
+    reference.CalibrateBatch( src_x.data(), src_y.data(), points.size(), ref_x.data(), ref_y.data(), ref_mask.data(), tight );
+    with_grid.CalibrateBatch( src_x.data(), src_y.data(), points.size(), dst_x.data(), dst_y.data(), mask.data(), tight );
+    for( size_t i = 0; i < points.size(); ++i ) {
+        if( ( ref_mask[ i >> 6 ] >> ( i & 63 ) ) & ( mask[ i >> 6 ] >> ( i & 63 ) ) & 1u ) {
+            max_difference = std::max( max_difference, static_cast<double>( std::hypot( ref_x[ i ] - dst_x[ i ], ref_y[ i ] - dst_y[ i ] ) ) );
+        }
+    }
+    if( max_difference > SLACK_PX ) {
+        std::printf( "FAIL: grid result used although err_threshold is tighter than the grid error\n" );
+        ++failures;
+    }
+
+    // 2. 느슨한 임계값: 격자 보간 결과를 그대로 사용
+    const float loose_value = static_cast<float>( grid_error ) + 1.0f;
+    const cv::Point2f loose = { loose_value, loose_value };
+    size_t grid_hits = 0;
+    for( const cv::Point2f& p : points ) {
+        cv::Point2f approx;
+        const auto b = with_grid.Calibrate( p, loose );
+        if( with_grid.getGrid()->Lookup( p.x, p.y, approx ) && b && b->x == approx.x && b->y == approx.y ) {
+            ++grid_hits;
+        }
+    }
+    if( grid_hits == 0 ) {
+        std::printf( "FAIL: grid was not used for a loose err_threshold\n" );
+        ++failures;
+    }
+
+    std::printf( "points=%zu grid_error=%.3gpx max_difference=%.3gpx (slack %.1gpx) loose_grid_hits=%zu\n",
+                 points.size(), grid_error, max_difference, SLACK_PX, grid_hits );
+    return failures == 0 ? 0 : 1;
+}
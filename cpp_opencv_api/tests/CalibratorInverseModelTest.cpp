@@ -0,0 +1,104 @@
+/* ====================================
+ * Calibrator Inverse Model Test
+ * ------------------------------------
+ * Desc   : 역왜곡 모델을 켜도 호출자의 err_threshold가 그대로 지켜지는지 확인합니다.
+ * 역모델 허용치(tolerance_px)를 일부러 느슨하게 두고, 엄격한 err_threshold로 보정한 결과의 잔차와
+ * 역모델을 끈 반복 풀이 결과와의 차이를 검사합니다. 실패하면 0이 아닌 값을 반환합니다.
+ * ==================================== */
+
+#include "Calibrator.h"
+#include "MgenLogger.h"
+#include "json/json.hpp"
+
+// STL::C++
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace MGEN::MVEM;
+
+namespace
+{
+    const CalibratorParams PARAMS = { 800.0, 800.0, 960.0, 540.0, 0.0, -0.35, 0.12, -0.02, 0.001, -0.0005 };
+
+    // 보정된 픽셀 좌표를 다시 왜곡했을 때 입력(왜곡된) 픽셀과의 차이 (픽셀, 정규화 잔차 * fx)
+    double DistortResidualPx( const cv::Point2f& undistorted, const cv::Point2f& distorted )
+    {
+        const double x  = ( undistorted.x - PARAMS.cx ) / PARAMS.fx;
+        const double y  = ( undistorted.y - PARAMS.cy ) / PARAMS.fy;
+        const double r2 = x * x + y * y;
+        const double radial = 1.0 + r2 * ( PARAMS.k1 + r2 * ( PARAMS.k2 + r2 * PARAMS.k3 ) );
+        const double dx = x * radial + 2.0 * PARAMS.p1 * x * y + PARAMS.p2 * ( r2 + 2.0 * x * x );
+        const double dy = y * radial + PARAMS.p1 * ( r2 + 2.0 * y * y ) + 2.0 * PARAMS.p2 * x * y;
+        return std::hypot( ( dx * PARAMS.fx + PARAMS.cx ) - distorted.x, ( dy * PARAMS.fy + PARAMS.cy ) - distorted.y );
+    }
+}
+
+int main()
+{
+    MGEN::initLogger();
+    int failures = 0;
+
+    if( CalibratorOptions {}.inverse_model.enable ) {
+        std::printf( "FAIL: inverse_model must be disabled by default\n" );
+        ++failures;
+    }
+
+    CalibratorOptions iterative;
+    CalibratorOptions inverse;
+    inverse.inverse_model.enable       = true;
+    inverse.inverse_model.tolerance_px = 0.05; // 역모델 단독으로는 0.05px까지 받아들일 만큼 느슨하게
+    const Calibrator reference( PARAMS, iterative );
+    const Calibrator with_model( PARAMS, inverse );
+    if( !with_model.getInverseModel().valid ) {
+        std::printf( "FAIL: inverse model was not fitted\n" );
+        return 1;
+    }
+
+    // float 출력의 반올림(1920px에서 약 1e-4px)만 허용
+    constexpr double SLACK_PX = 2e-4;
+    const cv::Point2f tight = { 1e-9f, 1e-9f };
+    double max_residual = 0.0, max_difference = 0.0;
+    std::vector<cv::Point2f> points;
+    for( float y = 20.0f; y < 1080.0f; y += 53.0f ) {
+        for( float x = 20.0f; x < 1920.0f; x += 61.0f ) {
+            points.push_back( { x, y } );
+        }
+    }
+    for( const cv::Point2f& p : points ) {
+        const auto a = reference.Calibrate( p, tight );
+        const auto b = with_model.Calibrate( p, tight );
+        if( a.has_value() != b.has_value() ) {
+            std::printf( "FAIL: convergence differs at (%.1f, %.1f)\n", p.x, p.y );
+            ++failures;
+            continue;
+        }
+        if( !b ) {
+            continue;
+        }
+        max_residual   = std::max( max_residual, DistortResidualPx( *b, p ) );
+        max_difference = std::max( max_difference, static_cast<double>( std::hypot( a->x - b->x, a->y - b->y ) ) );
+    }
+
+    // 배치 경로도 같은 임계값을 따라야 함
+    std::vector<float> src_x, src_y, dst_x( points.size() ), dst_y( points.size() );
+    for( const cv::Point2f& p : points ) {
+        src_x.push_back( p.x );
+        src_y.push_back( p.y );
+    }
+    std::vector<uint64_t> mask( Calibrator::MaskWords( points.size() ) );
+    with_model.CalibrateBatch( src_x.data(), src_y.data(), points.size(), dst_x.data(), dst_y.data(), mask.data(), tight );
+    for( size_t i = 0; i < points.size(); ++i ) {
+        if( ( mask[ i >> 6 ] >> ( i & 63 ) ) & 1u ) {
+            max_residual = std::max( max_residual, DistortResidualPx( { dst_x[ i ], dst_y[ i ] }, points[ i ] ) );
+        }
+    }
+
+    std::printf( "points=%zu max_residual=%.3gpx max_difference=%.3gpx (slack %.1gpx)\n",
+                 points.size(), max_residual, max_difference, SLACK_PX );
+    if( max_residual > SLACK_PX || max_difference > SLACK_PX ) {
+        std::printf( "FAIL: inverse model result exceeds err_threshold\n" );
+        ++failures;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,264 @@
+/* ====================================
+ * Normalized DLT Homography Solver Test
+ * ------------------------------------
+ * Desc   : 자체 DLT 풀이를 직접 계산한 기준과 비교합니다.
+ * 1) DltSystem의 랭크 2 더하기/빼기 결과가 남은 포인트만 새로 누적한 결과와 같은지,
+ * 2) Solve가 돌려준 벡터가 정규 방정식 A^T A(테스트에서 따로 계산)의 최소 고유쌍인지,
+ * 3) FitHomographyDlt(LM 보정)가 cv::findHomography(..., 0)과 같은 해를 주는지,
+ * 4) FitHomography4Point 닫힌 형식이 정확한 4쌍에서 참값을, 퇴화 입력에서 false를 주는지 검사합니다.
+ * 실패하면 0이 아닌 값을 반환합니다.
+ * ==================================== */
+
+#include "HomographyDlt.h"
+#include "MgenLogger.h"
+
+// OpenCV
+#include <opencv2/calib3d.hpp> // cv::findHomography
+
+// STL::C++
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace MGEN::MVEM;
+
+namespace
+{
+    // 보정된 픽셀 -> 지상 좌표 (m 단위, 카메라 앞 약 40m x 25m)
+    const cv::Matx33d TRUTH( 0.021, 0.0042, -18.0, -0.0011, 0.034, -9.5, 0.000012, 0.00041, 1.0 );
+
+    cv::Point2d Project( const cv::Matx33d& h, const cv::Point2d& p )
+    {
+        const double w = h( 2, 0 ) * p.x + h( 2, 1 ) * p.y + h( 2, 2 );
+        return { ( h( 0, 0 ) * p.x + h( 0, 1 ) * p.y + h( 0, 2 ) ) / w, ( h( 1, 0 ) * p.x + h( 1, 1 ) * p.y + h( 1, 2 ) ) / w };
+    }
+
+    // 이미지 하단 영역 격자에서 두 호모그래피의 투영 차이 최댓값 (지상 좌표 단위)
+    double MaxDifference( const cv::Matx33d& a, const cv::Matx33d& b )
+    {
+        double worst = 0.0;
+        for( double y = 300.0; y <= 1040.0; y += 40.0 ) {
+            for( double x = 40.0; x <= 1880.0; x += 40.0 ) {
+                const cv::Point2d pa = Project( a, { x, y } );
+                const cv::Point2d pb = Project( b, { x, y } );
+                worst = std::max( worst, std::hypot( pa.x - pb.x, pa.y - pb.y ) );
+            }
+        }
+        return worst;
+    }
+
+    // 재투영 RMS 오차 |H*src - dst|
+    double RmsError( const cv::Matx33d& h, const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst )
+    {
+        double sum = 0.0;
+        for( size_t i = 0; i < src.size(); ++i ) {
+            const cv::Point2d p = Project( h, src[ i ] );
+            sum += ( p.x - dst[ i ].x ) * ( p.x - dst[ i ].x ) + ( p.y - dst[ i ].y ) * ( p.y - dst[ i ].y );
+        }
+        return std::sqrt( sum / static_cast<double>( src.size() ) );
+    }
+
+    void MakePoints( std::mt19937& rng, size_t count, double noise_sigma, std::vector<cv::Point2f>& src, std::vector<cv::Point2f>& dst )
+    {
+        std::uniform_real_distribution<float> ux( 40.0f, 1880.0f ), uy( 300.0f, 1040.0f );
+        std::normal_distribution<double> noise( 0.0, noise_sigma > 0.0 ? noise_sigma : 1.0 );
+        src.clear();
+        dst.clear();
+        for( size_t i = 0; i < count; ++i ) {
+            src.push_back( { ux( rng ), uy( rng ) } );
+            const cv::Point2d g = Project( TRUTH, src.back() );
+            const double nx = noise_sigma > 0.0 ? noise( rng ) : 0.0;
+            const double ny = noise_sigma > 0.0 ? noise( rng ) : 0.0;
+            dst.push_back( { static_cast<float>( g.x + nx ), static_cast<float>( g.y + ny ) } );
+        }
+    }
+
+    // 정규화 좌표의 A^T A를 DltSystem과 무관하게 직접 계산
+    void NormalMatrix( const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst,
+                       const PointNormalization& src_norm, const PointNormalization& dst_norm, double m[ 81 ] )
+    {
+        std::fill( m, m + 81, 0.0 );
+        for( size_t i = 0; i < src.size(); ++i ) {
+            const cv::Point2d s = src_norm.Apply( src[ i ] );
+            const cv::Point2d d = dst_norm.Apply( dst[ i ] );
+            const double rows[ 2 ][ 9 ] = { { s.x, s.y, 1.0, 0.0, 0.0, 0.0, -d.x * s.x, -d.x * s.y, -d.x },
+                                            { 0.0, 0.0, 0.0, s.x, s.y, 1.0, -d.y * s.x, -d.y * s.y, -d.y } };
+            for( const auto& row : rows ) {
+                for( int r = 0; r < 9; ++r ) {
+                    for( int c = 0; c < 9; ++c ) {
+                        m[ r * 9 + c ] += row[ r ] * row[ c ];
+                    }
+                }
+            }
+        }
+    }
+
+    // h가 m의 최소 고유쌍인지: |M h - lambda h|와, 무작위 단위 벡터의 Rayleigh 몫이 lambda 이상인지
+    bool IsSmallestEigenpair( const double m[ 81 ], const cv::Matx33d& h, double lambda, std::mt19937& rng )
+    {
+        double trace = 0.0;
+        for( int i = 0; i < 9; ++i ) {
+            trace += m[ i * 9 + i ];
+        }
+        double residual = 0.0;
+        for( int r = 0; r < 9; ++r ) {
+            double mh = 0.0;
+            for( int c = 0; c < 9; ++c ) {
+                mh += m[ r * 9 + c ] * h.val[ c ];
+            }
+            residual += ( mh - lambda * h.val[ r ] ) * ( mh - lambda * h.val[ r ] );
+        }
+        if( std::sqrt( residual ) > 1e-9 * trace ) {
+            return false;
+        }
+        std::normal_distribution<double> gauss( 0.0, 1.0 );
+        for( int trial = 0; trial < 200; ++trial ) {
+            double v[ 9 ], norm = 0.0;
+            for( double& x : v ) {
+                x = gauss( rng );
+                norm += x * x;
+            }
+            double rayleigh = 0.0;
+            for( int r = 0; r < 9; ++r ) {
+                for( int c = 0; c < 9; ++c ) {
+                    rayleigh += v[ r ] * m[ r * 9 + c ] * v[ c ];
+                }
+            }
+            if( rayleigh / norm < lambda - 1e-12 * trace ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 주어진 정규화로 포인트를 누적하고 원래 좌표계의 H를 구함
+    bool SolveAccumulated( const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst,
+                           const PointNormalization& src_norm, const PointNormalization& dst_norm, cv::Matx33d& h )
+    {
+        DltSystem system;
+        for( size_t i = 0; i < src.size(); ++i ) {
+            system.Accumulate( src_norm.Apply( src[ i ] ), dst_norm.Apply( dst[ i ] ) );
+        }
+        cv::Matx33d h_normalized;
+        if( !system.Solve( h_normalized ) ) {
+            return false;
+        }
+        h = DenormalizeHomography( h_normalized, src_norm, dst_norm );
+        return true;
+    }
+}
+
+int main()
+{
+    MGEN::initLogger();
+    int failures = 0;
+    std::mt19937 rng( 11 );
+    std::vector<cv::Point2f> src, dst;
+
+    // 1. 랭크 2 더하기/빼기 == 남은 포인트만 새로 누적 (같은 정규화)
+    MakePoints( rng, 30, 0.02, src, dst );
+    const PointNormalization src_norm = PointNormalization::FromPoints( src );
+    const PointNormalization dst_norm = PointNormalization::FromPoints( dst );
+    DltSystem incremental;
+    for( size_t i = 0; i < src.size(); ++i ) {
+        incremental.Accumulate( src_norm.Apply( src[ i ] ), dst_norm.Apply( dst[ i ] ) );
+    }
+    std::vector<cv::Point2f> kept_src, kept_dst;
+    for( size_t i = 0; i < src.size(); ++i ) {
+        if( i % 3 == 0 ) {
+            incremental.Accumulate( src_norm.Apply( src[ i ] ), dst_norm.Apply( dst[ i ] ), -1.0 );
+        } else {
+            kept_src.push_back( src[ i ] );
+            kept_dst.push_back( dst[ i ] );
+        }
+    }
+    cv::Matx33d h_incremental_n, h_incremental, h_fresh;
+    if( incremental.pairs() != static_cast<long>( kept_src.size() ) || !incremental.Solve( h_incremental_n ) ||
+        !SolveAccumulated( kept_src, kept_dst, src_norm, dst_norm, h_fresh ) ) {
+        std::printf( "FAIL: downdated system could not be solved\n" );
+        ++failures;
+    } else {
+        h_incremental = DenormalizeHomography( h_incremental_n, src_norm, dst_norm );
+        const double difference = MaxDifference( h_incremental, h_fresh );
+        if( difference > 1e-9 ) {
+            std::printf( "FAIL: accumulate/downdate differs from a fresh accumulation by %.3g\n", difference );
+            ++failures;
+        }
+    }
+
+    // 2. Solve == 최소 고유쌍 (잡음 있음 / 정확한 대응 / 거의 한 직선에 모인 포인트)
+    for( const double sigma : { 0.02, 0.0, -1.0 } ) {
+        MakePoints( rng, 12, std::max( sigma, 0.0 ), src, dst );
+        if( sigma < 0.0 ) {
+            for( size_t i = 0; i < src.size(); ++i ) {
+                src[ i ].y = 700.0f + 0.01f * static_cast<float>( i % 2 ) + 1e-4f * src[ i ].x; // 한 직선에 가까움
+                const cv::Point2d g = Project( TRUTH, src[ i ] );
+                dst[ i ] = { static_cast<float>( g.x ), static_cast<float>( g.y ) };
+            }
+        }
+        const PointNormalization sn = PointNormalization::FromPoints( src );
+        const PointNormalization dn = PointNormalization::FromPoints( dst );
+        DltSystem system;
+        for( size_t i = 0; i < src.size(); ++i ) {
+            system.Accumulate( sn.Apply( src[ i ] ), dn.Apply( dst[ i ] ) );
+        }
+        double m[ 81 ];
+        NormalMatrix( src, dst, sn, dn, m );
+        cv::Matx33d h_n;
+        double lambda = 0.0;
+        if( !system.Solve( h_n, &lambda ) || !IsSmallestEigenpair( m, h_n, lambda, rng ) ) {
+            std::printf( "FAIL: Solve did not return the smallest eigenpair (sigma=%g)\n", sigma );
+            ++failures;
+        }
+    }
+
+    // 3. FitHomographyDlt == cv::findHomography(..., 0) (둘 다 정규화 DLT + 재투영 오차 LM)
+    double worst_cv = 0.0;
+    for( const size_t count : { 4u, 8u, 50u, 400u } ) {
+        MakePoints( rng, count, 0.02, src, dst );
+        const cv::Mat reference_mat = cv::findHomography( src, dst, 0 );
+        cv::Matx33d refined, linear;
+        if( reference_mat.empty() || !FitHomographyDlt( src.data(), dst.data(), count, refined, 10 ) ||
+            !FitHomographyDlt( src.data(), dst.data(), count, linear, 0 ) ) {
+            std::printf( "FAIL: no solution for %zu points\n", count );
+            ++failures;
+            continue;
+        }
+        const cv::Matx33d reference( reference_mat );
+        const double difference = MaxDifference( refined, reference );
+        worst_cv = std::max( worst_cv, difference );
+        if( difference > 1e-3 ) {
+            std::printf( "FAIL: FitHomographyDlt(LM) differs from cv::findHomography by %.3g for %zu points\n", difference, count );
+            ++failures;
+        }
+        // LM 없는 DLT 해도 기하 오차가 크게 나쁘지 않아야 함 (대수 오차 최소화이므로 약간 클 수 있음)
+        const double rms_reference = RmsError( reference, src, dst );
+        if( RmsError( linear, src, dst ) > rms_reference * 1.05 + 1e-6 || RmsError( refined, src, dst ) > rms_reference + 1e-6 ) {
+            std::printf( "FAIL: FitHomographyDlt residual is worse than cv::findHomography for %zu points\n", count );
+            ++failures;
+        }
+    }
+
+    // 4. 4점 닫힌 형식: 정확한 대응이면 참값, DLT와 같은 해, 퇴화(세 점이 한 직선)면 false
+    MakePoints( rng, 4, 0.0, src, dst );
+    cv::Matx33d closed_form, dlt;
+    if( !FitHomography4Point( src.data(), dst.data(), closed_form ) || !FitHomographyDlt( src.data(), dst.data(), 4, dlt, 0 ) ) {
+        std::printf( "FAIL: 4-point closed form failed on a valid quadrilateral\n" );
+        ++failures;
+    } else if( MaxDifference( closed_form, TRUTH ) > 1e-3 || MaxDifference( closed_form, dlt ) > 1e-3 ) {
+        std::printf( "FAIL: 4-point closed form differs from the truth by %.3g and from DLT by %.3g\n",
+                     MaxDifference( closed_form, TRUTH ), MaxDifference( closed_form, dlt ) );
+        ++failures;
+    }
+    const cv::Point2f collinear[ 4 ] = { { 100.0f, 400.0f }, { 500.0f, 600.0f }, { 900.0f, 800.0f }, { 300.0f, 900.0f } };
+    cv::Matx33d degenerate;
+    if( FitHomography4Point( collinear, dst.data(), degenerate ) ) {
+        std::printf( "FAIL: 4-point closed form accepted three collinear points\n" );
+        ++failures;
+    }
+
+    std::printf( "max_difference_vs_findHomography=%.3g failures=%d\n", worst_cv, failures );
+    return failures == 0 ? 0 : 1;
+}
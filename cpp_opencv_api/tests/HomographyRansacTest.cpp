@@ -0,0 +1,172 @@
+/* ====================================
+ * Parallel Homography RANSAC Test
+ * ------------------------------------
+ * Desc   : 자체 병렬 RANSAC의 결정성과 정확도를 확인합니다.
+ * 1) 같은 입력/시드면 워커 수(0, 1, 3, 7)와 반복 실행에 관계없이 H, 인라이어 마스크, 반복 횟수가 비트 단위로 같은지,
+ * 2) 인라이어 수가 같은 두 모델이 경쟁하는 입력(동점 규칙: 작은 가설 번호)에서도 결과가 워커 수와 무관한지,
+ * 3) 아웃라이어 30% 입력에서 인라이어 판정이 참값과 같고, H가 참 인라이어로 직접 푼 FitHomographyDlt와 같은지 검사합니다.
+ * 실패하면 0이 아닌 값을 반환합니다.
+ * ==================================== */
+
+#include "HomographyRansac.h"
+#include "HomographyDlt.h"
+#include "WorkerPool.h"
+#include "MgenLogger.h"
+
+// STL::C++
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace MGEN::MVEM;
+
+namespace
+{
+    // 보정된 픽셀 -> 지상 좌표 (m 단위, 카메라 앞 약 40m x 25m)
+    const cv::Matx33d TRUTH( 0.021, 0.0042, -18.0, -0.0011, 0.034, -9.5, 0.000012, 0.00041, 1.0 );
+    // 동점 입력의 두 번째 모델 (TRUTH와 인라이어를 공유하지 않을 만큼 다름)
+    const cv::Matx33d OTHER( 0.018, -0.0030, -12.0, 0.0020, 0.029, -6.0, -0.000008, 0.00035, 1.0 );
+
+    constexpr size_t WORKER_COUNTS[] = { 0, 1, 3, 7 };
+
+    cv::Point2d Project( const cv::Matx33d& h, const cv::Point2d& p )
+    {
+        const double w = h( 2, 0 ) * p.x + h( 2, 1 ) * p.y + h( 2, 2 );
+        return { ( h( 0, 0 ) * p.x + h( 0, 1 ) * p.y + h( 0, 2 ) ) / w, ( h( 1, 0 ) * p.x + h( 1, 1 ) * p.y + h( 1, 2 ) ) / w };
+    }
+
+    double MaxDifference( const cv::Matx33d& a, const cv::Matx33d& b )
+    {
+        double worst = 0.0;
+        for( double y = 300.0; y <= 1040.0; y += 40.0 ) {
+            for( double x = 40.0; x <= 1880.0; x += 40.0 ) {
+                const cv::Point2d pa = Project( a, { x, y } );
+                const cv::Point2d pb = Project( b, { x, y } );
+                worst = std::max( worst, std::hypot( pa.x - pb.x, pa.y - pb.y ) );
+            }
+        }
+        return worst;
+    }
+
+    bool SameEstimate( const HomographyEstimate& a, const HomographyEstimate& b )
+    {
+        return std::equal( a.homography.val, a.homography.val + 9, b.homography.val ) &&
+               a.inlier_mask == b.inlier_mask && a.iterations == b.iterations;
+    }
+
+    // 같은 입력을 여러 워커 수로 반복 실행해 모두 첫 결과와 같은지 검사
+    bool Deterministic( const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst,
+                        const HomographyEstimatorOptions& options, HomographyEstimate& first )
+    {
+        bool have_first = false;
+        for( const size_t workers : WORKER_COUNTS ) {
+            MGEN::WorkerPool pool( workers );
+            for( int repeat = 0; repeat < 3; ++repeat ) {
+                HomographyEstimate estimate;
+                if( !FindHomographyParallelRansac( src, dst, options, estimate, &pool ) ) {
+                    return false;
+                }
+                if( !have_first ) {
+                    first      = estimate;
+                    have_first = true;
+                } else if( !SameEstimate( first, estimate ) ) {
+                    std::printf( "FAIL: result changed with %zu workers (repeat %d)\n", workers, repeat );
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+int main()
+{
+    MGEN::initLogger();
+    int failures = 0;
+    std::mt19937 rng( 3 );
+    std::uniform_real_distribution<float> ux( 40.0f, 1880.0f ), uy( 300.0f, 1040.0f ), unit( 0.0f, 1.0f ), offset( 2.0f, 20.0f ), angle( 0.0f, 6.2832f );
+    std::normal_distribution<float> noise( 0.0f, 0.02f );
+
+    HomographyEstimatorOptions options;
+    options.method           = HomographyMethod::ParallelRansac;
+    options.ransac_threshold = 0.1;
+
+    // 1 + 3. 아웃라이어 30%: 결정성 + 참 인라이어 판정 + 직접 풀이와 같은 H
+    std::vector<cv::Point2f> src, dst, true_src, true_dst;
+    std::vector<unsigned char> truth;
+    for( int i = 0; i < 600; ++i ) {
+        src.push_back( { ux( rng ), uy( rng ) } );
+        cv::Point2d g = Project( TRUTH, src.back() );
+        const bool outlier = unit( rng ) < 0.3f;
+        if( outlier ) {
+            const float r = offset( rng ), a = angle( rng );
+            g.x += r * std::cos( a );
+            g.y += r * std::sin( a );
+        }
+        dst.push_back( { static_cast<float>( g.x ) + noise( rng ), static_cast<float>( g.y ) + noise( rng ) } );
+        truth.push_back( outlier ? 0 : 1 );
+        if( !outlier ) {
+            true_src.push_back( src.back() );
+            true_dst.push_back( dst.back() );
+        }
+    }
+    HomographyEstimate estimate;
+    if( !Deterministic( src, dst, options, estimate ) ) {
+        std::printf( "FAIL: parallel RANSAC is not deterministic on the outlier input\n" );
+        ++failures;
+    } else {
+        size_t mislabeled = 0;
+        for( size_t i = 0; i < truth.size(); ++i ) {
+            mislabeled += ( estimate.inlier_mask[ i ] != 0 ) != ( truth[ i ] != 0 );
+        }
+        cv::Matx33d direct;
+        FitHomographyDlt( true_src.data(), true_dst.data(), true_src.size(), direct, options.refine_iterations );
+        const double difference = MaxDifference( estimate.homography, direct );
+        // 잡음(2cm) 때문에 임계값(10cm) 경계의 포인트 몇 개는 달리 판정될 수 있음
+        if( mislabeled > truth.size() / 100 || difference > 0.01 ) {
+            std::printf( "FAIL: mislabeled=%zu difference_vs_direct=%.3g\n", mislabeled, difference );
+            ++failures;
+        }
+        if( estimate.iterations <= 0 || estimate.iterations > options.max_iterations ) {
+            std::printf( "FAIL: iterations=%d outside (0, %d]\n", estimate.iterations, options.max_iterations );
+            ++failures;
+        }
+    }
+
+    // 같은 입력이라도 시드가 다르면 표본이 달라지지만 인라이어 판정은 같아야 함
+    HomographyEstimatorOptions reseeded = options;
+    reseeded.seed = options.seed + 1;
+    HomographyEstimate other_seed;
+    if( !FindHomographyParallelRansac( src, dst, reseeded, other_seed ) || other_seed.inlier_mask != estimate.inlier_mask ) {
+        std::printf( "FAIL: a different seed changed the inlier set\n" );
+        ++failures;
+    }
+
+    // 2. 동점: 인라이어 수가 같은 두 모델 (각 40점, 잡음 없음)
+    std::vector<cv::Point2f> tie_src, tie_dst;
+    for( int i = 0; i < 80; ++i ) {
+        tie_src.push_back( { ux( rng ), uy( rng ) } );
+        const cv::Point2d g = Project( i % 2 == 0 ? TRUTH : OTHER, tie_src.back() );
+        tie_dst.push_back( { static_cast<float>( g.x ), static_cast<float>( g.y ) } );
+    }
+    HomographyEstimate tie;
+    if( !Deterministic( tie_src, tie_dst, options, tie ) ) {
+        std::printf( "FAIL: parallel RANSAC is not deterministic on tied models\n" );
+        ++failures;
+    } else {
+        size_t even = 0, odd = 0;
+        for( size_t i = 0; i < tie.inlier_mask.size(); ++i ) {
+            ( i % 2 == 0 ? even : odd ) += tie.inlier_mask[ i ] != 0;
+        }
+        if( !( ( even == 40 && odd == 0 ) || ( even == 0 && odd == 40 ) ) ) {
+            std::printf( "FAIL: tied input mixed the two models (even=%zu odd=%zu)\n", even, odd );
+            ++failures;
+        }
+    }
+
+    std::printf( "points=%zu iterations=%d tie_iterations=%d failures=%d\n", src.size(), estimate.iterations, tie.iterations, failures );
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,174 @@
+/* ====================================
+ * Incremental Homography Session Test
+ * ------------------------------------
+ * Desc   : 세션의 포인트 추가/이동/삭제(랭크 2 갱신) 결과가 같은 포인트로 새로 푼 결과와 같은지 확인합니다.
+ * 기준은 세션의 보정된 포인트를 그대로 넣은 HomographyEstimator::Estimate(Dlt, LM 없음)입니다.
+ * 편집 직후에는 세션의 정규화가 이전 포인트 분포에 맞춰져 있으므로 작은 허용치로, Rebuild 후에는
+ * 반올림 수준으로 같아야 합니다. 재누적 주기를 넘기는 긴 편집도 검사합니다. 실패하면 0이 아닌 값을 반환합니다.
+ * ==================================== */
+
+#include "HomographySession.h"
+#include "HomographyEstimator.h"
+#include "MgenLogger.h"
+
+// STL::C++
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace MGEN::MVEM;
+
+namespace
+{
+    // 영상 전체에서 왜곡 보정이 수렴하는 완만한 렌즈
+    const CalibratorParams PARAMS = { 1000.0, 1000.0, 960.0, 540.0, 0.0, -0.12, 0.03, 0.0, 0.0005, -0.0003 };
+
+    // 보정된 픽셀 -> 지상 좌표 (m 단위, 카메라 앞 약 40m x 25m)
+    const cv::Matx33d TRUTH( 0.021, 0.0042, -18.0, -0.0011, 0.034, -9.5, 0.000012, 0.00041, 1.0 );
+
+    // 편집 직후(정규화가 이전 분포 기준) / Rebuild 후 허용 오차 (지상 좌표 단위)
+    constexpr double EDITED_TOLERANCE  = 1e-3;
+    constexpr double REBUILT_TOLERANCE = 1e-6;
+
+    cv::Point2d Project( const cv::Matx33d& h, const cv::Point2d& p )
+    {
+        const double w = h( 2, 0 ) * p.x + h( 2, 1 ) * p.y + h( 2, 2 );
+        return { ( h( 0, 0 ) * p.x + h( 0, 1 ) * p.y + h( 0, 2 ) ) / w, ( h( 1, 0 ) * p.x + h( 1, 1 ) * p.y + h( 1, 2 ) ) / w };
+    }
+
+    // 이미지 하단 영역 격자에서 두 호모그래피의 투영 차이 최댓값
+    double MaxDifference( const cv::Matx33d& a, const cv::Matx33d& b )
+    {
+        double worst = 0.0;
+        for( double y = 300.0; y <= 1040.0; y += 40.0 ) {
+            for( double x = 40.0; x <= 1880.0; x += 40.0 ) {
+                const cv::Point2d pa = Project( a, { x, y } );
+                const cv::Point2d pb = Project( b, { x, y } );
+                worst = std::max( worst, std::hypot( pa.x - pb.x, pa.y - pb.y ) );
+            }
+        }
+        return worst;
+    }
+
+    // 세션의 활성 포인트로 새로 푼 DLT 해
+    bool DirectSolve( HomographySession& session, cv::Matx33d& h )
+    {
+        std::vector<cv::Point2f> src, dst;
+        for( const HomographySession::SurveyPoint& point : session.Points() ) {
+            if( point.active ) {
+                src.push_back( point.undistorted );
+                dst.push_back( point.ground );
+            }
+        }
+        HomographyEstimatorOptions options;
+        options.method            = HomographyMethod::Dlt;
+        options.refine_iterations = 0;
+        HomographyEstimate estimate;
+        std::string error;
+        if( !HomographyEstimator::Estimate( src, dst, options, estimate, error ) ) {
+            return false;
+        }
+        h = estimate.homography;
+        return true;
+    }
+
+    // 세션 해와 새로 푼 해의 차이를 검사하고 차이를 돌려줌 (해가 없으면 실패 처리 후 무한대)
+    double Check( HomographySession& session, const char* step, double tolerance, int& failures )
+    {
+        cv::Matx33d direct;
+        const HomographySession::Solution solution = session.Solve();
+        if( !solution.valid || !DirectSolve( session, direct ) ) {
+            std::printf( "FAIL: %s: no solution\n", step );
+            ++failures;
+            return HUGE_VAL;
+        }
+        const double difference = MaxDifference( solution.homography, direct );
+        if( difference > tolerance ) {
+            std::printf( "FAIL: %s: session differs from a full solve by %.3g (tolerance %.1g)\n", step, difference, tolerance );
+            ++failures;
+        }
+        return difference;
+    }
+}
+
+int main()
+{
+    MGEN::initLogger();
+
+    auto calibrator = std::make_shared<const Calibrator>( PARAMS, CalibratorOptions {} );
+    HomographySession session( "test", calibrator );
+    int    failures = 0;
+    double worst    = 0.0; // 편집 직후 차이의 최댓값
+
+    // 왜곡된 카메라 픽셀을 고르고, 보정한 좌표를 TRUTH로 투영한 값에 2cm 잡음을 더해 지상 좌표로 사용
+    std::mt19937 rng( 7 );
+    std::uniform_real_distribution<float> ux( 60.0f, 1860.0f ), uy( 320.0f, 1020.0f );
+    std::normal_distribution<double> noise( 0.0, 0.02 );
+    auto make_pair = [ & ]( cv::Point2f& camera, cv::Point2f& ground ) {
+        camera = { ux( rng ), uy( rng ) };
+        const cv::Point2d g = Project( TRUTH, *calibrator->Calibrate( camera ) );
+        ground = { static_cast<float>( g.x + noise( rng ) ), static_cast<float>( g.y + noise( rng ) ) };
+    };
+
+    std::vector<uint64_t> ids;
+    for( int i = 0; i < 12; ++i ) {
+        cv::Point2f camera, ground;
+        uint64_t id = 0;
+        make_pair( camera, ground );
+        if( session.AddPoint( camera, ground, id ) != HomographySession::EditStatus::OK ) {
+            std::printf( "FAIL: AddPoint failed\n" );
+            return 1;
+        }
+        ids.push_back( id );
+    }
+    session.Rebuild();
+    Check( session, "initial", REBUILT_TOLERANCE, failures );
+
+    // 1. 추가 / 이동 / 삭제 각각
+    cv::Point2f camera, ground;
+    uint64_t added = 0;
+    make_pair( camera, ground );
+    session.AddPoint( camera, ground, added );
+    worst = std::max( worst, Check( session, "add", EDITED_TOLERANCE, failures ) );
+
+    make_pair( camera, ground );
+    session.UpdatePoint( ids[ 3 ], camera, ground );
+    worst = std::max( worst, Check( session, "update", EDITED_TOLERANCE, failures ) );
+
+    session.RemovePoint( ids[ 5 ] );
+    worst = std::max( worst, Check( session, "remove", EDITED_TOLERANCE, failures ) );
+
+    if( session.RemovePoint( ids[ 5 ] ) != HomographySession::EditStatus::NOT_FOUND ||
+        session.UpdatePoint( 9999, camera, ground ) != HomographySession::EditStatus::NOT_FOUND ) {
+        std::printf( "FAIL: editing a missing point did not report NOT_FOUND\n" );
+        ++failures;
+    }
+
+    session.Rebuild();
+    Check( session, "rebuild after edits", REBUILT_TOLERANCE, failures );
+
+    // 2. 재누적 주기(REBUILD_INTERVAL)를 넘기는 긴 이동 편집: 빼기 누적 오차가 남지 않아야 함
+    for( size_t i = 0; i < HomographySession::REBUILD_INTERVAL + 40; ++i ) {
+        make_pair( camera, ground );
+        session.UpdatePoint( ids[ i % 4 ], camera, ground );
+    }
+    worst = std::max( worst, Check( session, "long edit sequence", EDITED_TOLERANCE, failures ) );
+    session.Rebuild();
+    Check( session, "rebuild after long edit sequence", REBUILT_TOLERANCE, failures );
+
+    // 3. Solve(points)는 해와 같은 상태의 포인트를 돌려줌
+    std::vector<HomographySession::SurveyPoint> points;
+    const HomographySession::Solution with_points = session.Solve( points );
+    if( points.size() != with_points.points || with_points.revision != session.Solve().revision ) {
+        std::printf( "FAIL: Solve(points) returned %zu points for a %zu-point solution\n", points.size(), with_points.points );
+        ++failures;
+    }
+
+    std::printf( "points=%zu max_edit_difference=%.3g (tolerance %.1g) failures=%d\n",
+                 points.size(), worst, EDITED_TOLERANCE, failures );
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,174 @@
+/* ====================================
+ * Leave-One-Out Diagnostics Test
+ * ------------------------------------
+ * Desc   : 랭크 2 downdate로 구한 leave-one-out 진단 값을 포인트마다 N-1개로 새로 푼 직접 계산과 비교합니다.
+ * 1) 같은 정규화(전체 포인트 기준)로 N-1개를 새로 누적한 해와는 반올림 수준으로 같아야 하고,
+ * 2) FitHomographyDlt(LM 없음, 자체 정규화)를 N번 호출한 결과와는 정규화 차이만큼의 작은 허용치 안에서 같아야 합니다.
+ * 기준 RMS, 워커 수와 무관한 결과, 일부러 어긋나게 만든 포인트의 검출도 검사합니다.
+ * 실패하면 0이 아닌 값을 반환합니다.
+ * ==================================== */
+
+#include "HomographyMetrics.h"
+#include "HomographyDlt.h"
+#include "WorkerPool.h"
+#include "MgenLogger.h"
+
+// STL::C++
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace MGEN::MVEM;
+
+namespace
+{
+    // 보정된 픽셀 -> 지상 좌표 (m 단위, 카메라 앞 약 40m x 25m)
+    const cv::Matx33d TRUTH( 0.021, 0.0042, -18.0, -0.0011, 0.034, -9.5, 0.000012, 0.00041, 1.0 );
+
+    // 직접 계산과의 허용 차이 (기준 RMS 대비 비율)
+    constexpr double SAME_NORMALIZATION_TOLERANCE = 1e-6;
+    constexpr double OWN_NORMALIZATION_TOLERANCE  = 0.1; // 포인트가 적을수록 정규화 차이가 해에 더 드러남
+
+    constexpr size_t OUTLIER_INDEX = 2;
+
+    cv::Point2d Project( const cv::Matx33d& h, const cv::Point2d& p )
+    {
+        const double w = h( 2, 0 ) * p.x + h( 2, 1 ) * p.y + h( 2, 2 );
+        return { ( h( 0, 0 ) * p.x + h( 0, 1 ) * p.y + h( 0, 2 ) ) / w, ( h( 1, 0 ) * p.x + h( 1, 1 ) * p.y + h( 1, 2 ) ) / w };
+    }
+
+    double Distance( const cv::Point2d& a, const cv::Point2f& b )
+    {
+        return std::hypot( a.x - b.x, a.y - b.y );
+    }
+
+    // H_-i로 계산한 진단 값 (ComputeLeaveOneOut과 같은 정의)
+    LeaveOneOut Diagnose( const cv::Matx33d& without, const cv::Matx33d& full, size_t i,
+                          const std::vector<cv::Point2f>& src, const std::vector<cv::Point2f>& dst )
+    {
+        double rms_sum = 0.0, influence_sum = 0.0;
+        for( size_t j = 0; j < src.size(); ++j ) {
+            const cv::Point2d p = Project( without, src[ j ] );
+            const cv::Point2d q = Project( full, src[ j ] );
+            if( j != i ) {
+                rms_sum += Distance( p, dst[ j ] ) * Distance( p, dst[ j ] );
+            }
+            influence_sum += ( p.x - q.x ) * ( p.x - q.x ) + ( p.y - q.y ) * ( p.y - q.y );
+        }
+        LeaveOneOut result;
+        result.prediction_error = static_cast<float>( Distance( Project( without, src[ i ] ), dst[ i ] ) );
+        result.rms_without      = static_cast<float>( std::sqrt( rms_sum / static_cast<double>( src.size() - 1 ) ) );
+        result.influence        = static_cast<float>( std::sqrt( influence_sum / static_cast<double>( src.size() ) ) );
+        return result;
+    }
+
+    // 두 진단 값의 최대 차이
+    double Difference( const LeaveOneOut& a, const LeaveOneOut& b )
+    {
+        return std::max( { std::abs( static_cast<double>( a.prediction_error ) - b.prediction_error ),
+                           std::abs( static_cast<double>( a.rms_without ) - b.rms_without ),
+                           std::abs( static_cast<double>( a.influence ) - b.influence ) } );
+    }
+
+    bool SameResults( const std::vector<LeaveOneOut>& a, const std::vector<LeaveOneOut>& b )
+    {
+        return std::equal( a.begin(), a.end(), b.begin(), b.end(), []( const LeaveOneOut& x, const LeaveOneOut& y ) {
+            return x.prediction_error == y.prediction_error && x.rms_without == y.rms_without && x.influence == y.influence;
+        } );
+    }
+}
+
+int main()
+{
+    MGEN::initLogger();
+    int failures = 0;
+    std::mt19937 rng( 5 );
+    std::uniform_real_distribution<float> ux( 40.0f, 1880.0f ), uy( 300.0f, 1040.0f );
+    std::normal_distribution<float> noise( 0.0f, 0.02f );
+
+    for( const size_t count : { 8u, 20u, 200u } ) {
+        std::vector<cv::Point2f> src, dst;
+        for( size_t i = 0; i < count; ++i ) {
+            src.push_back( { ux( rng ), uy( rng ) } );
+            const cv::Point2d g = Project( TRUTH, src.back() );
+            dst.push_back( { static_cast<float>( g.x ) + noise( rng ), static_cast<float>( g.y ) + noise( rng ) } );
+        }
+        dst[ OUTLIER_INDEX ].x += 1.5f; // 서베이 실수
+
+        MGEN::WorkerPool inline_pool( 0 ), pool( 3 );
+        std::vector<LeaveOneOut> results, serial;
+        double reference_rms = 0.0, serial_rms = 0.0;
+        if( !ComputeLeaveOneOut( src, dst, results, reference_rms, &pool ) ||
+            !ComputeLeaveOneOut( src, dst, serial, serial_rms, &inline_pool ) || results.size() != count ) {
+            std::printf( "FAIL: ComputeLeaveOneOut failed for %zu points\n", count );
+            ++failures;
+            continue;
+        }
+        if( !SameResults( results, serial ) || reference_rms != serial_rms ) {
+            std::printf( "FAIL: results depend on the worker count (%zu points)\n", count );
+            ++failures;
+        }
+
+        // 기준: 전체 포인트 DLT 해
+        cv::Matx33d full;
+        FitHomographyDlt( src.data(), dst.data(), count, full, 0 );
+        double full_sum = 0.0;
+        for( size_t j = 0; j < count; ++j ) {
+            full_sum += Distance( Project( full, src[ j ] ), dst[ j ] ) * Distance( Project( full, src[ j ] ), dst[ j ] );
+        }
+        const double full_rms = std::sqrt( full_sum / static_cast<double>( count ) );
+        if( std::abs( full_rms - reference_rms ) > 1e-6 * std::max( 1.0, full_rms ) ) {
+            std::printf( "FAIL: reference_rms=%.9g, direct solve gives %.9g (%zu points)\n", reference_rms, full_rms, count );
+            ++failures;
+        }
+
+        // 포인트마다 그 포인트를 뺀 N-1개로 새로 푼 해와 비교
+        const PointNormalization src_norm = PointNormalization::FromPoints( src );
+        const PointNormalization dst_norm = PointNormalization::FromPoints( dst );
+        double same_worst = 0.0, own_worst = 0.0;
+        size_t largest = 0;
+        for( size_t i = 0; i < count; ++i ) {
+            std::vector<cv::Point2f> others_src, others_dst;
+            DltSystem system;
+            for( size_t j = 0; j < count; ++j ) {
+                if( j != i ) {
+                    others_src.push_back( src[ j ] );
+                    others_dst.push_back( dst[ j ] );
+                    system.Accumulate( src_norm.Apply( src[ j ] ), dst_norm.Apply( dst[ j ] ) );
+                }
+            }
+            cv::Matx33d same_normalized, own;
+            if( !system.Solve( same_normalized ) ||
+                !FitHomographyDlt( others_src.data(), others_dst.data(), others_src.size(), own, 0 ) ) {
+                std::printf( "FAIL: direct solve without point %zu failed\n", i );
+                ++failures;
+                continue;
+            }
+            const cv::Matx33d same = DenormalizeHomography( same_normalized, src_norm, dst_norm );
+            same_worst = std::max( same_worst, Difference( Diagnose( same, full, i, src, dst ), results[ i ] ) / reference_rms );
+            own_worst  = std::max( own_worst, Difference( Diagnose( own, full, i, src, dst ), results[ i ] ) / reference_rms );
+            if( results[ i ].prediction_error > results[ largest ].prediction_error ) {
+                largest = i;
+            }
+        }
+        if( same_worst > SAME_NORMALIZATION_TOLERANCE ) {
+            std::printf( "FAIL: downdate differs from %zu re-accumulated solves by %.3g x reference_rms\n", count, same_worst );
+            ++failures;
+        }
+        if( own_worst > OWN_NORMALIZATION_TOLERANCE ) {
+            std::printf( "FAIL: downdate differs from %zu FitHomographyDlt calls by %.3g x reference_rms\n", count, own_worst );
+            ++failures;
+        }
+        if( count >= 20 && largest != OUTLIER_INDEX ) { // 포인트가 적으면 아웃라이어가 다른 포인트의 해까지 끌어당김
+            std::printf( "FAIL: largest prediction error at point %zu, expected %zu (%zu points)\n", largest, OUTLIER_INDEX, count );
+            ++failures;
+        }
+        std::printf( "points=%zu reference_rms=%.4f difference/reference_rms: same_normalization=%.3g own_normalization=%.3g\n",
+                     count, reference_rms, same_worst, own_worst );
+    }
+
+    std::printf( "failures=%d\n", failures );
+    return failures == 0 ? 0 : 1;
+}
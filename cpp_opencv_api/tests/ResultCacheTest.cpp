@@ -0,0 +1,153 @@
+/* ====================================
+ * Homography Result Cache Test
+ * ------------------------------------
+ * Desc   : calculate_dynamic 결과 캐시의 키와 수명 규칙을 확인합니다.
+ * 같은 포인트 집합은 입력 순서와 관계없이 같은 키가 되고, 내용이 조금이라도 다르면 다른 키가 되며,
+ * 조회는 전체 키가 같을 때만 적중하고, TTL과 항목 수 한도를 지키는지 검사합니다. 실패하면 0이 아닌 값을 반환합니다.
+ * ==================================== */
+
+#include "ResultCache.h"
+#include "MgenLogger.h"
+
+// STL::C++
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace MGEN::MVEM;
+
+namespace
+{
+    const CalibratorParams PARAMS = { 800.0, 800.0, 960.0, 540.0, 0.0, -0.35, 0.12, -0.02, 0.001, -0.0005 };
+
+    std::vector<SurveyPair> MakePairs( void )
+    {
+        return {
+            { { 120.0f, 840.0f }, { 10.0f, 0.0f } },
+            { { 1800.0f, 860.0f }, { 30.0f, 0.0f } },
+            { { 960.0f, 400.0f }, { 20.0f, 40.0f } },
+            { { 300.0f, 500.0f }, { 12.5f, 35.0f } },
+            { { 1500.0f, 520.0f }, { 27.5f, 35.0f } },
+        };
+    }
+
+    std::shared_ptr<const ResultCache::Result> MakeResult( double marker )
+    {
+        auto result = std::make_shared<ResultCache::Result>();
+        result->homography  = cv::Matx33d( marker, 0, 0, 0, 1, 0, 0, 0, 1 );
+        result->points_used = 5;
+        return result;
+    }
+
+    std::string KeyOf( std::vector<SurveyPair> pairs, const CalibratorOptions& options = CalibratorOptions {} )
+    {
+        ResultCache::Canonicalize( pairs );
+        return ResultCache::MakeKey( PARAMS, options, pairs );
+    }
+}
+
+int main()
+{
+    MGEN::initLogger();
+    int failures = 0;
+
+    // 1. 정규화: 입력 순서와 관계없이 같은 키, order는 원래 인덱스를 가리킴
+    const std::vector<SurveyPair> pairs = MakePairs();
+    std::vector<SurveyPair> reversed( pairs.rbegin(), pairs.rend() );
+    const std::string key = KeyOf( pairs );
+    if( KeyOf( reversed ) != key ) {
+        std::printf( "FAIL: point order changed the cache key\n" );
+        ++failures;
+    }
+    std::vector<SurveyPair> sorted = reversed;
+    std::vector<size_t> order;
+    ResultCache::Canonicalize( sorted, order );
+    for( size_t k = 0; k < sorted.size(); ++k ) {
+        if( sorted[ k ].camera != reversed[ order[ k ] ].camera || sorted[ k ].ground != reversed[ order[ k ] ].ground ) {
+            std::printf( "FAIL: Canonicalize order[%zu] does not point at the original pair\n", k );
+            ++failures;
+        }
+    }
+
+    // 2. 키 내용: -0.0은 0.0과 같고, 좌표/옵션이 다르면 다른 키
+    std::vector<SurveyPair> negative_zero = pairs;
+    negative_zero[ 0 ].ground.y = -0.0f;
+    if( KeyOf( negative_zero ) != key ) {
+        std::printf( "FAIL: -0.0 and 0.0 produced different keys\n" );
+        ++failures;
+    }
+    std::vector<SurveyPair> moved = pairs;
+    moved[ 2 ].camera.x += 0.25f;
+    CalibratorOptions newton;
+    newton.solver = UndistortSolver::Newton;
+    if( KeyOf( moved ) == key || KeyOf( pairs, newton ) == key ) {
+        std::printf( "FAIL: different points or options produced the same key\n" );
+        ++failures;
+    }
+
+    // 3. 조회는 전체 키가 같을 때만 적중 (앞부분이 같은 키, 마지막 바이트만 다른 키는 실패)
+    ResultCache cache( 8, ResultCache::DEFAULT_MAX_BYTES, std::chrono::seconds( 60 ) );
+    const auto stored = MakeResult( 1.0 );
+    cache.Insert( key, stored );
+    std::string last_byte = key;
+    last_byte.back() = static_cast<char>( last_byte.back() ^ 1 );
+    if( cache.Find( key ) != stored ) {
+        std::printf( "FAIL: stored result was not found by its key\n" );
+        ++failures;
+    }
+    if( cache.Find( last_byte ) != nullptr || cache.Find( key.substr( 0, key.size() - 1 ) ) != nullptr || cache.Find( KeyOf( moved ) ) != nullptr ) {
+        std::printf( "FAIL: a different key hit the stored result\n" );
+        ++failures;
+    }
+    ResultCache::Stats stats = cache.getStats();
+    if( stats.hits != 1 || stats.misses != 3 ) {
+        std::printf( "FAIL: hits=%llu misses=%llu (expected 1 / 3)\n",
+                     static_cast<unsigned long long>( stats.hits ), static_cast<unsigned long long>( stats.misses ) );
+        ++failures;
+    }
+
+    // 4. TTL: 유효 시간이 0이면 저장 직후 조회에서 만료로 제거
+    ResultCache expiring( 8, ResultCache::DEFAULT_MAX_BYTES, std::chrono::seconds( 0 ) );
+    expiring.Insert( key, stored );
+    if( expiring.Find( key ) != nullptr ) {
+        std::printf( "FAIL: expired entry was returned\n" );
+        ++failures;
+    }
+    stats = expiring.getStats();
+    if( stats.expirations != 1 || stats.size != 0 || stats.bytes != 0 ) {
+        std::printf( "FAIL: expired entry was not removed (expirations=%llu size=%zu bytes=%zu)\n",
+                     static_cast<unsigned long long>( stats.expirations ), stats.size, stats.bytes );
+        ++failures;
+    }
+
+    // 5. 항목 수 한도: 가장 오래 쓰이지 않은 항목부터 제거
+    ResultCache small( 2, ResultCache::DEFAULT_MAX_BYTES, std::chrono::seconds( 60 ) );
+    const std::string key_a = KeyOf( pairs );
+    const std::string key_b = KeyOf( moved );
+    const std::string key_c = KeyOf( pairs, newton );
+    small.Insert( key_a, MakeResult( 1.0 ) );
+    small.Insert( key_b, MakeResult( 2.0 ) );
+    small.Find( key_a ); // a를 최근 사용으로
+    small.Insert( key_c, MakeResult( 3.0 ) );
+    if( small.Find( key_a ) == nullptr || small.Find( key_b ) != nullptr || small.Find( key_c ) == nullptr ) {
+        std::printf( "FAIL: LRU eviction removed the wrong entry\n" );
+        ++failures;
+    }
+    if( small.getStats().evictions != 1 ) {
+        std::printf( "FAIL: evictions=%llu (expected 1)\n", static_cast<unsigned long long>( small.getStats().evictions ) );
+        ++failures;
+    }
+
+    // 6. 메모리 한도보다 큰 항목은 저장하지 않음
+    ResultCache tiny( 8, 64, std::chrono::seconds( 60 ) );
+    tiny.Insert( key, stored );
+    if( tiny.Find( key ) != nullptr || tiny.getStats().size != 0 ) {
+        std::printf( "FAIL: entry larger than max_bytes was stored\n" );
+        ++failures;
+    }
+
+    std::printf( "key_bytes=%zu failures=%d\n", key.size(), failures );
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+/* ====================================
+ * SingleFlight Coalescing Test
+ * ------------------------------------
+ * Desc   : 같은 키로 동시에 들어온 호출이 한 번만 계산되고 모두 같은 결과를 받는지 확인합니다.
+ * 리더의 계산은 나머지 호출이 모두 대기에 들어간 뒤에 끝나도록 붙잡아 두어 병합을 결정적으로 만들고,
+ * 예외 전달, 다른 키의 독립성, 계산이 끝난 키의 재계산(결과를 보관하지 않음)도 검사합니다.
+ * 실패하면 0이 아닌 값을 반환합니다.
+ * ==================================== */
+
+#include "SingleFlight.h"
+#include "MgenLogger.h"
+
+// STL::C++
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr int CALLERS = 8;
+
+    using Flight = MGEN::SingleFlight<std::string, std::shared_ptr<const int>>;
+
+    // 나머지 호출이 모두 리더를 기다릴 때까지 대기 (제한 시간 안에 모이지 않으면 false)
+    bool WaitForWaiters( const Flight& flight, uint64_t expected )
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 10 );
+        while( flight.stats().coalesced < expected ) {
+            if( std::chrono::steady_clock::now() > deadline ) {
+                return false;
+            }
+            std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        }
+        return true;
+    }
+}
+
+int main()
+{
+    MGEN::initLogger();
+    int failures = 0;
+
+    // 1. 동시 호출 병합: 계산 1회, 모두 같은 결과 객체
+    Flight flight;
+    std::atomic<int> runs { 0 };
+    std::atomic<int> coalesced_callers { 0 };
+    std::atomic<bool> gathered { true };
+    std::vector<std::shared_ptr<const int>> results( CALLERS );
+    std::vector<std::thread> threads;
+    for( int i = 0; i < CALLERS; ++i ) {
+        threads.emplace_back( [ &, i ] {
+            bool coalesced = false;
+            results[ i ] = flight.Do( "calculate", [ & ] {
+                runs.fetch_add( 1 );
+                if( !WaitForWaiters( flight, CALLERS - 1 ) ) {
+                    gathered = false;
+                }
+                return std::make_shared<const int>( 42 );
+            }, &coalesced );
+            if( coalesced ) {
+                coalesced_callers.fetch_add( 1 );
+            }
+        } );
+    }
+    for( std::thread& t : threads ) {
+        t.join();
+    }
+    if( !gathered ) {
+        std::printf( "FAIL: concurrent callers did not wait on the leader\n" );
+        ++failures;
+    }
+    if( runs != 1 || coalesced_callers != CALLERS - 1 ) {
+        std::printf( "FAIL: runs=%d coalesced=%d (expected 1 / %d)\n", runs.load(), coalesced_callers.load(), CALLERS - 1 );
+        ++failures;
+    }
+    for( const auto& result : results ) {
+        if( result == nullptr || result != results[ 0 ] || *result != 42 ) {
+            std::printf( "FAIL: a caller received a different result\n" );
+            ++failures;
+            break;
+        }
+    }
+    Flight::Stats stats = flight.stats();
+    if( stats.leaders != 1 || stats.coalesced != CALLERS - 1 || stats.in_flight != 0 ) {
+        std::printf( "FAIL: stats leaders=%llu coalesced=%llu in_flight=%zu\n", static_cast<unsigned long long>( stats.leaders ),
+                     static_cast<unsigned long long>( stats.coalesced ), stats.in_flight );
+        ++failures;
+    }
+
+    // 2. 끝난 키는 보관하지 않음: 다시 호출하면 다시 계산
+    bool coalesced = true;
+    const auto again = flight.Do( "calculate", [] { return std::make_shared<const int>( 7 ); }, &coalesced );
+    if( coalesced || again == results[ 0 ] || *again != 7 ) {
+        std::printf( "FAIL: finished call was reused instead of recomputed\n" );
+        ++failures;
+    }
+
+    // 3. 다른 키는 서로 기다리지 않음 (리더 안에서 다른 키를 호출해도 바로 계산)
+    const auto outer = flight.Do( "outer", [ & ] {
+        bool inner_coalesced = true;
+        const auto inner = flight.Do( "inner", [] { return std::make_shared<const int>( 2 ); }, &inner_coalesced );
+        return std::make_shared<const int>( inner_coalesced ? -1 : *inner + 1 );
+    } );
+    if( *outer != 3 ) {
+        std::printf( "FAIL: a different key was coalesced\n" );
+        ++failures;
+    }
+
+    // 4. 리더의 예외는 기다리던 호출에도 전달
+    Flight throwing;
+    std::atomic<int> exceptions { 0 };
+    threads.clear();
+    for( int i = 0; i < CALLERS; ++i ) {
+        threads.emplace_back( [ & ] {
+            try {
+                throwing.Do( "bad", [ & ]() -> std::shared_ptr<const int> {
+                    WaitForWaiters( throwing, CALLERS - 1 );
+                    throw std::runtime_error( "calculation failed" );
+                } );
+            } catch( const std::runtime_error& ) {
+                exceptions.fetch_add( 1 );
+            }
+        } );
+    }
+    for( std::thread& t : threads ) {
+        t.join();
+    }
+    if( exceptions != CALLERS || throwing.stats().leaders != 1 || throwing.stats().in_flight != 0 ) {
+        std::printf( "FAIL: exceptions=%d leaders=%llu (expected %d / 1)\n", exceptions.load(),
+                     static_cast<unsigned long long>( throwing.stats().leaders ), CALLERS );
+        ++failures;
+    }
+
+    std::printf( "callers=%d leaders=%llu coalesced=%llu failures=%d\n", CALLERS,
+                 static_cast<unsigned long long>( stats.leaders ), static_cast<unsigned long long>( stats.coalesced ), failures );
+    return failures == 0 ? 0 : 1;
+}